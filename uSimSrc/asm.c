@@ -180,10 +180,10 @@ struct Operation {
 };
 
 #ifdef Z80
-#define OPERATION(INDEX, CODE, JMP, N8080, NZ80, F8080, FZ80) \
+#define OPERATION(INDEX, CODE, JMP, N8080, NZ80, F8080, FZ80, T8080, TZ80) \
 	{ #CODE, N8080, NZ80 },
 #else
-#define OPERATION(INDEX, CODE, JMP, N8080, NZ80, F8080, FZ80) \
+#define OPERATION(INDEX, CODE, JMP, N8080, NZ80, F8080, FZ80, T8080, TZ80) \
 	{ #CODE, N8080 },
 #endif
 
@@ -1182,10 +1182,9 @@ static int ReadSourceLine(void)
 		goto error;
 
 	/* Read the next line, pop source files if EOF. */
-	while (fgets(gSourceLine, sizeof(gSourceLine), gSourceFile.file) == 0);
-
-  if (!CloseSourceFile())
-    goto error;
+	while (fgets(gSourceLine, sizeof(gSourceLine), gSourceFile.file) == 0)
+		if (!CloseSourceFile())
+			goto error;
 
 	/* Count this source line. */
 	gSourceFile.lineNumber++;
@@ -1993,6 +1992,95 @@ static void ListSymbolTable(void)
 
 }
 
+/**********************************************************************/
+#pragma mark *** LABELS ***
+
+/* The labels of the last source file assembled are kept after its */
+/* symbol table is freed, sorted by address, so that the monitor */
+/* can name the addresses of the program, see LabelAt(). */
+
+#pragma mark Label
+typedef struct Label Label;
+typedef Label *LabelPtr;
+struct Label {
+	Name name;
+	Word address;
+};
+
+static Label *gLabels;
+static unsigned gMaxLabel;
+static int gLabelsEnd;
+
+/* SortCompareLabel() compares labels by address for sorting. */
+static int SortCompareLabel(const Label *a, const Label *b)
+{
+
+	return (int)a->address - (int)b->address;
+
+}
+
+/* KeepLabels() replaces the kept labels with the symbol table's. */
+static void KeepLabels(void)
+{
+	HashEntryPtr h;
+	unsigned count = 0;
+	int i;
+
+	free(gLabels);
+	gLabels = 0;
+	gMaxLabel = 0;
+	gLabelsEnd = gMaxAddress;
+
+	for (i = 0; i < kMaxHashTable; i++)
+		for (h = gHashTable[i]; h != 0; h = h->right)
+			if (h->symbol.state == kSymbolLABEL)
+				count++;
+	if ((count == 0) || ((gLabels = malloc(count * sizeof(Label))) == 0))
+		return;
+
+	for (i = 0; i < kMaxHashTable; i++)
+		for (h = gHashTable[i]; h != 0; h = h->right)
+			if (h->symbol.state == kSymbolLABEL) {
+				strcpy(gLabels[gMaxLabel].name, h->symbol.name);
+				gLabels[gMaxLabel++].address = (Word)h->symbol.value;
+			}
+
+	Sort(gLabels,
+	     gMaxLabel,
+	     sizeof(Label),
+	     (SortCompareFunction)SortCompareLabel);
+
+}
+
+/* LabelAt() returns the name of the last label at or before */
+/* address, and its distance, or zero if there is none or if */
+/* address is past the end of the program. */
+const char *LabelAt(Word address, Word *offset)
+{
+	unsigned low = 0;
+	unsigned high = gMaxLabel;
+	unsigned n;
+
+	if (address >= gLabelsEnd)
+		return 0;
+
+	/* Find the first label after address. */
+	while (low < high) {
+		n = (low + high) / 2;
+		if (gLabels[n].address <= address)
+			low = n + 1;
+		else
+			high = n;
+	}
+	if (low == 0)
+		return 0;
+
+	*offset = (Word)(address - gLabels[low - 1].address);
+
+	return gLabels[low - 1].name;
+
+}
+
 /**********************************************************************/
 #pragma mark *** PARSER UTILITIES ***
 
@@ -4129,6 +4217,12 @@ int
 		goto error;
 	}
 
+	/* Keep the labels of a source file for LabelAt(). */
+	if ((sourceFile != 0) &&
+	    !IsComFile(sourceFile) &&
+	    strcmp(FileExtension(sourceFile), "HEX"))
+		KeepLabels();
+
 	/* Return the current address. */
 	if (addressPtr != 0)
 		*addressPtr = gCurrentAddress;
@@ -1 +1 @@
-/* uSim asm.h * Copyright (C) 2000, Tsurishaddai Williamson, tsuri@earthlink.net *  * This program is free software; you can redistribute it and/or * modify it under the terms of the GNU General Public License * as published by the Free Software Foundation; either version 2 * of the License, or (at your option) any later version. *  * This program is distributed in the hope that it will be useful, * but WITHOUT ANY WARRANTY; without even the implied warranty of * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the * GNU General Public License for more details. *  * You should have received a copy of the GNU General Public License * along with this program; if not, write to the Free Software * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA. *//**********************************************************************/extern int CalculateExpression(char *buffer, long *result);extern int	Assemble(const char *sourceLine,	         Byte (*rdByte)(Word address),	         const Byte *sourceCode,	         const char *sourceFile,	         const char *listFile,	         const char *objectFile,	         const char *codeFile,	         void (*wrByte)(Word address, Byte value),	         Word *addressPtr,	         Word addressBias,	         int stripZeros,	         int debug);
\ No newline at end of file
+/* uSim asm.h * Copyright (C) 2000, Tsurishaddai Williamson, tsuri@earthlink.net *  * This program is free software; you can redistribute it and/or * modify it under the terms of the GNU General Public License * as published by the Free Software Foundation; either version 2 * of the License, or (at your option) any later version. *  * This program is distributed in the hope that it will be useful, * but WITHOUT ANY WARRANTY; without even the implied warranty of * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the * GNU General Public License for more details. *  * You should have received a copy of the GNU General Public License * along with this program; if not, write to the Free Software * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA. *//**********************************************************************/extern int CalculateExpression(char *buffer, long *result);/* LabelAt() returns the name of the last label at or before *//* address, and its distance, or zero if there is none. */extern const char *LabelAt(Word address, Word *offset);extern int	Assemble(const char *sourceLine,	         Byte (*rdByte)(Word address),	         const Byte *sourceCode,	         const char *sourceFile,	         const char *listFile,	         const char *objectFile,	         const char *codeFile,	         void (*wrByte)(Word address, Byte value),	         Word *addressPtr,	         Word addressBias,	         int stripZeros,	         int debug);
\ No newline at end of file
@@ -33,6 +33,7 @@
 #include "monitor.h"
 #include "dir.h"
 #include "hostfile.h"
+#include "snapshot.h"
 
 /**********************************************************************/
 #pragma mark *** BLOCK DEVICE ***
@@ -104,11 +105,12 @@ struct BDev {
 	BDevReadFunction bDevRead;
 	BDevCloseFunction bDevClose;
 	void *cookie;
+	Byte **overlay;
 };
 
 /* Instantiation of all 16 Block Devices. */
 #pragma mark gBDev[]
-static BDev gBDev[kMaxBDev] = {
+static MACHINE BDev gBDev[kMaxBDev] = {
 	{ "A:", 0x0 },
 	{ "B:", 0x1 },
 	{ "C:", 0x2 },
@@ -127,6 +129,9 @@ static BDev gBDev[kMaxBDev] = {
 	{ "P:", 0xF }
 };
 
+/* The block device whose ALV and CSV are installed in memory. */
+static MACHINE BDevPtr gPreviousBDev;
+
 /* SolicitBDevName() solicits a block device name. */
 static int SolicitBDevName(BDevPtr bDevPtr, const char *name)
 {
@@ -1730,7 +1735,6 @@ closed:
 /* BDevInstallParameters() copies the parameters into memory. */
 int BDevInstallParameters(BDevPtr bDevPtr, Word dpAddress)
 {
-	static BDevPtr previousBDev;
 	unsigned i;
 
 	/* If the bDev is not open, use standard parameters. */
@@ -1790,17 +1794,17 @@ int BDevInstallParameters(BDevPtr bDevPtr, Word dpAddress)
 		WrByte(bDevPtr->xltAddress.word + i, bDevPtr->pb.xlt[i]);
 
 	/* If a previous bDev was active... */
-	if (previousBDev != 0) {
+	if (gPreviousBDev != 0) {
 		/* then save the data allocation vector... */
 		for (i = 0; i < kMaxALV; i++)
-			previousBDev->alv[i] =
-				RdByte(previousBDev->alvAddress.word + i);
+			gPreviousBDev->alv[i] =
+				RdByte(gPreviousBDev->alvAddress.word + i);
 		/* and save the directory check vector. */
 		for (i = 0; i < kMaxCKS; i++)
-			previousBDev->csv[i] =
-				RdByte(previousBDev->csvAddress.word + i);
+			gPreviousBDev->csv[i] =
+				RdByte(gPreviousBDev->csvAddress.word + i);
 	}
-	previousBDev = bDevPtr;
+	gPreviousBDev = bDevPtr;
 
 	/* Install the data allocation vector. */
 	for (i = 0; i < kMaxALV; i++)
@@ -1823,6 +1827,43 @@ error:
 
 }
 
+/* OverlayWrite() writes a sector to the overlay of a block device. */
+static int
+	OverlayWrite(BDevPtr bDevPtr, unsigned long sectorIndex, Byte *sector)
+{
+	Byte **overlay = &bDevPtr->overlay[sectorIndex];
+
+	if (*overlay == 0)
+		if ((*overlay = malloc(kBDevSectorSize)) == 0)
+			goto error;
+
+	memcpy(*overlay, sector, kBDevSectorSize);
+
+	/* All done, no error, return non-zero. */
+	return 1;
+
+	/* Return zero if there was an error. */
+error:
+	return 0;
+
+}
+
+/* OverlayClose() deallocates the overlay of a block device. */
+static void OverlayClose(BDevPtr bDevPtr)
+{
+	unsigned long i;
+
+	if (bDevPtr->overlay != 0) {
+		for (i = 0; i < bDevPtr->pb.spd; i++)
+			if (bDevPtr->overlay[i] != 0)
+				free(bDevPtr->overlay[i]);
+		free(bDevPtr->overlay);
+	}
+
+	bDevPtr->overlay = 0;
+
+}
+
 /* BDevWrite() writes a sector to a block device. */
 int
 	BDevWrite(BDevPtr bDevPtr,
@@ -1853,8 +1894,12 @@ int
 	if (sectorIndex >= bDevPtr->pb.spd)
 		goto error;
 
-	/* Write a sector. */
-	if (!bDevPtr->bDevWrite(bDevPtr, sectorIndex, sector))
+	/* Write a sector, to the overlay if there is one. */
+	if (bDevPtr->overlay != 0) {
+		if (!OverlayWrite(bDevPtr, sectorIndex, sector))
+			goto error;
+	}
+	else if (!bDevPtr->bDevWrite(bDevPtr, sectorIndex, sector))
 		goto error;
 
 	/* All done, no error, return the block device status. */
@@ -1896,8 +1941,10 @@ int
 	if (sectorIndex >= bDevPtr->pb.spd)
 		goto error;
 
-	/* Read a sector. */
-	if (!bDevPtr->bDevRead(bDevPtr, sectorIndex, sector))
+	/* Read a sector, from the overlay if it was written there. */
+	if ((bDevPtr->overlay != 0) && (bDevPtr->overlay[sectorIndex] != 0))
+		memcpy(sector, bDevPtr->overlay[sectorIndex], kBDevSectorSize);
+	else if (!bDevPtr->bDevRead(bDevPtr, sectorIndex, sector))
 		goto error;
 
 	/* All done, no error, return the block device status. */
@@ -1981,6 +2028,9 @@ void BDevClose(BDevPtr bDevPtr)
 	if (bDevPtr->isOpen != 0)
 		bDevPtr->bDevClose(bDevPtr);
 
+	/* Forget any sectors written to the overlay. */
+	OverlayClose(bDevPtr);
+
 	bDevPtr->isOpen = 0;
 
 }
@@ -1996,6 +2046,7 @@ int BDevOpen(BDevPtr bDevPtr, const char *name, int readOnly)
 
 	/* Clear the block device structure. */
 	bDevPtr->cookie = 0;
+	bDevPtr->overlay = 0;
 	bDevPtr->dpAddress = 0;
 	bDevPtr->pbAddress.word = 0;
 	bDevPtr->xltAddress.word = 0;
@@ -2094,6 +2145,112 @@ void BDevUnmount(const char *bDev)
 
 }
 
+/* BDevPrivate() makes every mounted disk private to this process,
+ * after a fork(): each disk file is opened again, so that no file
+ * position is shared with the parent, and the sectors written from now
+ * on go to an overlay in memory instead of the file. A RAMDISK is
+ * already private.
+ */
+int BDevPrivate(void)
+{
+	char name[kMaxFileName];
+	BDevPtr bDevPtr;
+	BDev saved;
+	unsigned i;
+
+	for (i = 0; i < kMaxBDev; i++) {
+		bDevPtr = &gBDev[i];
+		if (!bDevPtr->isOpen || (bDevPtr->overlay != 0))
+			continue;
+		if (!strcasecmp(bDevPtr->name, "RAMDISK"))
+			continue;
+
+		/* Open the disk again, keeping the CP/M state. */
+		memcpy(&saved, bDevPtr, sizeof(saved));
+		strcpy(name, bDevPtr->name);
+		BDevClose(bDevPtr);
+		bDevPtr->name[0] = 0;
+		if (BDevOpen(bDevPtr, name, saved.isReadOnly) == kBDevStatusError)
+			goto error;
+		bDevPtr->dpAddress = saved.dpAddress;
+		bDevPtr->xltAddress = saved.xltAddress;
+		bDevPtr->alvAddress = saved.alvAddress;
+		bDevPtr->csvAddress = saved.csvAddress;
+		bDevPtr->pbAddress = saved.pbAddress;
+		bDevPtr->pb = saved.pb;
+		memcpy(bDevPtr->alv, saved.alv, sizeof(saved.alv));
+		memcpy(bDevPtr->csv, saved.csv, sizeof(saved.csv));
+
+		/* Keep the writes in an overlay. */
+		bDevPtr->overlay = calloc(bDevPtr->pb.spd, sizeof(Byte *));
+		if (bDevPtr->overlay == 0)
+			goto error;
+	}
+
+	/* All done, no error, return non-zero. */
+	return 1;
+
+	/* Return zero if there was an error. */
+error:
+	SystemMessage("?PRIVATE [%s]\n", bDevPtr->bDev);
+	return 0;
+
+}
+
+/* BDevSnapshot() saves or loads the block devices. The disks are */
+/* mounted again by name, a RAMDISK is saved with its contents. */
+void BDevSnapshot(SnapshotPtr s)
+{
+	char name[kMaxFileName];
+	Byte previous = 0xFF;
+	BDevPtr bDevPtr;
+	int isReadOnly;
+	int isOpen;
+	unsigned i;
+
+	/* Unmount everything, and forget the names, before loading. */
+	if (s->isLoad) {
+		BDevUnmount(0);
+		for (i = 0; i < kMaxBDev; i++)
+			gBDev[i].name[0] = 0;
+	}
+
+	for (i = 0; i < kMaxBDev; i++) {
+		bDevPtr = &gBDev[i];
+		if (bDevPtr == gPreviousBDev)
+			previous = (Byte)i;
+
+		isOpen = bDevPtr->isOpen;
+		isReadOnly = bDevPtr->isReadOnly;
+		strcpy(name, isOpen ? bDevPtr->name : "");
+		SnapshotValue(s, isOpen);
+		SnapshotValue(s, isReadOnly);
+		SnapshotValue(s, name);
+
+		/* Mount the disk again. */
+		if (s->isLoad && !s->isError && isOpen)
+			if (BDevOpen(bDevPtr, name, isReadOnly) == kBDevStatusError)
+				s->isError = 1;
+
+		SnapshotValue(s, bDevPtr->dpAddress);
+		SnapshotValue(s, bDevPtr->xltAddress);
+		SnapshotValue(s, bDevPtr->alvAddress);
+		SnapshotValue(s, bDevPtr->csvAddress);
+		SnapshotValue(s, bDevPtr->pbAddress);
+		SnapshotValue(s, bDevPtr->pb);
+		SnapshotValue(s, bDevPtr->alv);
+		SnapshotValue(s, bDevPtr->csv);
+
+		if (isOpen && !s->isError && !strcasecmp(name, "RAMDISK"))
+			SnapshotBytes(s, ((RamDiskPtr)bDevPtr->cookie)->ram, SSSIZ);
+	}
+
+	SnapshotValue(s, previous);
+	if (s->isLoad)
+		gPreviousBDev = (previous < kMaxBDev) ? &gBDev[previous] : 0;
+
+}
+
 /* ShowBDevParameterBlock() displays a bDev parameter block. */
 void ShowBDevParameterBlock(BDevParameterBlockPtr pb, int showXLT)
 {
@@ -0,0 +1,663 @@
+/* uSim bench.c
+ * Copyright (C) 2000, Tsurishaddai Williamson, tsuri@earthlink.net
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+/**********************************************************************/
+
+/* uSimBench runs a CP/M program, read from an Intel HEX file, on
+ * cpu.c and memory.c alone: there is no console, monitor, disk or
+ * CP/M, just a BDOS that implements console output (functions 2 and
+ * 9) and a warm boot that ends the run. The program output goes to
+ * stdout, the time taken to stderr. "make bench" builds it with and
+ * without the JIT, and compares the two on ZEXDOC.
+ *
+ * Each line of ZEXDOC or ZEXALL output that ends in OK or ERROR is a
+ * test group: uSimBench reports PASS or FAIL with the wall time,
+ * instructions and MIPS of the group, and exits with 1 if any failed.
+ * -r <report> appends the same numbers to a tab separated report file,
+ * after a "; date engine program" line, to track them over time.
+ *
+ * uSimBench -m [<millions>] instead runs a generated loop for each
+ * instruction family (8-bit ALU, 16-bit arithmetic, memory operands,
+ * CB bit operations, block moves, relative branches, CALL/RET, port
+ * I/O, and back to back pairs of opfuse.h) for a fixed number of
+ * instructions, 100 M by default, and
+ * reports nanoseconds per instruction, which shows which handlers a
+ * change to the dispatch, memory or flag code slowed down.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <time.h>
+
+#include "memory.h"
+#include "clock.h"
+#include "system.h"
+#include "cpu.h"
+#include "monitor.h"
+
+#ifdef JIT
+#define kEngine "JIT"
+#else
+#define kEngine "interpreter"
+#endif
+
+#define kBDOSPort 0xFF
+
+/**********************************************************************/
+#pragma mark *** SYSTEM ***
+
+MACHINE Byte gSystemFlags;
+
+MACHINE unsigned long gCheckForInterrupts;
+
+MACHINE unsigned long gInstructions;
+
+MACHINE PortFunction gSystemPort[256];
+
+MACHINE SystemStats gSystemStats;
+
+static CpuStatePtr gCpu;
+
+static unsigned long gBudget;
+
+/* SystemInterrupt() ends the run when the instruction budget, if */
+/* any, is spent. */
+void SystemInterrupt(void)
+{
+
+	if ((gBudget != 0) && (SystemInstructions() >= gBudget))
+		SetSystemFlags(kSystemHalt, 0);
+
+}
+
+/* SystemTick() has no profiler to sample for. */
+void SystemTick(void)
+{
+
+	SystemInterrupt();
+
+}
+
+/* SystemIdle() never waits, there is nothing to wait for. */
+void SystemIdle(unsigned long milliseconds)
+{
+
+	SystemInterrupt();
+
+}
+
+void SetSystemFlags(unsigned on, unsigned off)
+{
+
+	gSystemFlags = (Byte)((gSystemFlags & ~off) | on);
+
+}
+
+/* MonitorFlags() ends the run at a halt (the warm boot). */
+Byte MonitorFlags(CpuStatePtr cpu)
+{
+
+	gCpu = cpu;
+
+	return (Byte)(gSystemFlags & kSystemHalt);
+
+}
+
+int ConsolePrintf(const char *format, ...)
+{
+	va_list ap;
+	int result;
+
+	va_start(ap, format);
+	result = vprintf(format, ap);
+	va_end(ap);
+
+	return result;
+
+}
+
+/**********************************************************************/
+#pragma mark *** REPORT ***
+
+static FILE *gReport;
+
+static char gLine[256];
+
+static unsigned gLineSize;
+
+static unsigned long long gGroupStart;
+
+static unsigned long gGroupInstructions;
+
+static unsigned gPassed;
+
+static unsigned gFailed;
+
+/* Report() appends a line to the report file, if there is one. */
+static void Report(const char *format, ...)
+{
+	va_list ap;
+
+	if (gReport == 0)
+		return;
+
+	va_start(ap, format);
+	vfprintf(gReport, format, ap);
+	va_end(ap);
+
+}
+
+/* OpenReport() opens the report file for appending, and dates the */
+/* run. */
+static int OpenReport(const char *name, const char *program)
+{
+	time_t now;
+
+	if ((gReport = fopen(name, "a")) == 0)
+		goto error;
+
+	time(&now);
+	Report("; %.24s %s %s\n", ctime(&now), kEngine, program);
+
+	return 1;
+
+error:
+	return 0;
+
+}
+
+/* StartGroup() starts timing the next test group. */
+static void StartGroup(void)
+{
+
+	gGroupStart = GetMicroseconds();
+	gGroupInstructions = SystemInstructions();
+
+}
+
+/* Group() ends a test group at the end of an exerciser line that */
+/* says OK or ERROR, and reports it. Other lines are ignored. */
+static void Group(void)
+{
+	unsigned long long microseconds;
+	unsigned long instructions;
+	const char *result;
+	char *name;
+	char *end;
+
+	microseconds = GetMicroseconds() - gGroupStart;
+	instructions = SystemInstructions() - gGroupInstructions;
+
+	gLine[gLineSize] = 0;
+	gLineSize = 0;
+	for (name = gLine; *name == '\r'; name++)
+		;
+	end = name + strlen(name);
+	while ((end > name) && ((end[-1] == '\r') || (end[-1] == ' ')))
+		*--end = 0;
+
+	if (strstr(name, "ERROR") != 0) {
+		result = "FAIL";
+		gFailed++;
+	}
+	else if ((end - name > 2) && (strcmp(end - 2, "OK") == 0)) {
+		result = "PASS";
+		gPassed++;
+	}
+	else
+		goto done;
+
+	if ((end = strstr(name, "..")) != 0)
+		*end = 0;
+	if (microseconds == 0)
+		microseconds = 1;
+
+	fprintf(stderr,
+	        "%s %8.3f s %12lu instructions %8.2f MIPS  %s\n",
+	        result,
+	        microseconds / 1e6,
+	        instructions,
+	        (double)instructions / microseconds,
+	        name);
+	Report("%s\t%s\t%.3f\t%lu\t%.2f\n",
+	       name,
+	       result,
+	       microseconds / 1e6,
+	       instructions,
+	       (double)instructions / microseconds);
+
+done:
+	StartGroup();
+
+}
+
+/* Output() prints a character of the program output, collecting */
+/* its lines for Group(). */
+static void Output(Byte c)
+{
+
+	putchar(c);
+
+	if (c == '\n')
+		Group();
+	else if (gLineSize < sizeof(gLine) - 1)
+		gLine[gLineSize++] = (char)c;
+
+}
+
+/**********************************************************************/
+#pragma mark *** BDOS ***
+
+static void NoPort(Byte *in, Byte out)
+{
+
+	if (in != 0)
+		*in = 0xFF;
+
+}
+
+/* BDOSPort() implements the BDOS functions in C. */
+static void BDOSPort(Byte *in, Byte out)
+{
+	Word address;
+	Byte c;
+
+	if (in != 0) {
+		*in = 0;
+		return;
+	}
+
+	switch (gCpu->bc.byte.low) {
+	case 2:
+		Output(gCpu->de.byte.low);
+		break;
+	case 9:
+		address = gCpu->de.word;
+		while ((c = RdByte(address++)) != '$')
+			Output(c);
+		break;
+	}
+
+	fflush(stdout);
+
+}
+
+/**********************************************************************/
+#pragma mark *** MICRO BENCHMARKS ***
+
+#ifdef Z80
+
+/* Each family is a sequence of instructions, repeated kRepeat times */
+/* in a loop at kCodeAddress + (family * kCodeSize), ended by a JP */
+/* back. Every loop starts with A = 55H, BC = 0010H (C is a port), */
+/* DE = 9000H, HL = IX = IY = 8000H and SP = F000H. RST 38H and */
+/* CALL 0040H reach a RET. */
+#define kRepeat 16
+#define kCodeAddress 0x1000
+#define kCodeSize 0x0400
+#define kMicroPort 0x10
+
+typedef struct {
+	const char *name;
+	Byte size;
+	Byte code[32];
+} Family;
+
+static const Family gFamilies[] = {
+	{"alu8", 13, {
+		0x80,			/* ADD A,B */
+		0x89,			/* ADC A,C */
+		0x92,			/* SUB D */
+		0x9B,			/* SBC A,E */
+		0xA4,			/* AND H */
+		0xAD,			/* XOR L */
+		0xB0,			/* OR B */
+		0xB9,			/* CP C */
+		0x3C,			/* INC A */
+		0x1D,			/* DEC E */
+		0xC6, 0x05,		/* ADD A,05H */
+		0x2F			/* CPL */
+	}},
+	{"alu16", 13, {
+		0x19,			/* ADD HL,DE */
+		0x13,			/* INC DE */
+		0x0B,			/* DEC BC */
+		0xED, 0x4A,		/* ADC HL,BC */
+		0xED, 0x52,		/* SBC HL,DE */
+		0xDD, 0x09,		/* ADD IX,BC */
+		0x23,			/* INC HL */
+		0x1B,			/* DEC DE */
+		0xFD, 0x23		/* INC IY */
+	}},
+	{"memory", 22, {
+		0x7E,			/* LD A,(HL) */
+		0x70,			/* LD (HL),B */
+		0x34,			/* INC (HL) */
+		0x86,			/* ADD A,(HL) */
+		0x36, 0x05,		/* LD (HL),05H */
+		0x35,			/* DEC (HL) */
+		0xDD, 0x7E, 0x05,	/* LD A,(IX+5) */
+		0xDD, 0x77, 0x06,	/* LD (IX+6),A */
+		0xDD, 0x34, 0x07,	/* INC (IX+7) */
+		0xFD, 0xBE, 0x02,	/* CP (IY+2) */
+		0x32, 0x10, 0x80	/* LD (8010H),A */
+	}},
+	{"bit", 22, {
+		0xCB, 0x5F,		/* BIT 3,A */
+		0xCB, 0xE2,		/* SET 4,D */
+		0xCB, 0xA2,		/* RES 4,D */
+		0xCB, 0x13,		/* RL E */
+		0xCB, 0x39,		/* SRL C */
+		0xCB, 0x06,		/* RLC (HL) */
+		0xCB, 0x7E,		/* BIT 7,(HL) */
+		0xDD, 0xCB, 0x03, 0xCE,	/* SET 1,(IX+3) */
+		0xDD, 0xCB, 0x03, 0x8E	/* RES 1,(IX+3) */
+	}},
+	{"block", 18, {
+		0xED, 0xA0,		/* LDI */
+		0xED, 0xA8,		/* LDD */
+		0xED, 0xA1,		/* CPI */
+		0xED, 0xA9,		/* CPD */
+		0x01, 0x04, 0x00,	/* LD BC,0004H */
+		0xED, 0xB0,		/* LDIR */
+		0x01, 0x04, 0x00,	/* LD BC,0004H */
+		0xED, 0xB8		/* LDDR */
+	}},
+	{"branch", 12, {
+		0x18, 0x00,		/* JR $+2 */
+		0x20, 0x00,		/* JR NZ,$+2 */
+		0x28, 0x00,		/* JR Z,$+2 */
+		0x30, 0x00,		/* JR NC,$+2 */
+		0x38, 0x00,		/* JR C,$+2 */
+		0x10, 0x00		/* DJNZ $+2 */
+	}},
+	{"call", 7, {
+		0xCD, 0x40, 0x00,	/* CALL 0040H */
+		0xFF,			/* RST 38H */
+		0xCD, 0x40, 0x00	/* CALL 0040H */
+	}},
+	{"io", 8, {
+		0xD3, kMicroPort,	/* OUT (10H),A */
+		0xDB, kMicroPort,	/* IN A,(10H) */
+		0xED, 0x79,		/* OUT (C),A */
+		0xED, 0x78		/* IN A,(C) */
+	}},
+	{"pairs", 18, {
+		0x7A,			/* LD A,D */
+		0xB3,			/* OR E */
+		0x03,			/* INC BC */
+		0x13,			/* INC DE */
+		0x23,			/* INC HL */
+		0x3D,			/* DEC A */
+		0x5E,			/* LD E,(HL) */
+		0x23,			/* INC HL */
+		0x29,			/* ADD HL,HL */
+		0xEB,			/* EX DE,HL */
+		0x19,			/* ADD HL,DE */
+		0x7E,			/* LD A,(HL) */
+		0x91,			/* SUB C */
+		0x6F,			/* LD L,A */
+		0x98,			/* SBC A,B */
+		0x67,			/* LD H,A */
+		0xC1,			/* POP BC */
+		0xC5			/* PUSH BC */
+	}}
+};
+
+#define kFamilies (sizeof(gFamilies) / sizeof(gFamilies[0]))
+
+/* MicroFamily() builds the loop for a family at address, runs it */
+/* for count instructions, and reports nanoseconds per instruction. */
+static void MicroFamily(const Family *family, Word address, unsigned long count)
+{
+	unsigned long long microseconds;
+	unsigned long instructions;
+	Word loop = address;
+	unsigned i;
+	unsigned j;
+
+	for (i = 0; i < kRepeat; i++)
+		for (j = 0; j < family->size; j++)
+			WrByte(address++, family->code[j]);
+	WrByte(address++, 0xC3);	/* JP loop */
+	WrByte(address++, (Byte)loop);
+	WrByte(address, (Byte)(loop >> 8));
+
+	gCpu->af.word = 0x5500;
+	gCpu->bc.word = kMicroPort;
+	gCpu->de.word = 0x9000;
+	gCpu->hl.word = 0x8000;
+	gCpu->ix.word = 0x8000;
+	gCpu->iy.word = 0x8000;
+	gCpu->sp.word = 0xF000;
+	gCpu->pc.word = loop;
+	gSystemFlags = 0;
+
+	StartGroup();
+	gBudget = gGroupInstructions + count;
+	Cpu();
+	microseconds = GetMicroseconds() - gGroupStart;
+	instructions = SystemInstructions() - gGroupInstructions;
+	if (instructions == 0)
+		instructions = 1;
+
+	fprintf(stderr,
+	        "%-8s %12lu instructions %8.2f s %8.2f ns/instruction\n",
+	        family->name,
+	        instructions,
+	        microseconds / 1e6,
+	        microseconds * 1e3 / instructions);
+	Report("%s\t%lu\t%.3f\t%.3f\n",
+	       family->name,
+	       instructions,
+	       microseconds / 1e6,
+	       microseconds * 1e3 / instructions);
+
+}
+
+/* Micro() runs every family for millions of instructions. */
+static void Micro(unsigned long millions)
+{
+	unsigned i;
+
+	WrByte(0x0038, 0xC9);		/* RET */
+	WrByte(0x0040, 0xC9);		/* RET */
+
+	for (i = 0; i < kFamilies; i++)
+		MicroFamily(&gFamilies[i],
+		            (Word)(kCodeAddress + (i * kCodeSize)),
+		            millions * 1000000);
+
+	gBudget = 0;
+
+}
+
+#endif
+
+/**********************************************************************/
+#pragma mark *** MAIN ***
+
+/* Hex() converts size hex digits. */
+static unsigned Hex(const char *s, unsigned size)
+{
+	unsigned value = 0;
+
+	while (size-- > 0) {
+		value <<= 4;
+		if ((*s >= '0') && (*s <= '9'))
+			value |= *s - '0';
+		else
+			value |= (*s & 0x07) + 9;
+		s++;
+	}
+
+	return value;
+
+}
+
+/* LoadHex() loads an Intel HEX file, whose lines may end in CR. */
+static int LoadHex(const char *name)
+{
+	char line[600];
+	FILE *f;
+	unsigned size;
+	unsigned i;
+	Word address;
+	int c;
+
+	if ((f = fopen(name, "r")) == 0)
+		goto error;
+
+	do {
+		i = 0;
+		while (((c = getc(f)) != EOF) && (c != '\r') && (c != '\n'))
+			if (i < sizeof(line) - 1)
+				line[i++] = (char)c;
+		line[i] = 0;
+		if ((line[0] != ':') || (i < 11))
+			continue;
+		size = Hex(&line[1], 2);
+		address = (Word)Hex(&line[3], 4);
+		if (i < 11 + (2 * size))
+			continue;
+		for (i = 0; i < size; i++)
+			WrByte(address + i, (Byte)Hex(&line[9 + (2 * i)], 2));
+	} while (c != EOF);
+
+	fclose(f);
+
+	return 1;
+
+error:
+	return 0;
+
+}
+
+int main(int argc, char **argv)
+{
+	static Byte rom[kBankSize];
+	static Byte ram[kMaxBank * kBankSize];
+	static Byte bitBucket[kBankSize];
+	const char *report = 0;
+	const char *program = 0;
+	unsigned long millions = 100;
+	int micro = 0;
+	unsigned long long microseconds;
+	unsigned long instructions;
+	unsigned i;
+	int arg;
+
+	for (arg = 1; arg < argc; arg++)
+		if ((strcmp(argv[arg], "-r") == 0) && (arg + 1 < argc))
+			report = argv[++arg];
+#ifdef Z80
+		else if (strcmp(argv[arg], "-m") == 0) {
+			micro = 1;
+			if ((arg + 1 < argc) && (*argv[arg + 1] >= '0') && (*argv[arg + 1] <= '9'))
+				millions = strtoul(argv[++arg], 0, 10);
+		}
+#endif
+		else if ((program == 0) && (*argv[arg] != '-'))
+			program = argv[arg];
+		else
+			goto usage;
+	if ((program == 0) == !micro)
+		goto usage;
+
+	if (!MemoryOpen(rom, sizeof(rom), ram, sizeof(ram), bitBucket))
+		goto error;
+	for (i = 0; i < kMaxBank; i++)
+		WrBank(i, MinRamBank() + i);
+
+	for (i = 0; i < 256; i++)
+		gSystemPort[i] = NoPort;
+	gSystemPort[kBDOSPort] = BDOSPort;
+
+	if ((report != 0) && !OpenReport(report, micro ? "micro" : program)) {
+		fprintf(stderr, "?%s\n", report);
+		goto error;
+	}
+
+	InitCpuToMonitor();
+
+#ifdef Z80
+	if (micro) {
+		Micro(millions);
+		goto done;
+	}
+#endif
+
+	if (!LoadHex(program)) {
+		fprintf(stderr, "?%s\n", program);
+		goto error;
+	}
+
+	/* 0000 DI HALT, 0005 OUT (kBDOSPort),A RET. */
+	/* The word at 0006 is the top of memory, C9FF. */
+	/* HALT only stops the run with interrupts disabled. */
+	WrByte(0x0000, 0xF3);
+	WrByte(0x0001, 0x76);
+	WrByte(0x0005, 0xD3);
+	WrByte(0x0006, kBDOSPort);
+	WrByte(0x0007, 0xC9);
+
+	gCpu->pc.word = 0x0100;
+	gCpu->sp.word = 0x0000;
+	gSystemFlags = 0;
+
+	StartGroup();
+	microseconds = gGroupStart;
+	Cpu();
+	microseconds = GetMicroseconds() - microseconds + 1;
+	instructions = SystemInstructions();
+	if (gPassed + gFailed != 0)
+		fprintf(stderr, "%u groups passed, %u failed\n", gPassed, gFailed);
+	fprintf(stderr,
+	        "%s %s %.2f seconds %lu M instructions %lu M T-states %.2f MIPS\n",
+	        program,
+	        kEngine,
+	        microseconds / 1e6,
+	        instructions / 1000000,
+	        (unsigned long)(gCpu->cycles / 1000000),
+	        (double)instructions / microseconds);
+	Report("total\t%s\t%.3f\t%lu\t%.2f\n",
+	       gFailed ? "FAIL" : "PASS",
+	       microseconds / 1e6,
+	       instructions,
+	       (double)instructions / microseconds);
+
+#ifdef Z80
+done:
+#endif
+	if (gReport != 0)
+		fclose(gReport);
+
+	return gFailed != 0;
+
+usage:
+	fprintf(stderr, "usage: %s [-r <report>] program.hex\n", argv[0]);
+#ifdef Z80
+	fprintf(stderr, "       %s [-r <report>] -m [<millions>]\n", argv[0]);
+#endif
+
+error:
+	return 1;
+
+}
@@ -1 +1 @@
-/* uSim clock.h * Copyright (C) 2000, Tsurishaddai Williamson, tsuri@earthlink.net *  * This program is free software; you can redistribute it and/or * modify it under the terms of the GNU General Public License * as published by the Free Software Foundation; either version 2 * of the License, or (at your option) any later version. *  * This program is distributed in the hope that it will be useful, * but WITHOUT ANY WARRANTY; without even the implied warranty of * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the * GNU General Public License for more details. *  * You should have received a copy of the GNU General Public License * along with this program; if not, write to the Free Software * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA. *//**********************************************************************/typedef struct TimeOfDay TimeOfDay;typedef TimeOfDay *TimeOfDayPtr;struct TimeOfDay {	unsigned days;    /* Days since 1978 */	unsigned hours;   /* Hours into this day. */	unsigned minutes; /* Minutes into this hour. */	unsigned seconds; /* Seconds into this minute. */};extern void GetTimeOfDay(TimeOfDayPtr timeOfDay);extern unsigned long GetClock(void);extern void ResetClock(unsigned long newClock);
\ No newline at end of file
+/* uSim clock.h * Copyright (C) 2000, Tsurishaddai Williamson, tsuri@earthlink.net *  * This program is free software; you can redistribute it and/or * modify it under the terms of the GNU General Public License * as published by the Free Software Foundation; either version 2 * of the License, or (at your option) any later version. *  * This program is distributed in the hope that it will be useful, * but WITHOUT ANY WARRANTY; without even the implied warranty of * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the * GNU General Public License for more details. *  * You should have received a copy of the GNU General Public License * along with this program; if not, write to the Free Software * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA. *//**********************************************************************/typedef struct TimeOfDay TimeOfDay;typedef TimeOfDay *TimeOfDayPtr;struct TimeOfDay {	unsigned days;    /* Days since 1978 */	unsigned hours;   /* Hours into this day. */	unsigned minutes; /* Minutes into this hour. */	unsigned seconds; /* Seconds into this minute. */};extern void GetTimeOfDay(TimeOfDayPtr timeOfDay);extern unsigned long GetClock(void);extern unsigned long GetTicks(void);extern unsigned long long GetMicroseconds(void);extern void ResetClock(unsigned long newClock);
\ No newline at end of file
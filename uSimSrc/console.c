@@ -24,14 +24,31 @@
 #include <string.h>
 #include <stdlib.h>
 #include <ctype.h>
+#include "memory.h"
+#include "clock.h"
+#include "snapshot.h"
 
 /**********************************************************************/
 #pragma mark *** CONSOLE ***
 
+/* With MACHINES, each thread has a console of its own, like the rest */
+/* of its machine (see memory.h); only one of them may open the */
+/* terminal (see ClaimTerminal()), the others open batch consoles. */
+
 #pragma mark gConsoleInputStack
 #define kConsoleInputStackSize 256
-static Stack gConsoleInputStack;
-static char gConsoleInputStackData[kConsoleInputStackSize];
+static MACHINE Stack gConsoleInputStack;
+static MACHINE char gConsoleInputStackData[kConsoleInputStackSize];
+
+/* gTerminal is non-zero while a thread has the terminal open. */
+#ifdef MACHINES
+static int gTerminal;
+#define ClaimTerminal() __sync_bool_compare_and_swap(&gTerminal, 0, 1)
+#define ReleaseTerminal() __sync_lock_release(&gTerminal)
+#else
+#define ClaimTerminal() 1
+#define ReleaseTerminal()
+#endif
 
 enum {
 #ifdef COLOR
@@ -62,7 +79,7 @@ enum {
 #define kForeColor greenColor
 
 #pragma mark gConsole
-static struct {
+static MACHINE struct {
 	char *windowTitle;
 	char *aboutTitle;
 	char *aboutText;
@@ -94,6 +111,15 @@ static struct {
 		unsigned char _buffer[kConsoleMaxX * kConsoleMaxY];
 #endif
 	} saved;
+	struct {
+		FILE *output;
+		char *input;
+		char *next;
+		int status;
+		unsigned long idle;
+		unsigned long idleSince;
+		unsigned long deadline;
+	} batch;
 } gConsole;
 #define buffer(x, y) _buffer[((y) * kConsoleMaxX) + (x)]
 
@@ -646,6 +672,12 @@ consoleKeyPressed:
 
 }
 
+/* _ConsoleWait() waits for a keystroke, without inputting it. */
+static inline void _ConsoleWait(unsigned long milliseconds)
+{
+#pragma unused(milliseconds)
+}
+
 /* _ConsoleClose() terminates access to the console. */
 static inline void _ConsoleClose(void)
 {
@@ -901,6 +933,12 @@ consoleKeyPressed:
 
 }
 
+/* _ConsoleWait() waits for a keystroke, without inputting it. */
+static inline void _ConsoleWait(unsigned long milliseconds)
+{
+#pragma unused(milliseconds)
+}
+
 /* _ConsoleClose() terminates access to the console. */
 static inline void _ConsoleClose(void)
 {
@@ -1339,8 +1377,6 @@ static inline void _ConsoleScrollUp(void)
 
 }
 
-#define seconds 1000000
-
 static void tty_beep() {
   fprintf(stderr, "\007");
 }
@@ -1358,7 +1394,7 @@ static inline int _ConsoleInput(unsigned waitSeconds)
 
 	memset(sequence, 0, sizeof(sequence));
 
-	if (!tc_read(seconds * 1000, sequence, 1))
+	if (!tc_read(waitSeconds * 1000, sequence, 1))
 		goto consoleNotReady;
 
 	if (keys == 0) {
@@ -1410,6 +1446,25 @@ consoleKeyPressed:
 
 }
 
+/* _ConsoleWait() waits for a keystroke, without inputting it, */
+/* or until milliseconds have passed. */
+static inline void _ConsoleWait(unsigned long milliseconds)
+{
+	fd_set readfds;
+	struct timeval timeout;
+
+	tc_flush(0);
+
+	/* Without a terminal (a batch console) this only sleeps. */
+	FD_ZERO(&readfds);
+	if (fd >= 0)
+		FD_SET(fd, &readfds);
+	timeout.tv_sec = milliseconds / 1000;
+	timeout.tv_usec = (milliseconds % 1000) * 1000;
+	select(fd + 1, &readfds, 0, 0, &timeout);
+
+}
+
 /* _ConsoleClose() terminates access to the console. */
 static inline void _ConsoleClose(void)
 {
@@ -1538,6 +1593,102 @@ error:
 
 #endif
 
+/**********************************************************************/
+#pragma mark *** BATCH CONSOLE ***
+
+/* A batch console has no terminal: the output goes to a file, and
+ * the input is a list of command lines, each typed (followed by a
+ * RETURN) once the machine waits for input with none left and has
+ * written nothing for kBatchWait ms, so a program still printing
+ * never reads the next line as keystrokes. The console quits once
+ * the machine has been waiting, with no lines left, for the idle
+ * time, or when the deadline passes.
+ */
+
+#define kBatchWait 100
+
+/* BatchOutput() outputs a character to the batch output file. */
+static void BatchOutput(int c)
+{
+
+	gConsole.batch.idleSince = 0;
+
+	if (c != '\r')
+		fputc(c, gConsole.batch.output);
+
+}
+
+/* BatchQuit() quits the batch console with a status. */
+static void BatchQuit(int status)
+{
+
+	gConsole.batch.status = status;
+	gConsole.isQuit = 1;
+
+}
+
+static void BatchWait(unsigned long milliseconds);
+
+/* BatchInput() inputs a keystroke, waiting (as BatchWait() does) */
+/* if waitSeconds is not zero. */
+static int BatchInput(unsigned waitSeconds)
+{
+	char key = kConsoleNotReady;
+
+	if ((long)(GetTicks() - gConsole.batch.deadline) >= 0)
+		BatchQuit(kConsoleBatchTimeout);
+
+	else if (waitSeconds != 0) {
+		BatchWait(kBatchWait);
+		if (StackCount(&gConsoleInputStack) > 0)
+			(void)StackPop(&gConsoleInputStack, &key);
+	}
+
+	return gConsole.isQuit ? kConsoleQuit : key;
+
+}
+
+/* BatchWait() types the next command line once the output has */
+/* been quiet for kBatchWait ms, or sleeps while the machine waits */
+/* for input that will not come. */
+static void BatchWait(unsigned long milliseconds)
+{
+	char buffer[kConsoleInputStackSize - 1];
+	char *line = gConsole.batch.next;
+	unsigned long now = GetTicks();
+	size_t size;
+
+	if (gConsole.batch.idleSince == 0)
+		gConsole.batch.idleSince = now;
+
+	if ((line != 0) && (*line != 0) &&
+	    (now - gConsole.batch.idleSince >= kBatchWait)) {
+		/* Lines may end in CR, CR-LF or LF. */
+		size = strcspn(line, "\r\n");
+		gConsole.batch.next = line + size;
+		if (*gConsole.batch.next == '\r')
+			gConsole.batch.next++;
+		if (*gConsole.batch.next == '\n')
+			gConsole.batch.next++;
+		gConsole.batch.idleSince = 0;
+		if (size > sizeof(buffer) - 2)
+			size = sizeof(buffer) - 2;
+		memcpy(buffer, line, size);
+		strcpy(&buffer[size], "\r");
+		ConsolePushInput("%s", buffer);
+		return;
+	}
+
+	if (((line == 0) || (*line == 0)) &&
+	    (now - gConsole.batch.idleSince >= gConsole.batch.idle)) {
+		BatchQuit(kConsoleBatchIdle);
+		return;
+	}
+
+	_ConsoleWait(milliseconds);
+
+}
+
 /**********************************************************************/
 #pragma mark *** CONSOLE ***
 
@@ -1979,6 +2130,11 @@ int ConsoleOutput(int c)
 	if (!gConsole.isOpen)
 		goto error;
 
+	if (gConsole.batch.output != 0) {
+		BatchOutput(c);
+		return 1;
+	}
+
 	_ConsoleCursor(1);
 
 	if (gConsole.escapeState == 1) {
@@ -2215,7 +2371,11 @@ int ConsoleInput(unsigned waitSeconds)
 	else if (StackCount(&gConsoleInputStack) > 0)
 		(void)StackPop(&gConsoleInputStack, &key);
 
-	/* Otherwise input from the Console Keyboard. */
+	/* Otherwise input from the batch input... */
+	else if (gConsole.batch.output != 0)
+		key = BatchInput(waitSeconds);
+
+	/* or from the Console Keyboard. */
 	else
 		key = _ConsoleInput(waitSeconds);
 
@@ -2224,7 +2384,7 @@ int ConsoleInput(unsigned waitSeconds)
 		gConsole.isQuit = 1;
 
 	/* ESCAPE-ESCAPE => MONITOR */
-	if (key == '\033') {
+	if ((key == '\033') && (gConsole.batch.output == 0)) {
 		key = _ConsoleInput(1);
 		if (key == '\033') {
 			key = _ConsoleInput(1);
@@ -2248,6 +2408,24 @@ int ConsoleInput(unsigned waitSeconds)
 
 }
 
+/* ConsoleWait() blocks until a keystroke is ready, or until */
+/* milliseconds have passed. */
+void ConsoleWait(unsigned long milliseconds)
+{
+
+	/* Do not wait if not open, or if input is already waiting. */
+	if (!gConsole.isOpen || gConsole.isQuit)
+		return;
+	if (StackCount(&gConsoleInputStack) > 0)
+		return;
+
+	if (gConsole.batch.output != 0)
+		BatchWait(milliseconds);
+	else
+		_ConsoleWait(milliseconds);
+
+}
+
 /* ConsoleMouse() returns the (x,y) of the last mouse click. */
 void ConsoleMouse(unsigned *x, unsigned *y)
 {
@@ -2259,7 +2437,15 @@ void ConsoleMouse(unsigned *x, unsigned *y)
 void ConsoleClose(void)
 {
 
-	if (gConsole.isOpen) {
+	if (gConsole.batch.output != 0) {
+		fflush(gConsole.batch.output);
+		gConsole.batch.output = 0;
+		free(gConsole.batch.input);
+		gConsole.batch.input = 0;
+		gConsole.isOpen = 0;
+	}
+
+	else if (gConsole.isOpen) {
 		gConsole.isQuit = 0;
 		printf(kConsoleCleanLine);
 		if (ConsoleInput(2) != 0) {
@@ -2267,6 +2453,7 @@ void ConsoleClose(void)
 			(void)getchar();
 		}
 		_ConsoleClose();
+		ReleaseTerminal();
 	}
 	gConsole.isOpen = 0;
 
@@ -2329,8 +2516,12 @@ int
 		goto error;
 	strcpy(gConsole.aboutText, aboutText);
 
-	if (!_ConsoleOpen())
+	if (!ClaimTerminal())
+		goto error;
+	if (!_ConsoleOpen()) {
+		ReleaseTerminal();
 		goto error;
+	}
 
 	printf(kConsoleClearScreen);
 
@@ -2361,3 +2552,77 @@ error:
 	return 0;
 
 }
+
+/* ConsoleOpenBatch() prepares a batch console, without a terminal. */
+/* The output goes to output, the input is lines of commands. The */
+/* console quits after idleSeconds waiting, or timeoutSeconds. */
+int
+	ConsoleOpenBatch(FILE *output,
+	                 const char *input,
+	                 unsigned idleSeconds,
+	                 unsigned timeoutSeconds)
+{
+
+	/* Terminate any existing Console. */
+	ConsoleClose();
+
+	gConsole.isQuit = 0;
+	gConsole.escapeState = 0;
+
+	/* Reset the Console Input Stack. */
+	StackReset(&gConsoleInputStack,
+	           gConsoleInputStackData,
+	           kConsoleInputStackSize,
+	           sizeof(*gConsoleInputStackData));
+
+	/* Save a copy of the input lines. */
+	if ((gConsole.batch.input = malloc(strlen(input) + 1)) == 0)
+		goto error;
+	strcpy(gConsole.batch.input, input);
+
+	gConsole.batch.output = output;
+	gConsole.batch.next = gConsole.batch.input;
+	gConsole.batch.status = kConsoleBatchRunning;
+	gConsole.batch.idle = idleSeconds * 1000UL;
+	gConsole.batch.idleSince = 0;
+	gConsole.batch.deadline = GetTicks() + (timeoutSeconds * 1000UL);
+
+	/* The batch console is open. */
+	gConsole.isOpen = 1;
+
+	return 1;
+
+error:
+	ConsoleClose();
+	return 0;
+
+}
+
+/* ConsoleBatchStatus() returns why a batch console quit. */
+int ConsoleBatchStatus(void)
+{
+
+	return gConsole.batch.status;
+
+}
+
+/* ConsoleSnapshot() saves or loads the screen, and the saved screen. */
+void ConsoleSnapshot(SnapshotPtr s)
+{
+
+	SnapshotValue(s, gConsole.cursorX);
+	SnapshotValue(s, gConsole.cursorY);
+	SnapshotValue(s, gConsole.cursorMode);
+#if defined(ADM31) || defined(COLOR)
+	SnapshotValue(s, gConsole.drawMode);
+	SnapshotValue(s, gConsole.charMode);
+#endif
+	SnapshotValue(s, gConsole._buffer);
+	SnapshotValue(s, gConsole.saved);
+
+	/* Show the loaded screen. */
+	if (s->isLoad && !s->isError)
+		if (gConsole.isOpen && (gConsole.batch.output == 0))
+			ConsoleRefresh();
+
+}
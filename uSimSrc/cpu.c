@@ -33,47 +33,96 @@
 #define CALCULATE_TABLES
 #endif
 
+/* The JIT calls the operation handlers, so it replaces THREADED. */
+/* Its inline code reads and writes F directly, so no LAZY_FLAGS. */
+#ifdef JIT
+#undef THREADED
+#undef LAZY_FLAGS
+#if !defined(__x86_64__)
+#error JIT requires an x86-64 host
+#endif
+#ifdef MACHINES
+#error JIT cannot be used with MACHINES
+#endif
+#endif
+
+/* CACHED_REGISTERS is a variant of the THREADED interpreter alone, */
+/* and F must be in the cache, so no LAZY_FLAGS. */
+#ifdef CACHED_REGISTERS
+#if !defined(THREADED) || defined(JIT) || defined(BLOCK_CACHE)
+#error CACHED_REGISTERS requires THREADED without BLOCK_CACHE or JIT
+#endif
+#ifdef LAZY_FLAGS
+#error CACHED_REGISTERS cannot be used with LAZY_FLAGS
+#endif
+#endif
+
 #include "stdio.h"
+#include <string.h>
+#ifdef REVERSE
+#include <stdlib.h>
+#endif
+#ifdef JIT
+#include <stddef.h>
+#include <sys/mman.h>
+#endif
 
 #include "memory.h"
 #include "system.h"
 #include "cpu.h"
 #include "monitor.h"
+#include "dasm.h"
+#include "snapshot.h"
 
 /* The CPU State. See cpu.h for details. */
 
-static CpuState gCpuState;
+static MACHINE CpuState gCpuState;
 
-#define A        (gCpuState.af.byte.high)
-#define F        (gCpuState.af.byte.low)
+/* The hot registers (A, F, H, L, SP, PC and CYCLES) are reached */
+/* through REGISTERS, which CACHED_REGISTERS redirects, see below. */
+#define REGISTERS gCpuState
+
+#define A        (REGISTERS.af.byte.high)
+#ifdef LAZY_FLAGS
+#define F        (GetCpuState()->af.byte.low)
+#else
+#define F        (REGISTERS.af.byte.low)
+#endif
 #define B        (gCpuState.bc.byte.high)
 #define C        (gCpuState.bc.byte.low)
 #define D        (gCpuState.de.byte.high)
 #define E        (gCpuState.de.byte.low)
-#define H        (gCpuState.hl.byte.high)
-#define L        (gCpuState.hl.byte.low)
-#define SP       (gCpuState.sp.word)
-#define SP_H     (gCpuState.sp.byte.high)
-#define SP_L     (gCpuState.sp.byte.low)
-#define PC       (gCpuState.pc.word)
-#define PC_H     (gCpuState.pc.byte.high)
-#define PC_L     (gCpuState.pc.byte.low)
-#define AF       (gCpuState.af.word)
+#define H        (REGISTERS.hl.byte.high)
+#define L        (REGISTERS.hl.byte.low)
+#define SP       (REGISTERS.sp.word)
+#define SP_H     ((Byte)(SP >> 8))
+#define SP_L     ((Byte)SP)
+#define PC       (REGISTERS.pc.word)
+#define PC_H     ((Byte)(PC >> 8))
+#define PC_L     ((Byte)PC)
+#ifdef LAZY_FLAGS
+#define AF       (GetCpuState()->af.word)
+#else
+#define AF       (REGISTERS.af.word)
+#endif
 #define BC       (gCpuState.bc.word)
 #define DE       (gCpuState.de.word)
-#define HL       (gCpuState.hl.word)
+#define HL       (REGISTERS.hl.word)
+#define CYCLES   (REGISTERS.cycles)
+#define IFF1     (gCpuState.iff1)
+#define IFF2     (gCpuState.iff2)
+#define HALTED   (gCpuState.halt)
 
 #ifdef Z80
 #define AF_PRIME (gCpuState.prime.af.word)
 #define BC_PRIME (gCpuState.prime.bc.word)
 #define DE_PRIME (gCpuState.prime.de.word)
 #define HL_PRIME (gCpuState.prime.hl.word)
-#define IX       (gCpuState.ix.word)
-#define IX_H     (gCpuState.ix.byte.high)
-#define IX_L     (gCpuState.ix.byte.low)
-#define IY       (gCpuState.iy.word)
-#define IY_H     (gCpuState.iy.byte.high)
-#define IY_L     (gCpuState.iy.byte.low)
+/* The DD and FD tables share one set of handlers, which reach IX */
+/* or IY through xy, see DD_OP() and FD_OP(). */
+#define XY       (xy->word)
+#define XY_H     (xy->byte.high)
+#define XY_L     (xy->byte.low)
 #define I        (gCpuState.i)
 #define R        (gCpuState.r)
 #define IM       (gCpuState.im)
@@ -87,13 +136,35 @@ static CpuState gCpuState;
 #define Y_H      (y.byte.high)
 #define Y_L      (y.byte.low)
 
+/* The decoder fetches an opcode with the bytes after it (see */
+/* RdFetch()) and hands them to its handler as fetch, so that the */
+/* handler finds its operands there: NN is the byte after the opcode, */
+/* NN2 the one after that, and NNNN the word after the opcode. The */
+/* handler still moves PC past them. For DDCB and FDCB, the fetch */
+/* starts at the CB, so that NN is the displacement. */
+#define NN       ((Byte)(fetch >> 8))
+#define NN2      ((Byte)(fetch >> 16))
+#define NNNN     ((Word)(fetch >> 8))
+
+#ifdef LAZY_FLAGS
+#define SIGN_FLAG       (gFlags.kind ? \
+                         (gFlags.result & SIGN) : \
+                         (gCpuState.af.byte.low & SIGN))
+#define ZERO_FLAG       (gFlags.kind ? \
+                         (((gFlags.result & 0xFF) == 0) << ZERO_SHIFT) : \
+                         (gCpuState.af.byte.low & ZERO))
+#define CARRY_FLAG      (gFlags.kind ? \
+                         ((gFlags.result >> 8) & CARRY) : \
+                         (gCpuState.af.byte.low & CARRY))
+#else
 #define SIGN_FLAG       (F & SIGN)
 #define ZERO_FLAG       (F & ZERO)
+#define CARRY_FLAG      (F & CARRY)
+#endif
 #define HALFCARRY_FLAG (F & HALFCARRY)
 #define OVERFLOW_FLAG   (F & OVERFLOW)
 #define PARITY_FLAG     (F & PARITY)
 #define SUBTRACT_FLAG   (F & SUBTRACT)
-#define CARRY_FLAG      (F & CARRY)
 
 enum {
 	CARRY_SHIFT       = 0,
@@ -107,6 +178,86 @@ enum {
 	SIGN_SHIFT        = 7
 };
 
+/* With CACHED_REGISTERS defined, ThreadedCpu() keeps the hot
+ * registers, its count of instructions towards the next poll (see
+ * GetSystemFlags()) and copies of gFlat and the bank pointers in a
+ * local CachedRegisters, which it passes to every handler as cache; as the
+ * handlers are inlined and cache never escapes, the compiler can keep
+ * the registers in host registers rather than store and reload
+ * gCpuState around every memory write and call. SaveRegisters() and
+ * LoadRegisters() sync cache with gCpuState at the points where other
+ * code may look: port I/O, HALT idling, and CpuFlags() (interrupts,
+ * SystemInterrupt() and the monitor). The handler parameter lists are
+ * CACHE or CACHE_ (empty otherwise), their arguments CACHED or CACHED_.
+ */
+#ifdef CACHED_REGISTERS
+
+/* pc and sp are words alone, without the bytes of a WordBytes, */
+/* so that nothing keeps them from host registers. */
+typedef struct {
+	WordBytes af;
+	WordBytes hl;
+	struct {
+		Word word;
+	} sp, pc;
+	unsigned long long cycles;
+	unsigned long check;
+	Byte *flat;
+	Byte **rdBanks;
+	Byte **wrBanks;
+} CachedRegisters;
+
+#define CACHE   CachedRegisters *const cache
+#define CACHE_  CachedRegisters *const cache,
+#define CACHED  cache
+#define CACHED_ cache,
+
+/* cache must not escape, so every handler is inlined. */
+#define INLINE inline __attribute__((always_inline))
+
+/* SaveRegisters() writes the cache back to gCpuState. */
+static inline void SaveRegisters(CachedRegisters *cache)
+{
+
+	gCpuState.af = cache->af;
+	gCpuState.hl = cache->hl;
+	gCpuState.sp.word = cache->sp.word;
+	gCpuState.pc.word = cache->pc.word;
+	gCpuState.cycles = cache->cycles;
+	gCheckForInterrupts = cache->check;
+
+}
+
+/* LoadRegisters() fills the cache from gCpuState, and the banks. */
+static inline void LoadRegisters(CachedRegisters *cache)
+{
+
+	cache->af = gCpuState.af;
+	cache->hl = gCpuState.hl;
+	cache->sp.word = gCpuState.sp.word;
+	cache->pc.word = gCpuState.pc.word;
+	cache->cycles = gCpuState.cycles;
+	cache->check = gCheckForInterrupts;
+	cache->flat = gFlat;
+	memcpy(cache->rdBanks, gRdBank, sizeof(gRdBank));
+	memcpy(cache->wrBanks, gWrBank, sizeof(gWrBank));
+
+}
+
+#else
+
+#define CACHE   void
+#define CACHE_
+#define CACHED
+#define CACHED_
+
+#define INLINE inline
+
+#define SaveRegisters(cache)
+#define LoadRegisters(cache)
+
+#endif
+
 /**********************************************************************/
 #pragma mark CPU TABLES
 
@@ -273,25 +424,190 @@ static void CalculateTables(void)
 
 #endif
 
+/**********************************************************************/
+#pragma mark FLAGS
+
+/* The ALU operations describe their flags by a kind, the operands and
+ * a 9-bit result, the result byte with the carry out in bit 8 (for
+ * INC and DEC, the unchanged carry). Flags() turns that into F.
+ *
+ * With LAZY_FLAGS defined, SET_FLAGS() just records the description
+ * in gFlags and F is only computed when something reads it, through
+ * the F and AF macros, GetCpuState(), or the flag macros other than
+ * SIGN_FLAG, ZERO_FLAG and CARRY_FLAG, which read the result directly.
+ * Without LAZY_FLAGS, SET_FLAGS() computes F at once.
+ */
+
+enum {
+	kFlagsNone = 0,
+	kFlagsAdd,
+	kFlagsSubtract,
+	kFlagsCompare,
+	kFlagsAnd,
+	kFlagsParity,
+	kFlagsIncrement,
+	kFlagsDecrement
+};
+
+/* Flags() computes F for an ALU operation. */
+static inline Byte Flags(unsigned kind, Byte a, Byte value, Word result)
+{
+
+	switch (kind) {
+	case kFlagsAdd:
+		return gSignZeroMagic2Magic1[result & 0xFF] |
+		       gHalfCarryOverflowCarry[a ^ value ^ result];
+	case kFlagsSubtract:
+		return (SUBTRACT) |
+		       gSignZeroMagic2Magic1[result & 0xFF] |
+		       gHalfCarryOverflowCarry[a ^ value ^ result];
+	case kFlagsCompare:
+		return (SUBTRACT) |
+		       (result & SIGN) |
+		       (((result & 0xFF) == 0) << ZERO_SHIFT) |
+		       (value & (MAGIC1 | MAGIC2)) |
+		       gHalfCarryOverflowCarry[a ^ value ^ result];
+	case kFlagsAnd:
+		return (HALFCARRY) | gSignZeroMagic2Magic1Parity[result & 0xFF];
+	case kFlagsParity:
+		return gSignZeroMagic2Magic1Parity[result & 0xFF] |
+		       ((result >> 8) & CARRY);
+	case kFlagsIncrement:
+		return gSignZeroMagic2HalfCarryMagic1Overflow[result & 0xFF] |
+		       ((result >> 8) & CARRY);
+	case kFlagsDecrement:
+		return gSignZeroMagic2HalfCarryMagic1OverflowSubtract[result & 0xFF] |
+		       ((result >> 8) & CARRY);
+	}
+
+	return 0;
+
+}
+
+#ifdef LAZY_FLAGS
+
+static MACHINE struct {
+	Byte kind;
+	Byte a;
+	Byte value;
+	Word result;
+} gFlags;
+
+/* RESULT may read CARRY_FLAG, so it is stored before the kind. */
+#define SET_FLAGS(KIND, A, VALUE, RESULT) \
+	(gFlags.result = (RESULT), \
+	 gFlags.a = (A), \
+	 gFlags.value = (VALUE), \
+	 gFlags.kind = (KIND))
+
+/* GetCpuState() computes any pending F and returns the CPU state. */
+static inline CpuStatePtr GetCpuState(void)
+{
+
+	if (gFlags.kind != kFlagsNone) {
+		gCpuState.af.byte.low =
+			Flags(gFlags.kind, gFlags.a, gFlags.value, gFlags.result);
+		gFlags.kind = kFlagsNone;
+	}
+
+	return &gCpuState;
+
+}
+
+#else
+
+#define SET_FLAGS(KIND, A, VALUE, RESULT) \
+	(F = Flags((KIND), (A), (VALUE), (RESULT)))
+
+#define GetCpuState() (&gCpuState)
+
+#endif
+
 /**********************************************************************/
 #pragma mark UOP1, UOP2, UOP3, UOP4, HALT, NOP, DI, EI, IM
 
-#define OPCODE(X) static inline void X(void)
+/* The handlers reach the hot registers and memory through cache. */
+#ifdef CACHED_REGISTERS
+#undef REGISTERS
+#define REGISTERS (*cache)
+#define RdByte(ADDRESS) \
+	RdBankByte(cache->flat, cache->rdBanks, (ADDRESS))
+#define WrByte(ADDRESS, VALUE) \
+	WrBankByte(cache->flat, cache->wrBanks, (ADDRESS), (VALUE))
+#define RwByte(ADDRESS) \
+	RwBankByte(cache->flat, cache->rdBanks, cache->wrBanks, (ADDRESS))
+#define RdFetch(ADDRESS, LENGTHS) \
+	RdBankFetch(cache->flat, (ADDRESS), (LENGTHS))
+#endif
+
+/* xy is IX or IY in the DD and FD handlers, see XY. */
+#define OPCODE(X) \
+	static INLINE void X(CACHE_ unsigned long fetch, WordBytes *xy)
+
+/* The op*.h tables give the T-states of every instruction, for a
+ * conditional JR, DJNZ, CALL or RET when it is not taken and for a
+ * repeating block instruction when it does not repeat. The handlers
+ * add the difference when it is.
+ */
+enum {
+	kJumpTaken   = 5,
+#ifdef Z80
+	kCallTaken   = 7,
+#else
+	kCallTaken   = 6,
+#endif
+	kReturnTaken = 6,
+	kRepeatTaken = 21
+};
 
-static inline void _UOP(Word opLen)
+static INLINE void _UOP(CACHE_ Word opLen)
 {
 	PC -= opLen - 1;
 }
 
-OPCODE(UOP1) { _UOP(1); }
-OPCODE(UOP2) { _UOP(2); }
-OPCODE(UOP3) { _UOP(3); }
-OPCODE(UOP4) { _UOP(4); }
+OPCODE(UOP1) { _UOP(CACHED_ 1); }
+OPCODE(UOP2) { _UOP(CACHED_ 2); }
+OPCODE(UOP3) { _UOP(CACHED_ 3); }
+OPCODE(UOP4) { _UOP(CACHED_ 4); }
+
+/* The INT line is level triggered, a device holds it asserted (with
+ * the byte it puts on the data bus) until it has been serviced. The
+ * kSystemINT flag is only set while INT is asserted and IFF1 is set,
+ * so Cpu() pays nothing for a masked interrupt, or while gEIDelay is
+ * set, so the instruction after EI passes through CpuFlags(), which
+ * ends the delay. See Interrupt().
+ */
+static MACHINE Byte gINT;
+static MACHINE Byte gINTVector;
+static MACHINE Byte gEIDelay;
+
+/* UpdateINT() sets kSystemINT if INT can be accepted. */
+static void UpdateINT(void)
+{
+
+	if ((gINT && IFF1) || gEIDelay)
+		SetSystemFlags(kSystemINT, 0);
+	else
+		SetSystemFlags(0, kSystemINT);
+
+}
 
+/* HALT waits for an interrupt, re-executing itself (as NOPs), or */
+/* halts the system if interrupts are disabled. While no interrupt */
+/* is pending the host idles instead of spinning. */
 OPCODE(HALT)
 {
 	PC -= 1;
-	SetSystemFlags(kSystemHalt, 0);
+	if (IFF1) {
+		HALTED = 1;
+		if (!gINT && !gSystemFlags) {
+			SaveRegisters(CACHED);
+			SystemIdle(kHaltIdle);
+			LoadRegisters(CACHED);
+		}
+	}
+	else
+		SetSystemFlags(kSystemHalt, 0);
 }
 
 OPCODE(NOP)
@@ -299,8 +615,19 @@ OPCODE(NOP)
 	;
 }
 
-OPCODE(DI) { }
-OPCODE(EI) { }
+OPCODE(DI)
+{
+	IFF1 = IFF2 = 0;
+	UpdateINT();
+}
+
+/* EI takes effect after the next instruction. */
+OPCODE(EI)
+{
+	IFF1 = IFF2 = 1;
+	gEIDelay = 1;
+	UpdateINT();
+}
 
 #ifdef Z80
 OPCODE(IM_0) { IM = 0; }
@@ -311,18 +638,41 @@ OPCODE(IM_2) { IM = 2; }
 /**********************************************************************/
 #pragma mark IN, INI, INIR, IND, INDR
 
+/* CpuInput() and CpuOutput() are SystemInput() and SystemOutput() */
+/* with the port seeing the registers, and the cache seeing what */
+/* the port changed, the banks say. */
+static INLINE void CpuInput(CACHE_ Byte port, Byte *value)
+{
+	Byte in = *value;
+
+	SaveRegisters(CACHED);
+	SystemInput(port, &in);
+	LoadRegisters(CACHED);
+	*value = in;
+
+}
+
+static INLINE void CpuOutput(CACHE_ Byte port, Byte value)
+{
+
+	SaveRegisters(CACHED);
+	SystemOutput(port, value);
+	LoadRegisters(CACHED);
+
+}
+
 /* 8-bit input from iNN. */
-OPCODE(IN_A_iNN) { SystemInput(RdByte(PC++), &A); }
+OPCODE(IN_A_iNN) { PC++; CpuInput(CACHED_ NN, &A); }
 
 /* 8-bit input from iC. */
 #ifdef Z80
-OPCODE(IN_A_iC) { SystemInput(C, &A); }
-OPCODE(IN_B_iC) { SystemInput(C, &B); }
-OPCODE(IN_C_iC) { SystemInput(C, &C); }
-OPCODE(IN_D_iC) { SystemInput(C, &D); }
-OPCODE(IN_E_iC) { SystemInput(C, &E); }
-OPCODE(IN_H_iC) { SystemInput(C, &H); }
-OPCODE(IN_L_iC) { SystemInput(C, &L); }
+OPCODE(IN_A_iC) { CpuInput(CACHED_ C, &A); }
+OPCODE(IN_B_iC) { CpuInput(CACHED_ C, &B); }
+OPCODE(IN_C_iC) { CpuInput(CACHED_ C, &C); }
+OPCODE(IN_D_iC) { CpuInput(CACHED_ C, &D); }
+OPCODE(IN_E_iC) { CpuInput(CACHED_ C, &E); }
+OPCODE(IN_H_iC) { CpuInput(CACHED_ C, &H); }
+OPCODE(IN_L_iC) { CpuInput(CACHED_ C, &L); }
 #endif
 
 #ifdef Z80
@@ -333,7 +683,7 @@ OPCODE(IN_L_iC) { SystemInput(C, &L); }
 /* B = counter, Z if zero */
 OPCODE(INI)
 {
-	SystemInput(C, RwByte(HL++));
+	CpuInput(CACHED_ C, RwByte(HL++));
 	F = (F & ~ZERO) | SUBTRACT | ((--B == 0) << ZERO_SHIFT);
 }
 
@@ -343,7 +693,8 @@ OPCODE(INI)
 /* B = counter, Z if zero */
 OPCODE(INIR)
 {
-	do SystemInput(C, RwByte(HL++)); while (--B);
+	CYCLES += kRepeatTaken * (Byte)(B - 1);
+	do CpuInput(CACHED_ C, RwByte(HL++)); while (--B);
 	F |= ZERO | SUBTRACT;
 }
 
@@ -353,7 +704,7 @@ OPCODE(INIR)
 /* B = counter, Z if zero */
 OPCODE(IND)
 {
-	SystemInput(C, RwByte(HL--));
+	CpuInput(CACHED_ C, RwByte(HL--));
 	F = (F & ~ZERO) | SUBTRACT | ((--B == 0) << ZERO_SHIFT);
 }
 
@@ -363,7 +714,8 @@ OPCODE(IND)
 /* B = counter, Z if zero */
 OPCODE(INDR)
 {
-	do SystemInput(C, RwByte(HL--)); while (--B);
+	CYCLES += kRepeatTaken * (Byte)(B - 1);
+	do CpuInput(CACHED_ C, RwByte(HL--)); while (--B);
 	F |= ZERO | SUBTRACT;
 }
 
@@ -373,17 +725,17 @@ OPCODE(INDR)
 #pragma mark OUT, OTI, OTIR, OTD, OTDR
 
 /* 8-bit output to iNN. */
-OPCODE(OUT_iNN_A) { SystemOutput(RdByte(PC++), A); }
+OPCODE(OUT_iNN_A) { PC++; CpuOutput(CACHED_ NN, A); }
 
 /* 8-bit output to iC. */
 #ifdef Z80
-OPCODE(OUT_iC_A) { SystemOutput(C, A); }
-OPCODE(OUT_iC_B) { SystemOutput(C, B); }
-OPCODE(OUT_iC_C) { SystemOutput(C, C); }
-OPCODE(OUT_iC_D) { SystemOutput(C, D); }
-OPCODE(OUT_iC_E) { SystemOutput(C, E); }
-OPCODE(OUT_iC_H) { SystemOutput(C, H); }
-OPCODE(OUT_iC_L) { SystemOutput(C, L); }
+OPCODE(OUT_iC_A) { CpuOutput(CACHED_ C, A); }
+OPCODE(OUT_iC_B) { CpuOutput(CACHED_ C, B); }
+OPCODE(OUT_iC_C) { CpuOutput(CACHED_ C, C); }
+OPCODE(OUT_iC_D) { CpuOutput(CACHED_ C, D); }
+OPCODE(OUT_iC_E) { CpuOutput(CACHED_ C, E); }
+OPCODE(OUT_iC_H) { CpuOutput(CACHED_ C, H); }
+OPCODE(OUT_iC_L) { CpuOutput(CACHED_ C, L); }
 #endif
 
 #ifdef Z80
@@ -394,7 +746,7 @@ OPCODE(OUT_iC_L) { SystemOutput(C, L); }
 /* B = counter, Z if zero */
 OPCODE(OTI)
 {
-	SystemOutput(C, RdByte(HL++));
+	CpuOutput(CACHED_ C, RdByte(HL++));
 	F = (F & ~ZERO) | SUBTRACT | ((--B == 0) << ZERO_SHIFT);
 }
 
@@ -404,7 +756,8 @@ OPCODE(OTI)
 /* B = counter, Z if zero */
 OPCODE(OTIR)
 {
-	do SystemOutput(C, RdByte(HL++)); while (--B);
+	CYCLES += kRepeatTaken * (Byte)(B - 1);
+	do CpuOutput(CACHED_ C, RdByte(HL++)); while (--B);
 	F |= ZERO | SUBTRACT;
 }
 
@@ -414,7 +767,7 @@ OPCODE(OTIR)
 /* B = counter, Z if zero */
 OPCODE(OTD)
 {
-	SystemOutput(C, RdByte(HL--));
+	CpuOutput(CACHED_ C, RdByte(HL--));
 	F = (F & ~ZERO) | SUBTRACT | ((--B == 0) << ZERO_SHIFT);
 }
 
@@ -424,7 +777,8 @@ OPCODE(OTD)
 /* B = counter, Z if zero */
 OPCODE(OTDR)
 {
-	do SystemOutput(C, RdByte(HL--)); while (--B);
+	CYCLES += kRepeatTaken * (Byte)(B - 1);
+	do CpuOutput(CACHED_ C, RdByte(HL--)); while (--B);
 	F |= ZERO | SUBTRACT;
 }
 
@@ -436,7 +790,15 @@ OPCODE(OTDR)
 /* Special case to access the I register. */
 #ifdef Z80
 OPCODE(LD_I_A) { I = A; }
-OPCODE(LD_A_I) { A = I; }
+
+/* LD A,I copies IFF2 to the P/V flag. */
+OPCODE(LD_A_I)
+{
+	A = I;
+	F = (F & CARRY) |
+	    (gSignZeroMagic2Magic1Parity[A] & ~PARITY) |
+	    (IFF2 ? PARITY : 0);
+}
 #endif
 
 /* 8-bit load to the A register. */
@@ -448,26 +810,17 @@ OPCODE(LD_A_E) { A = E; }
 OPCODE(LD_A_H) { A = H; }
 OPCODE(LD_A_L) { A = L; }
 #ifdef Z80
-OPCODE(LD_A_IXH) { A = IX_H; }
-OPCODE(LD_A_IXL) { A = IX_L; }
-OPCODE(LD_A_IYH) { A = IY_H; }
-OPCODE(LD_A_IYL) { A = IY_L; }
+OPCODE(LD_A_XYH) { A = XY_H; }
+OPCODE(LD_A_XYL) { A = XY_L; }
 #endif
-OPCODE(LD_A_NN) { A = RdByte(PC++); }
+OPCODE(LD_A_NN) { PC++; A = NN; }
 OPCODE(LD_A_iBC) { A = RdByte(BC); }
 OPCODE(LD_A_iDE) { A = RdByte(DE); }
 OPCODE(LD_A_iHL) { A = RdByte(HL); }
 #ifdef Z80
-OPCODE(LD_A_iIX_NN) { A = RdByte(IX + (char)RdByte(PC++)); }
-OPCODE(LD_A_iIY_NN) { A = RdByte(IY + (char)RdByte(PC++)); }
+OPCODE(LD_A_iXY_NN) { PC++; A = RdByte(XY + (char)NN); }
 #endif
-OPCODE(LD_A_iNNNN)
-{
-	WordBytes x;
-	X_L = RdByte(PC++);
-	X_H = RdByte(PC++);
-	A = RdByte(X);
-}
+OPCODE(LD_A_iNNNN) { PC += 2; A = RdByte(NNNN); }
 
 /* 8-bit load to the B register. */
 OPCODE(LD_B_A) { B = A; }
@@ -478,16 +831,13 @@ OPCODE(LD_B_E) { B = E; }
 OPCODE(LD_B_H) { B = H; }
 OPCODE(LD_B_L) { B = L; }
 #ifdef Z80
-OPCODE(LD_B_IXH) { B = IX_H; }
-OPCODE(LD_B_IXL) { B = IX_L; }
-OPCODE(LD_B_IYH) { B = IY_H; }
-OPCODE(LD_B_IYL) { B = IY_L; }
+OPCODE(LD_B_XYH) { B = XY_H; }
+OPCODE(LD_B_XYL) { B = XY_L; }
 #endif
-OPCODE(LD_B_NN) { B = RdByte(PC++); }
+OPCODE(LD_B_NN) { PC++; B = NN; }
 OPCODE(LD_B_iHL) { B = RdByte(HL); }
 #ifdef Z80
-OPCODE(LD_B_iIX_NN) { B = RdByte(IX + (char)RdByte(PC++)); }
-OPCODE(LD_B_iIY_NN) { B = RdByte(IY + (char)RdByte(PC++)); }
+OPCODE(LD_B_iXY_NN) { PC++; B = RdByte(XY + (char)NN); }
 #endif
 
 /* 8-bit load to the C register. */
@@ -499,16 +849,13 @@ OPCODE(LD_C_E) { C = E; }
 OPCODE(LD_C_H) { C = H; }
 OPCODE(LD_C_L) { C = L; }
 #ifdef Z80
-OPCODE(LD_C_IXH) { C = IX_H; }
-OPCODE(LD_C_IXL) { C = IX_L; }
-OPCODE(LD_C_IYH) { C = IY_H; }
-OPCODE(LD_C_IYL) { C = IY_L; }
+OPCODE(LD_C_XYH) { C = XY_H; }
+OPCODE(LD_C_XYL) { C = XY_L; }
 #endif
-OPCODE(LD_C_NN) { C = RdByte(PC++); }
+OPCODE(LD_C_NN) { PC++; C = NN; }
 OPCODE(LD_C_iHL) { C = RdByte(HL); }
 #ifdef Z80
-OPCODE(LD_C_iIX_NN) { C = RdByte(IX + (char)RdByte(PC++)); }
-OPCODE(LD_C_iIY_NN) { C = RdByte(IY + (char)RdByte(PC++)); }
+OPCODE(LD_C_iXY_NN) { PC++; C = RdByte(XY + (char)NN); }
 #endif
 
 /* 8-bit load to the D register. */
@@ -520,16 +867,13 @@ OPCODE(LD_D_E) { D = E; }
 OPCODE(LD_D_H) { D = H; }
 OPCODE(LD_D_L) { D = L; }
 #ifdef Z80
-OPCODE(LD_D_IXH) { D = IX_H; }
-OPCODE(LD_D_IXL) { D = IX_L; }
-OPCODE(LD_D_IYH) { D = IY_H; }
-OPCODE(LD_D_IYL) { D = IY_L; }
+OPCODE(LD_D_XYH) { D = XY_H; }
+OPCODE(LD_D_XYL) { D = XY_L; }
 #endif
-OPCODE(LD_D_NN) { D = RdByte(PC++); }
+OPCODE(LD_D_NN) { PC++; D = NN; }
 OPCODE(LD_D_iHL) { D = RdByte(HL); }
 #ifdef Z80
-OPCODE(LD_D_iIX_NN) { D = RdByte(IX + (char)RdByte(PC++)); }
-OPCODE(LD_D_iIY_NN) { D = RdByte(IY + (char)RdByte(PC++)); }
+OPCODE(LD_D_iXY_NN) { PC++; D = RdByte(XY + (char)NN); }
 #endif
 
 /* 8-bit load to the E register. */
@@ -541,16 +885,13 @@ OPCODE(LD_E_E) { E = E; }
 OPCODE(LD_E_H) { E = H; }
 OPCODE(LD_E_L) { E = L; }
 #ifdef Z80
-OPCODE(LD_E_IXH) { E = IX_H; }
-OPCODE(LD_E_IXL) { E = IX_L; }
-OPCODE(LD_E_IYH) { E = IY_H; }
-OPCODE(LD_E_IYL) { E = IY_L; }
+OPCODE(LD_E_XYH) { E = XY_H; }
+OPCODE(LD_E_XYL) { E = XY_L; }
 #endif
-OPCODE(LD_E_NN) { E = RdByte(PC++); }
+OPCODE(LD_E_NN) { PC++; E = NN; }
 OPCODE(LD_E_iHL) { E = RdByte(HL); }
 #ifdef Z80
-OPCODE(LD_E_iIX_NN) { E = RdByte(IX + (char)RdByte(PC++)); }
-OPCODE(LD_E_iIY_NN) { E = RdByte(IY + (char)RdByte(PC++)); }
+OPCODE(LD_E_iXY_NN) { PC++; E = RdByte(XY + (char)NN); }
 #endif
 
 /* 8-bit load to the H register. */
@@ -561,11 +902,10 @@ OPCODE(LD_H_D) { H = D; }
 OPCODE(LD_H_E) { H = E; }
 OPCODE(LD_H_H) { H = H; }
 OPCODE(LD_H_L) { H = L; }
-OPCODE(LD_H_NN) { H = RdByte(PC++); }
+OPCODE(LD_H_NN) { PC++; H = NN; }
 OPCODE(LD_H_iHL) { H = RdByte(HL); }
 #ifdef Z80
-OPCODE(LD_H_iIX_NN) { H = RdByte(IX + (char)RdByte(PC++)); }
-OPCODE(LD_H_iIY_NN) { H = RdByte(IY + (char)RdByte(PC++)); }
+OPCODE(LD_H_iXY_NN) { PC++; H = RdByte(XY + (char)NN); }
 #endif
 
 OPCODE(LD_L_A) { L = A; }
@@ -575,67 +915,34 @@ OPCODE(LD_L_D) { L = D; }
 OPCODE(LD_L_E) { L = E; }
 OPCODE(LD_L_H) { L = H; }
 OPCODE(LD_L_L) { L = L; }
-OPCODE(LD_L_NN) { L = RdByte(PC++); }
+OPCODE(LD_L_NN) { PC++; L = NN; }
 OPCODE(LD_L_iHL) { L = RdByte(HL); }
 #ifdef Z80
-OPCODE(LD_L_iIX_NN) { L = RdByte(IX + (char)RdByte(PC++)); }
-OPCODE(LD_L_iIY_NN) { L = RdByte(IY + (char)RdByte(PC++)); }
-#endif
-
-/* 8-bit load to the IXH register. */
-#ifdef Z80
-OPCODE(LD_IXH_A) { IX_H = A; }
-OPCODE(LD_IXH_B) { IX_H = B; }
-OPCODE(LD_IXH_C) { IX_H = C; }
-OPCODE(LD_IXH_D) { IX_H = D; }
-OPCODE(LD_IXH_E) { IX_H = E; }
-OPCODE(LD_IXH_IXH) { IX_H = IX_H; }
-OPCODE(LD_IXH_IXL) { IX_H = IX_L; }
-OPCODE(LD_IXH_IYH) { IX_H = IY_H; }
-OPCODE(LD_IXH_IYL) { IX_H = IY_L; }
-OPCODE(LD_IXH_NN) { IX_H = RdByte(PC++); }
-#endif
-
-/* 8-bit load to the IXL register. */
-#ifdef Z80
-OPCODE(LD_IXL_A) { IX_L = A; }
-OPCODE(LD_IXL_B) { IX_L = B; }
-OPCODE(LD_IXL_C) { IX_L = C; }
-OPCODE(LD_IXL_D) { IX_L = D; }
-OPCODE(LD_IXL_E) { IX_L = E; }
-OPCODE(LD_IXL_IXH) { IX_L = IX_H; }
-OPCODE(LD_IXL_IXL) { IX_L = IX_L; }
-OPCODE(LD_IXL_IYH) { IX_L = IY_H; }
-OPCODE(LD_IXL_IYL) { IX_L = IY_L; }
-OPCODE(LD_IXL_NN) { IX_L = RdByte(PC++); }
+OPCODE(LD_L_iXY_NN) { PC++; L = RdByte(XY + (char)NN); }
 #endif
 
-/* 8-bit load to the IYH register. */
+/* 8-bit load to the IXH or IYH register. */
 #ifdef Z80
-OPCODE(LD_IYH_A) { IY_H = A; }
-OPCODE(LD_IYH_B) { IY_H = B; }
-OPCODE(LD_IYH_C) { IY_H = C; }
-OPCODE(LD_IYH_D) { IY_H = D; }
-OPCODE(LD_IYH_E) { IY_H = E; }
-OPCODE(LD_IYH_IXH) { IY_H = IX_H; }
-OPCODE(LD_IYH_IXL) { IY_H = IX_L; }
-OPCODE(LD_IYH_IYH) { IY_H = IY_H; }
-OPCODE(LD_IYH_IYL) { IY_H = IY_L; }
-OPCODE(LD_IYH_NN) { IY_H = RdByte(PC++); }
+OPCODE(LD_XYH_A) { XY_H = A; }
+OPCODE(LD_XYH_B) { XY_H = B; }
+OPCODE(LD_XYH_C) { XY_H = C; }
+OPCODE(LD_XYH_D) { XY_H = D; }
+OPCODE(LD_XYH_E) { XY_H = E; }
+OPCODE(LD_XYH_XYH) { XY_H = XY_H; }
+OPCODE(LD_XYH_XYL) { XY_H = XY_L; }
+OPCODE(LD_XYH_NN) { PC++; XY_H = NN; }
 #endif
 
-/* 8-bit load to the IYL register. */
+/* 8-bit load to the IXL or IYL register. */
 #ifdef Z80
-OPCODE(LD_IYL_A) { IY_L = A; }
-OPCODE(LD_IYL_B) { IY_L = B; }
-OPCODE(LD_IYL_C) { IY_L = C; }
-OPCODE(LD_IYL_D) { IY_L = D; }
-OPCODE(LD_IYL_E) { IY_L = E; }
-OPCODE(LD_IYL_IXH) { IY_L = IX_H; }
-OPCODE(LD_IYL_IXL) { IY_L = IX_L; }
-OPCODE(LD_IYL_IYH) { IY_L = IY_H; }
-OPCODE(LD_IYL_IYL) { IY_L = IY_L; }
-OPCODE(LD_IYL_NN) { IY_L = RdByte(PC++); }
+OPCODE(LD_XYL_A) { XY_L = A; }
+OPCODE(LD_XYL_B) { XY_L = B; }
+OPCODE(LD_XYL_C) { XY_L = C; }
+OPCODE(LD_XYL_D) { XY_L = D; }
+OPCODE(LD_XYL_E) { XY_L = E; }
+OPCODE(LD_XYL_XYH) { XY_L = XY_H; }
+OPCODE(LD_XYL_XYL) { XY_L = XY_L; }
+OPCODE(LD_XYL_NN) { PC++; XY_L = NN; }
 #endif
 
 /* 8-bit indirect load to iBC. */
@@ -652,82 +959,60 @@ OPCODE(LD_iHL_D) { WrByte(HL, D); }
 OPCODE(LD_iHL_E) { WrByte(HL, E); }
 OPCODE(LD_iHL_H) { WrByte(HL, H); }
 OPCODE(LD_iHL_L) { WrByte(HL, L); }
-OPCODE(LD_iHL_NN) { WrByte(HL, RdByte(PC++)); }
-
-/* 8-bit indirect load to iIX+NN. */
-#ifdef Z80
-OPCODE(LD_iIX_NN_A) { WrByte(IX + (char)RdByte(PC++), A); }
-OPCODE(LD_iIX_NN_B) { WrByte(IX + (char)RdByte(PC++), B); }
-OPCODE(LD_iIX_NN_C) { WrByte(IX + (char)RdByte(PC++), C); }
-OPCODE(LD_iIX_NN_D) { WrByte(IX + (char)RdByte(PC++), D); }
-OPCODE(LD_iIX_NN_E) { WrByte(IX + (char)RdByte(PC++), E); }
-OPCODE(LD_iIX_NN_H) { WrByte(IX + (char)RdByte(PC++), H); }
-OPCODE(LD_iIX_NN_L) { WrByte(IX + (char)RdByte(PC++), L); }
-OPCODE(LD_iIX_NN_NN)
-{
-	WrByte(IX + (char)RdByte(PC + 0), RdByte(PC + 1));
-	PC += 2;
-}
-#endif
+OPCODE(LD_iHL_NN) { PC++; WrByte(HL, NN); }
 
-/* 8-bit indirect load to iIY+NN. */
+/* 8-bit indirect load to iIX+NN or iIY+NN. */
 #ifdef Z80
-OPCODE(LD_iIY_NN_B) { WrByte(IY + (char)RdByte(PC++), B); }
-OPCODE(LD_iIY_NN_C) { WrByte(IY + (char)RdByte(PC++), C); }
-OPCODE(LD_iIY_NN_D) { WrByte(IY + (char)RdByte(PC++), D); }
-OPCODE(LD_iIY_NN_E) { WrByte(IY + (char)RdByte(PC++), E); }
-OPCODE(LD_iIY_NN_H) { WrByte(IY + (char)RdByte(PC++), H); }
-OPCODE(LD_iIY_NN_L) { WrByte(IY + (char)RdByte(PC++), L); }
-OPCODE(LD_iIY_NN_A) { WrByte(IY + (char)RdByte(PC++), A); }
-OPCODE(LD_iIY_NN_NN)
+OPCODE(LD_iXY_NN_A) { PC++; WrByte(XY + (char)NN, A); }
+OPCODE(LD_iXY_NN_B) { PC++; WrByte(XY + (char)NN, B); }
+OPCODE(LD_iXY_NN_C) { PC++; WrByte(XY + (char)NN, C); }
+OPCODE(LD_iXY_NN_D) { PC++; WrByte(XY + (char)NN, D); }
+OPCODE(LD_iXY_NN_E) { PC++; WrByte(XY + (char)NN, E); }
+OPCODE(LD_iXY_NN_H) { PC++; WrByte(XY + (char)NN, H); }
+OPCODE(LD_iXY_NN_L) { PC++; WrByte(XY + (char)NN, L); }
+OPCODE(LD_iXY_NN_NN)
 {
-	WrByte(IY + (char)RdByte(PC + 0), RdByte(PC + 1));
 	PC += 2;
+	WrByte(XY + (char)NN, NN2);
 }
 #endif
 
 /* 8-bit indirect load to iNNNN. */
-OPCODE(LD_iNNNN_A)
-{
-	WordBytes x;
-	X_L = RdByte(PC++);
-	X_H = RdByte(PC++);
-	WrByte(X, A);
-}
+OPCODE(LD_iNNNN_A) { PC += 2; WrByte(NNNN, A); }
 
 /* 16-bit load to the BC register. */
-OPCODE(LD_BC_NNNN) { C = RdByte(PC++); B = RdByte(PC++); }
+OPCODE(LD_BC_NNNN) { PC += 2; BC = NNNN; }
 #ifdef Z80
 OPCODE(LD_BC_iNNNN)
 {
 	WordBytes x;
-	X_L = RdByte(PC++);
-	X_H = RdByte(PC++);
+	PC += 2;
+	X = NNNN;
 	C = RdByte(X);
 	B = RdByte(X + 1);
 }
 #endif
 
 /* 16-bit load to the DE register. */
-OPCODE(LD_DE_NNNN) { E = RdByte(PC++); D = RdByte(PC++); }
+OPCODE(LD_DE_NNNN) { PC += 2; DE = NNNN; }
 #ifdef Z80
 OPCODE(LD_DE_iNNNN)
 {
 	WordBytes x;
-	X_L = RdByte(PC++);
-	X_H = RdByte(PC++);
+	PC += 2;
+	X = NNNN;
 	E = RdByte(X);
 	D = RdByte(X + 1);
 }
 #endif
 
 /* 16-bit load to the HL register. */
-OPCODE(LD_HL_NNNN) { L = RdByte(PC++); H = RdByte(PC++); }
+OPCODE(LD_HL_NNNN) { PC += 2; HL = NNNN; }
 OPCODE(LD_HL_iNNNN)
 {
 	WordBytes x;
-	X_L = RdByte(PC++);
-	X_H = RdByte(PC++);
+	PC += 2;
+	X = NNNN;
 	L = RdByte(X);
 	H = RdByte(X + 1);
 }
@@ -735,44 +1020,32 @@ OPCODE(LD_HL_iNNNN)
 /* 16-bit load to the SP register. */
 OPCODE(LD_SP_HL) { SP = HL; }
 #ifdef Z80
-OPCODE(LD_SP_IX) { SP = IX; }
-OPCODE(LD_SP_IY) { SP = IY; }
+OPCODE(LD_SP_XY) { SP = XY; }
 #endif
-OPCODE(LD_SP_NNNN) { SP_L = RdByte(PC++); SP_H = RdByte(PC++); }
+OPCODE(LD_SP_NNNN) { PC += 2; SP = NNNN; }
 #ifdef Z80
 OPCODE(LD_SP_iNNNN)
 {
 	WordBytes x;
-	X_L = RdByte(PC++);
-	X_H = RdByte(PC++);
-	SP_L = RdByte(X);
-	SP_H = RdByte(X + 1);
-}
-#endif
-
-/* 16-bit load to the IX register. */
-#ifdef Z80
-OPCODE(LD_IX_NNNN) { IX_L = RdByte(PC++); IX_H = RdByte(PC++); }
-OPCODE(LD_IX_iNNNN)
-{
-	WordBytes x;
-	X_L = RdByte(PC++);
-	X_H = RdByte(PC++);
-	IX_L = RdByte(X);
-	IX_H = RdByte(X + 1);
+	WordBytes y;
+	PC += 2;
+	X = NNNN;
+	Y_L = RdByte(X);
+	Y_H = RdByte(X + 1);
+	SP = Y;
 }
 #endif
 
-/* 16-bit load to the IY register. */
+/* 16-bit load to the IX or IY register. */
 #ifdef Z80
-OPCODE(LD_IY_NNNN) { IY_L = RdByte(PC++); IY_H = RdByte(PC++); }
-OPCODE(LD_IY_iNNNN)
+OPCODE(LD_XY_NNNN) { PC += 2; XY = NNNN; }
+OPCODE(LD_XY_iNNNN)
 {
 	WordBytes x;
-	X_L = RdByte(PC++);
-	X_H = RdByte(PC++);
-	IY_L = RdByte(X);
-	IY_H = RdByte(X + 1);
+	PC += 2;
+	X = NNNN;
+	XY_L = RdByte(X);
+	XY_H = RdByte(X + 1);
 }
 #endif
 
@@ -781,16 +1054,16 @@ OPCODE(LD_IY_iNNNN)
 OPCODE(LD_iNNNN_BC)
 {
 	WordBytes x;
-	X_L = RdByte(PC++);
-	X_H = RdByte(PC++);
+	PC += 2;
+	X = NNNN;
 	WrByte(X, C);
 	WrByte(X + 1, B);
 }
 OPCODE(LD_iNNNN_DE)
 {
 	WordBytes x;
-	X_L = RdByte(PC++);
-	X_H = RdByte(PC++);
+	PC += 2;
+	X = NNNN;
 	WrByte(X, E);
 	WrByte(X + 1, D);
 }
@@ -798,8 +1071,8 @@ OPCODE(LD_iNNNN_DE)
 OPCODE(LD_iNNNN_HL)
 {
 	WordBytes x;
-	X_L = RdByte(PC++);
-	X_H = RdByte(PC++);
+	PC += 2;
+	X = NNNN;
 	WrByte(X, L);
 	WrByte(X + 1, H);
 }
@@ -807,30 +1080,109 @@ OPCODE(LD_iNNNN_HL)
 OPCODE(LD_iNNNN_SP)
 {
 	WordBytes x;
-	X_L = RdByte(PC++);
-	X_H = RdByte(PC++);
+	PC += 2;
+	X = NNNN;
 	WrByte(X, SP_L);
 	WrByte(X + 1, SP_H);
 }
-OPCODE(LD_iNNNN_IX)
+OPCODE(LD_iNNNN_XY)
 {
 	WordBytes x;
-	X_L = RdByte(PC++);
-	X_H = RdByte(PC++);
-	WrByte(X, IX_L);
-	WrByte(X + 1, IX_H);
+	PC += 2;
+	X = NNNN;
+	WrByte(X, XY_L);
+	WrByte(X + 1, XY_H);
 }
-OPCODE(LD_iNNNN_IY)
+#endif
+
+#ifdef Z80
+
+/* MoveSpan() moves size bytes within host memory. Moving one at a
+ * time upward (step 1) or downward (step -1), a destination that
+ * overlaps the source ahead of it repeats the bytes already moved,
+ * so that case is moved gap bytes at a time; otherwise it is memmove().
+ */
+static void MoveSpan(Byte *destination, Byte *source, Word size, int step)
 {
-	WordBytes x;
-	X_L = RdByte(PC++);
-	X_H = RdByte(PC++);
-	WrByte(X, IY_L);
-	WrByte(X + 1, IY_H);
+	Word gap;
+	Word n;
+	Word i;
+
+	if ((step > 0) && (destination > source) &&
+	    (destination - source < size)) {
+		gap = (Word)(destination - source);
+		for (i = 0; i < size; i += n) {
+			n = (size - i < gap) ? size - i : gap;
+			memcpy(destination + i, source + i, n);
+		}
+	}
+
+	else if ((step < 0) && (source > destination) &&
+	         (source - destination < size)) {
+		gap = (Word)(source - destination);
+		for (i = size; i > 0; i -= n) {
+			n = (i < gap) ? i : gap;
+			memcpy(destination + i - n, source + i - n, n);
+		}
+	}
+
+	else
+		memmove(destination, source, size);
+
 }
+
+/* BlockMove() moves count bytes (BC, 0 is 65536) from HL to DE,
+ * stepping up or down, one bank span at a time, and returns the last
+ * byte moved. It leaves HL, DE and BC as LDIR or LDDR would. A
+ * watched bank (see WATCHPOINTS) has no spans, its bytes are moved
+ * one at a time, as are all bytes while the undo log (see REVERSE)
+ * is armed.
+ */
+static INLINE Byte BlockMove(CACHE_ unsigned long count, int step)
+{
+	Word size;
+	Word low;
+	Byte value = 0;
+
+	while (count > 0) {
+#if defined(WATCHPOINTS) || defined(REVERSE)
+		if ((RdSpan(HL) == 0) || (WrSpan(DE) == 0)) {
+			WrByte(DE, value = RdByte(HL));
+			HL += step;
+			DE += step;
+			count--;
+			continue;
+		}
 #endif
+		if (step > 0) {
+			size = BankTail(HL);
+			if (size > BankTail(DE))
+				size = BankTail(DE);
+		}
+		else {
+			size = BankHead(HL);
+			if (size > BankHead(DE))
+				size = BankHead(DE);
+		}
+		if (size > count)
+			size = (Word)count;
+		low = (step > 0) ? DE : (Word)(DE - size + 1);
+		MoveSpan(WrSpan(low),
+		         RdSpan((step > 0) ? HL : (Word)(HL - size + 1)),
+		         size,
+		         step);
+		value = *WrSpan((step > 0) ? (Word)(DE + size - 1) : low);
+		WrittenSpan(low, size);
+		HL += (step > 0) ? size : -size;
+		DE += (step > 0) ? size : -size;
+		count -= size;
+	}
 
-#ifdef Z80
+	BC = 0;
+
+	return value;
+
+}
 
 /* Move bytes, increment pointer. */
 /* DE = destination pointer */
@@ -854,8 +1206,8 @@ OPCODE(LDI)
 OPCODE(LDIR)
 {
 	unsigned long result;
-	do WrByte(DE++, result = RdByte(HL++));
-	while (--BC != 0);
+	CYCLES += kRepeatTaken * (Word)(BC - 1);
+	result = BlockMove(CACHED_ BC ? BC : 0x10000, 1);
 	result += A;
 	F = (F & (SIGN | ZERO | CARRY)) |
 	    (result & MAGIC1) |
@@ -884,8 +1236,8 @@ OPCODE(LDD)
 OPCODE(LDDR)
 {
 	unsigned long result;
-	do WrByte(DE--, result = RdByte(HL--));
-	while (--BC != 0);
+	CYCLES += kRepeatTaken * (Word)(BC - 1);
+	result = BlockMove(CACHED_ BC ? BC : 0x10000, -1);
 	result += A;
 	F = (F & (SIGN | ZERO | CARRY)) |
 	    (result & MAGIC1) |
@@ -919,27 +1271,15 @@ OPCODE(EX_iSP_HL)
 
 #ifdef Z80
 
-/* Exchange IX register with top of stack. */
-OPCODE(EX_iSP_IX)
-{
-	WordBytes x;
-	X_L = RdByte(SP);
-	WrByte(SP, IX_L);
-	X_H = RdByte(SP + 1);
-	WrByte(SP + 1, IX_H);
-	IX = X;
-
-}
-
-/* Exchange IY register with top of stack. */
-OPCODE(EX_iSP_IY)
+/* Exchange IX or IY register with top of stack. */
+OPCODE(EX_iSP_XY)
 {
 	WordBytes x;
 	X_L = RdByte(SP);
-	WrByte(SP, IY_L);
+	WrByte(SP, XY_L);
 	X_H = RdByte(SP + 1);
-	WrByte(SP + 1, IY_H);
-	IY = X;
+	WrByte(SP + 1, XY_H);
+	XY = X;
 
 }
 
@@ -1050,35 +1390,26 @@ OPCODE(CCF)
 
 /* 8-bit increment */
 
-static inline void _INC(Byte *bytePtr)
+static INLINE void _INC(CACHE_ Byte *bytePtr)
 {
-	F = (F & ~(SUBTRACT |
-	           OVERFLOW |
-	           HALFCARRY |
-	           ZERO |
-	           SIGN |
-	           MAGIC1 |
-	           MAGIC2)) |
-	    gSignZeroMagic2HalfCarryMagic1Overflow[++(*bytePtr)];
+	Word carry = CARRY_FLAG << 8;
+	SET_FLAGS(kFlagsIncrement, 0, 0, ++(*bytePtr) | carry);
 }
 
-OPCODE(INC_A) { _INC(&A); }
-OPCODE(INC_B) { _INC(&B); }
-OPCODE(INC_C) { _INC(&C); }
-OPCODE(INC_D) { _INC(&D); }
-OPCODE(INC_E) { _INC(&E); }
-OPCODE(INC_H) { _INC(&H); }
-OPCODE(INC_L) { _INC(&L); }
+OPCODE(INC_A) { _INC(CACHED_ &A); }
+OPCODE(INC_B) { _INC(CACHED_ &B); }
+OPCODE(INC_C) { _INC(CACHED_ &C); }
+OPCODE(INC_D) { _INC(CACHED_ &D); }
+OPCODE(INC_E) { _INC(CACHED_ &E); }
+OPCODE(INC_H) { _INC(CACHED_ &H); }
+OPCODE(INC_L) { _INC(CACHED_ &L); }
 #ifdef Z80
-OPCODE(INC_IXH) { _INC(&IX_H); }
-OPCODE(INC_IXL) { _INC(&IX_L); }
-OPCODE(INC_IYH) { _INC(&IY_H); }
-OPCODE(INC_IYL) { _INC(&IY_L); }
+OPCODE(INC_XYH) { _INC(CACHED_ &XY_H); }
+OPCODE(INC_XYL) { _INC(CACHED_ &XY_L); }
 #endif
-OPCODE(INC_iHL) { _INC(RwByte(HL)); }
+OPCODE(INC_iHL) { _INC(CACHED_ RwByte(HL)); }
 #ifdef Z80
-OPCODE(INC_iIX_NN) { _INC(RwByte(IX + (char)RdByte(PC++))); }
-OPCODE(INC_iIY_NN) { _INC(RwByte(IY + (char)RdByte(PC++))); }
+OPCODE(INC_iXY_NN) { PC++; _INC(CACHED_ RwByte(XY + (char)NN)); }
 #endif
 
 /* 16-bit increment. */
@@ -1088,41 +1419,31 @@ OPCODE(INC_DE) { DE++; }
 OPCODE(INC_HL) { HL++; }
 OPCODE(INC_SP) { SP++; }
 #ifdef Z80
-OPCODE(INC_IX) { IX++; }
-OPCODE(INC_IY) { IY++; }
+OPCODE(INC_XY) { XY++; }
 #endif
 
 /* 8-bit decrement. */
 
-static inline void _DEC(Byte *bytePtr)
+static INLINE void _DEC(CACHE_ Byte *bytePtr)
 {
-	F = (F & ~(SUBTRACT |
-	           OVERFLOW |
-	           HALFCARRY |
-	           ZERO |
-	           SIGN |
-	           MAGIC1 |
-	           MAGIC2)) |
-	     gSignZeroMagic2HalfCarryMagic1OverflowSubtract[--(*bytePtr)];
+	Word carry = CARRY_FLAG << 8;
+	SET_FLAGS(kFlagsDecrement, 0, 0, --(*bytePtr) | carry);
 }
 
-OPCODE(DEC_A) { _DEC(&A); }
-OPCODE(DEC_B) { _DEC(&B); }
-OPCODE(DEC_C) { _DEC(&C); }
-OPCODE(DEC_D) { _DEC(&D); }
-OPCODE(DEC_E) { _DEC(&E); }
-OPCODE(DEC_H) { _DEC(&H); }
-OPCODE(DEC_L) { _DEC(&L); }
+OPCODE(DEC_A) { _DEC(CACHED_ &A); }
+OPCODE(DEC_B) { _DEC(CACHED_ &B); }
+OPCODE(DEC_C) { _DEC(CACHED_ &C); }
+OPCODE(DEC_D) { _DEC(CACHED_ &D); }
+OPCODE(DEC_E) { _DEC(CACHED_ &E); }
+OPCODE(DEC_H) { _DEC(CACHED_ &H); }
+OPCODE(DEC_L) { _DEC(CACHED_ &L); }
 #ifdef Z80
-OPCODE(DEC_IXH) { _DEC(&IX_H); }
-OPCODE(DEC_IXL) { _DEC(&IX_L); }
-OPCODE(DEC_IYH) { _DEC(&IY_H); }
-OPCODE(DEC_IYL) { _DEC(&IY_L); }
+OPCODE(DEC_XYH) { _DEC(CACHED_ &XY_H); }
+OPCODE(DEC_XYL) { _DEC(CACHED_ &XY_L); }
 #endif
-OPCODE(DEC_iHL){ _DEC(RwByte(HL)); }
+OPCODE(DEC_iHL){ _DEC(CACHED_ RwByte(HL)); }
 #ifdef Z80
-OPCODE(DEC_iIX_NN) { _DEC(RwByte(IX + (char)RdByte(PC++))); }
-OPCODE(DEC_iIY_NN) { _DEC(RwByte(IY + (char)RdByte(PC++))); }
+OPCODE(DEC_iXY_NN) { PC++; _DEC(CACHED_ RwByte(XY + (char)NN)); }
 #endif
 
 /* 16-bit decrement. */
@@ -1132,8 +1453,7 @@ OPCODE(DEC_DE) { DE--; }
 OPCODE(DEC_HL) { HL--; }
 OPCODE(DEC_SP) { SP--; }
 #ifdef Z80
-OPCODE(DEC_IX) { IX--; }
-OPCODE(DEC_IY) { IY--; }
+OPCODE(DEC_XY) { XY--; }
 #endif
 
 /**********************************************************************/
@@ -1141,57 +1461,55 @@ OPCODE(DEC_IY) { IY--; }
 
 /* Jump to absolute address. */
 
-static inline void _JP(Byte flag)
+static INLINE void _JP(CACHE_ Word address, Byte flag)
 {
-	WordBytes x;
-	X_L = RdByte(PC++);
-	X_H = RdByte(PC++);
+	PC += 2;
 	if (flag != 0)
-		PC = X;
+		PC = address;
 }
 
-OPCODE(JP_NNNN) { _JP(1); }
-OPCODE(JP_NZ_NNNN) { _JP(!ZERO_FLAG); }
-OPCODE(JP_Z_NNNN) { _JP(ZERO_FLAG); }
-OPCODE(JP_NC_NNNN) {  _JP(!CARRY_FLAG); }
-OPCODE(JP_C_NNNN) { _JP(CARRY_FLAG); }
-OPCODE(JP_PO_NNNN) { _JP(!PARITY_FLAG); }
-OPCODE(JP_PE_NNNN) { _JP(PARITY_FLAG); }
-OPCODE(JP_P_NNNN) { _JP(!SIGN_FLAG); }
-OPCODE(JP_M_NNNN) { _JP(SIGN_FLAG); }
+OPCODE(JP_NNNN) { _JP(CACHED_ NNNN, 1); }
+OPCODE(JP_NZ_NNNN) { _JP(CACHED_ NNNN, !ZERO_FLAG); }
+OPCODE(JP_Z_NNNN) { _JP(CACHED_ NNNN, ZERO_FLAG); }
+OPCODE(JP_NC_NNNN) {  _JP(CACHED_ NNNN, !CARRY_FLAG); }
+OPCODE(JP_C_NNNN) { _JP(CACHED_ NNNN, CARRY_FLAG); }
+OPCODE(JP_PO_NNNN) { _JP(CACHED_ NNNN, !PARITY_FLAG); }
+OPCODE(JP_PE_NNNN) { _JP(CACHED_ NNNN, PARITY_FLAG); }
+OPCODE(JP_P_NNNN) { _JP(CACHED_ NNNN, !SIGN_FLAG); }
+OPCODE(JP_M_NNNN) { _JP(CACHED_ NNNN, SIGN_FLAG); }
 
 /* Jump to indirect address. */
 
 OPCODE(JP_iHL) { PC = HL; }
 #ifdef Z80
-OPCODE(JP_iIX) { PC = IX; }
-OPCODE(JP_iIY) { PC = IY; }
+OPCODE(JP_iXY) { PC = XY; }
 #endif
 
 /* Jump to PC-relative address. */
 
 #ifdef Z80
 
-static inline void _JR(Byte flag)
+static INLINE void _JR(CACHE_ Byte offset, Byte flag, Byte cycles)
 {
-	WordBytes x;
-	X_L = RdByte(PC++);
-	if (flag)
-		PC += (char)X_L;
+	PC++;
+	if (flag) {
+		PC += (char)offset;
+		CYCLES += cycles;
+	}
 }
 
-OPCODE(JR_NN) { _JR(1); }
-OPCODE(JR_NZ_NN) { _JR(!ZERO_FLAG); }
-OPCODE(JR_Z_NN) { _JR(ZERO_FLAG); }
-OPCODE(JR_NC_NN) { _JR(!CARRY_FLAG); }
-OPCODE(JR_C_NN) { _JR(CARRY_FLAG); }
+OPCODE(JR_NN) { _JR(CACHED_ NN, 1, 0); }
+OPCODE(JR_NZ_NN) { _JR(CACHED_ NN, !ZERO_FLAG, kJumpTaken); }
+OPCODE(JR_Z_NN) { _JR(CACHED_ NN, ZERO_FLAG, kJumpTaken); }
+OPCODE(JR_NC_NN) { _JR(CACHED_ NN, !CARRY_FLAG, kJumpTaken); }
+OPCODE(JR_C_NN) { _JR(CACHED_ NN, CARRY_FLAG, kJumpTaken); }
 
 #endif
 
 /* Decrement and jump to PC-relative address if zero. */
 /* BC = counter */
 #ifdef Z80
-OPCODE(DJNZ_NN) { _JR(--B); }
+OPCODE(DJNZ_NN) { _JR(CACHED_ NN, --B, kJumpTaken); }
 #endif
 
 /**********************************************************************/
@@ -1204,8 +1522,7 @@ OPCODE(PUSH_BC) { WrByte(--SP, B); WrByte(--SP, C); }
 OPCODE(PUSH_DE) { WrByte(--SP, D); WrByte(--SP, E); }
 OPCODE(PUSH_HL) { WrByte(--SP, H); WrByte(--SP, L); }
 #ifdef Z80
-OPCODE(PUSH_IX) { WrByte(--SP, IX_H); WrByte(--SP, IX_L); }
-OPCODE(PUSH_IY) { WrByte(--SP, IY_H); WrByte(--SP, IY_L); }
+OPCODE(PUSH_XY) { WrByte(--SP, XY_H); WrByte(--SP, XY_L); }
 #endif
 
 /* Pop a 16-bit register value from the stack. */
@@ -1215,8 +1532,7 @@ OPCODE(POP_BC) { C = RdByte(SP++); B = RdByte(SP++); }
 OPCODE(POP_DE) { E = RdByte(SP++); D = RdByte(SP++); }
 OPCODE(POP_HL) { L = RdByte(SP++); H = RdByte(SP++); }
 #ifdef Z80
-OPCODE(POP_IX) { IX_L = RdByte(SP++); IX_H = RdByte(SP++); }
-OPCODE(POP_IY) { IY_L = RdByte(SP++); IY_H = RdByte(SP++); }
+OPCODE(POP_XY) { XY_L = RdByte(SP++); XY_H = RdByte(SP++); }
 #endif
 
 /**********************************************************************/
@@ -1224,59 +1540,60 @@ OPCODE(POP_IY) { IY_L = RdByte(SP++); IY_H = RdByte(SP++); }
 
 /* Subroutine CALL. */
 
-static inline void _CALL(Byte flag)
+static INLINE void _CALL(CACHE_ Word address, Byte flag, Byte cycles)
 {
-	WordBytes x;
-	X_L = RdByte(PC++);
-	X_H = RdByte(PC++);
+	PC += 2;
 	if (flag != 0) {
 		WrByte(--SP, PC_H);
 		WrByte(--SP, PC_L);
-		PC = X;
+		PC = address;
+		CYCLES += cycles;
 	}
 }
 
-OPCODE(CALL_NNNN) { _CALL(1); }
-OPCODE(CALL_NZ_NNNN) { _CALL(!ZERO_FLAG); }
-OPCODE(CALL_Z_NNNN) { _CALL(ZERO_FLAG); }
-OPCODE(CALL_NC_NNNN) { _CALL(!CARRY_FLAG); }
-OPCODE(CALL_C_NNNN) { _CALL(CARRY_FLAG); }
-OPCODE(CALL_PO_NNNN) { _CALL(!PARITY_FLAG); }
-OPCODE(CALL_PE_NNNN) { _CALL(PARITY_FLAG); }
-OPCODE(CALL_P_NNNN) { _CALL(!SIGN_FLAG); }
-OPCODE(CALL_M_NNNN) { _CALL(SIGN_FLAG); }
+OPCODE(CALL_NNNN) { _CALL(CACHED_ NNNN, 1, 0); }
+OPCODE(CALL_NZ_NNNN) { _CALL(CACHED_ NNNN, !ZERO_FLAG, kCallTaken); }
+OPCODE(CALL_Z_NNNN) { _CALL(CACHED_ NNNN, ZERO_FLAG, kCallTaken); }
+OPCODE(CALL_NC_NNNN) { _CALL(CACHED_ NNNN, !CARRY_FLAG, kCallTaken); }
+OPCODE(CALL_C_NNNN) { _CALL(CACHED_ NNNN, CARRY_FLAG, kCallTaken); }
+OPCODE(CALL_PO_NNNN) { _CALL(CACHED_ NNNN, !PARITY_FLAG, kCallTaken); }
+OPCODE(CALL_PE_NNNN) { _CALL(CACHED_ NNNN, PARITY_FLAG, kCallTaken); }
+OPCODE(CALL_P_NNNN) { _CALL(CACHED_ NNNN, !SIGN_FLAG, kCallTaken); }
+OPCODE(CALL_M_NNNN) { _CALL(CACHED_ NNNN, SIGN_FLAG, kCallTaken); }
 
 /* Subroutine RETURN. */
 
-static inline void _RET(Byte flag)
+static INLINE void _RET(CACHE_ Byte flag, Byte cycles)
 {
 	WordBytes x;
 	if (flag != 0) {
 		X_L = RdByte(SP++);
 		X_H = RdByte(SP++);
 		PC = X;
+		CYCLES += cycles;
 	}
 }
 
-OPCODE(RET) { _RET(1); }
-OPCODE(RET_NZ) { _RET(!ZERO_FLAG); }
-OPCODE(RET_Z) { _RET(ZERO_FLAG); }
-OPCODE(RET_NC) { _RET(!CARRY_FLAG); }
-OPCODE(RET_C) { _RET(CARRY_FLAG); }
-OPCODE(RET_PO) { _RET(!PARITY_FLAG); }
-OPCODE(RET_PE) { _RET(PARITY_FLAG); }
-OPCODE(RET_P) { _RET(!SIGN_FLAG); }
-OPCODE(RET_M) { _RET(SIGN_FLAG); }
+OPCODE(RET) { _RET(CACHED_ 1, 0); }
+OPCODE(RET_NZ) { _RET(CACHED_ !ZERO_FLAG, kReturnTaken); }
+OPCODE(RET_Z) { _RET(CACHED_ ZERO_FLAG, kReturnTaken); }
+OPCODE(RET_NC) { _RET(CACHED_ !CARRY_FLAG, kReturnTaken); }
+OPCODE(RET_C) { _RET(CACHED_ CARRY_FLAG, kReturnTaken); }
+OPCODE(RET_PO) { _RET(CACHED_ !PARITY_FLAG, kReturnTaken); }
+OPCODE(RET_PE) { _RET(CACHED_ PARITY_FLAG, kReturnTaken); }
+OPCODE(RET_P) { _RET(CACHED_ !SIGN_FLAG, kReturnTaken); }
+OPCODE(RET_M) { _RET(CACHED_ SIGN_FLAG, kReturnTaken); }
 
 /* Special case to RETURN from interrupt handler. */
+/* RETN restores IFF1 as it was before the NMI. */
 #ifdef Z80
-OPCODE(RETN) { UOP2(); }
-OPCODE(RETI) { UOP2(); }
+OPCODE(RETN) { IFF1 = IFF2; UpdateINT(); _RET(CACHED_ 1, 0); }
+OPCODE(RETI) { IFF1 = IFF2; UpdateINT(); _RET(CACHED_ 1, 0); }
 #endif
 
 /* Restart to standard subroutine. */
 
-static inline void _RST(Word pc)
+static INLINE void _RST(CACHE_ Word pc)
 {
 
 	WrByte(--SP, PC_H);
@@ -1285,50 +1602,47 @@ static inline void _RST(Word pc)
 
 }
 
-OPCODE(RST_00) { _RST(0x0000); }
-OPCODE(RST_08) { _RST(0x0008); }
-OPCODE(RST_10) { _RST(0x0010); }
-OPCODE(RST_18) { _RST(0x0018); }
-OPCODE(RST_20) { _RST(0x0020); }
-OPCODE(RST_28) { _RST(0x0028); }
-OPCODE(RST_30) { _RST(0x0030); }
-OPCODE(RST_38) { _RST(0x0038); }
+OPCODE(RST_00) { _RST(CACHED_ 0x0000); }
+OPCODE(RST_08) { _RST(CACHED_ 0x0008); }
+OPCODE(RST_10) { _RST(CACHED_ 0x0010); }
+OPCODE(RST_18) { _RST(CACHED_ 0x0018); }
+OPCODE(RST_20) { _RST(CACHED_ 0x0020); }
+OPCODE(RST_28) { _RST(CACHED_ 0x0028); }
+OPCODE(RST_30) { _RST(CACHED_ 0x0030); }
+OPCODE(RST_38) { _RST(CACHED_ 0x0038); }
 
 /**********************************************************************/
 #pragma mark ADD, ADC
 
 /* 8-bit add. */
 
-static inline void _ADD(Byte value)
+static INLINE void _ADD(CACHE_ Byte value)
 {
 	unsigned long result = A + value;
-	Byte bits = gHalfCarryOverflowCarry[A ^ value ^ result];
-	F = gSignZeroMagic2Magic1[A = result] | bits;
+	SET_FLAGS(kFlagsAdd, A, value, result);
+	A = result;
 }
 
-OPCODE(ADD_A) { _ADD(A); }
-OPCODE(ADD_B) { _ADD(B); }
-OPCODE(ADD_C) { _ADD(C); }
-OPCODE(ADD_D) { _ADD(D); }
-OPCODE(ADD_E) { _ADD(E); }
-OPCODE(ADD_H) { _ADD(H); }
-OPCODE(ADD_L) { _ADD(L); }
+OPCODE(ADD_A) { _ADD(CACHED_ A); }
+OPCODE(ADD_B) { _ADD(CACHED_ B); }
+OPCODE(ADD_C) { _ADD(CACHED_ C); }
+OPCODE(ADD_D) { _ADD(CACHED_ D); }
+OPCODE(ADD_E) { _ADD(CACHED_ E); }
+OPCODE(ADD_H) { _ADD(CACHED_ H); }
+OPCODE(ADD_L) { _ADD(CACHED_ L); }
 #ifdef Z80
-OPCODE(ADD_IXH) { _ADD(IX_H); }
-OPCODE(ADD_IXL) { _ADD(IX_L); }
-OPCODE(ADD_IYH) { _ADD(IY_H); }
-OPCODE(ADD_IYL) { _ADD(IY_L); }
+OPCODE(ADD_XYH) { _ADD(CACHED_ XY_H); }
+OPCODE(ADD_XYL) { _ADD(CACHED_ XY_L); }
 #endif
-OPCODE(ADD_NN) { _ADD(RdByte(PC++)); }
-OPCODE(ADD_iHL) { _ADD(RdByte(HL)); }
+OPCODE(ADD_NN) { PC++; _ADD(CACHED_ NN); }
+OPCODE(ADD_iHL) { _ADD(CACHED_ RdByte(HL)); }
 #ifdef Z80
-OPCODE(ADD_iIX_NN) { _ADD(RdByte(IX + (char)RdByte(PC++))); }
-OPCODE(ADD_iIY_NN) { _ADD(RdByte(IY + (char)RdByte(PC++))); }
+OPCODE(ADD_iXY_NN) { PC++; _ADD(CACHED_ RdByte(XY + (char)NN)); }
 #endif
 
 /* 16-bit add. */
 
-static inline void _ADD_WORD(Word value)
+static INLINE void _ADD_WORD(CACHE_ Word value)
 {
 	unsigned long result = HL + value;
 	Byte bits = gHalfCarryCarry[(HL ^ value ^ result) >> 8];
@@ -1337,14 +1651,14 @@ static inline void _ADD_WORD(Word value)
 	F |= (H & (MAGIC1 | MAGIC2)) | bits;
 }
 
-OPCODE(ADD_HL_BC) { _ADD_WORD(BC); }
-OPCODE(ADD_HL_DE) { _ADD_WORD(DE); }
-OPCODE(ADD_HL_HL) { _ADD_WORD(HL); }
-OPCODE(ADD_HL_SP) { _ADD_WORD(SP); }
+OPCODE(ADD_HL_BC) { _ADD_WORD(CACHED_ BC); }
+OPCODE(ADD_HL_DE) { _ADD_WORD(CACHED_ DE); }
+OPCODE(ADD_HL_HL) { _ADD_WORD(CACHED_ HL); }
+OPCODE(ADD_HL_SP) { _ADD_WORD(CACHED_ SP); }
 
 #ifdef Z80
 
-static inline void _iADD_WORD(Word *x, Word value)
+static INLINE void _iADD_WORD(CACHE_ Word *x, Word value)
 {
 	unsigned long result = *x + value;
 	Byte bits = gHalfCarryCarry[(*x ^ value ^ result) >> 8];
@@ -1353,52 +1667,44 @@ static inline void _iADD_WORD(Word *x, Word value)
 	F |= ((result >> 8) & (MAGIC1 | MAGIC2)) | bits;
 }
 
-OPCODE(ADD_IX_BC) { _iADD_WORD(&IX, BC); }
-OPCODE(ADD_IX_DE) { _iADD_WORD(&IX, DE); }
-OPCODE(ADD_IX_IX) { _iADD_WORD(&IX, IX); }
-OPCODE(ADD_IX_SP) { _iADD_WORD(&IX, SP); }
-
-OPCODE(ADD_IY_BC) { _iADD_WORD(&IY, BC); }
-OPCODE(ADD_IY_DE) { _iADD_WORD(&IY, DE); }
-OPCODE(ADD_IY_IY) { _iADD_WORD(&IY, IY); }
-OPCODE(ADD_IY_SP) { _iADD_WORD(&IY, SP); }
+OPCODE(ADD_XY_BC) { _iADD_WORD(CACHED_ &XY, BC); }
+OPCODE(ADD_XY_DE) { _iADD_WORD(CACHED_ &XY, DE); }
+OPCODE(ADD_XY_XY) { _iADD_WORD(CACHED_ &XY, XY); }
+OPCODE(ADD_XY_SP) { _iADD_WORD(CACHED_ &XY, SP); }
 
 #endif
 
 /* 8-bit add with carry. */
 
-static inline void _ADC(Byte value)
+static INLINE void _ADC(CACHE_ Byte value)
 {
 	unsigned long result = A + value + CARRY_FLAG;
-	Byte bits = gHalfCarryOverflowCarry[A ^ value ^ result];
-	F = gSignZeroMagic2Magic1[A = result] | bits;
+	SET_FLAGS(kFlagsAdd, A, value, result);
+	A = result;
 }
 
-OPCODE(ADC_A) { _ADC(A); }
-OPCODE(ADC_B) { _ADC(B); }
-OPCODE(ADC_C) { _ADC(C); }
-OPCODE(ADC_D) { _ADC(D); }
-OPCODE(ADC_E) { _ADC(E); }
-OPCODE(ADC_H) { _ADC(H); }
-OPCODE(ADC_L) { _ADC(L); }
+OPCODE(ADC_A) { _ADC(CACHED_ A); }
+OPCODE(ADC_B) { _ADC(CACHED_ B); }
+OPCODE(ADC_C) { _ADC(CACHED_ C); }
+OPCODE(ADC_D) { _ADC(CACHED_ D); }
+OPCODE(ADC_E) { _ADC(CACHED_ E); }
+OPCODE(ADC_H) { _ADC(CACHED_ H); }
+OPCODE(ADC_L) { _ADC(CACHED_ L); }
 #ifdef Z80
-OPCODE(ADC_IXH) { _ADC(IX_H); }
-OPCODE(ADC_IXL) { _ADC(IX_L); }
-OPCODE(ADC_IYH) { _ADC(IY_H); }
-OPCODE(ADC_IYL) { _ADC(IY_L); }
+OPCODE(ADC_XYH) { _ADC(CACHED_ XY_H); }
+OPCODE(ADC_XYL) { _ADC(CACHED_ XY_L); }
 #endif
-OPCODE(ADC_NN) { _ADC(RdByte(PC++)); }
-OPCODE(ADC_iHL) { _ADC(RdByte(HL)); }
+OPCODE(ADC_NN) { PC++; _ADC(CACHED_ NN); }
+OPCODE(ADC_iHL) { _ADC(CACHED_ RdByte(HL)); }
 #ifdef Z80
-OPCODE(ADC_iIX_NN) { _ADC(RdByte(IX + (char)RdByte(PC++))); }
-OPCODE(ADC_iIY_NN) { _ADC(RdByte(IY + (char)RdByte(PC++))); }
+OPCODE(ADC_iXY_NN) { PC++; _ADC(CACHED_ RdByte(XY + (char)NN)); }
 #endif
 
 /* 16-bit add with carry. */
 
 #ifdef Z80
 
-static inline void _ADC_WORD(Word value)
+static INLINE void _ADC_WORD(CACHE_ Word value)
 {
 	unsigned long result = HL + value + CARRY_FLAG;
 	Byte bits = gHalfCarryOverflowCarry[(HL ^ value ^ result) >> 8];
@@ -1408,10 +1714,10 @@ static inline void _ADC_WORD(Word value)
 	    bits;
 }
 
-OPCODE(ADC_HL_BC) { _ADC_WORD(BC); }
-OPCODE(ADC_HL_DE) { _ADC_WORD(DE); }
-OPCODE(ADC_HL_HL) { _ADC_WORD(HL); }
-OPCODE(ADC_HL_SP) { _ADC_WORD(SP); }
+OPCODE(ADC_HL_BC) { _ADC_WORD(CACHED_ BC); }
+OPCODE(ADC_HL_DE) { _ADC_WORD(CACHED_ DE); }
+OPCODE(ADC_HL_HL) { _ADC_WORD(CACHED_ HL); }
+OPCODE(ADC_HL_SP) { _ADC_WORD(CACHED_ SP); }
 
 #endif
 
@@ -1420,67 +1726,61 @@ OPCODE(ADC_HL_SP) { _ADC_WORD(SP); }
 
 /* 8-bit subtract */
 
-static inline void _SUB(short value)
+static INLINE void _SUB(CACHE_ Byte value)
 {
 	unsigned long result = (A - value) & 0x1FF;
-	Byte bits = gHalfCarryOverflowCarry[A ^ value ^ result];
-	F = (SUBTRACT) | gSignZeroMagic2Magic1[A = result] | bits;
+	SET_FLAGS(kFlagsSubtract, A, value, result);
+	A = result;
 }
 
-OPCODE(SUB_A) { _SUB(A); }
-OPCODE(SUB_B) { _SUB(B); }
-OPCODE(SUB_C) { _SUB(C); }
-OPCODE(SUB_D) { _SUB(D); }
-OPCODE(SUB_E) { _SUB(E); }
-OPCODE(SUB_H) { _SUB(H); }
-OPCODE(SUB_L) { _SUB(L); }
+OPCODE(SUB_A) { _SUB(CACHED_ A); }
+OPCODE(SUB_B) { _SUB(CACHED_ B); }
+OPCODE(SUB_C) { _SUB(CACHED_ C); }
+OPCODE(SUB_D) { _SUB(CACHED_ D); }
+OPCODE(SUB_E) { _SUB(CACHED_ E); }
+OPCODE(SUB_H) { _SUB(CACHED_ H); }
+OPCODE(SUB_L) { _SUB(CACHED_ L); }
 #ifdef Z80
-OPCODE(SUB_IXH) { _SUB(IX_H); }
-OPCODE(SUB_IXL) { _SUB(IX_L); }
-OPCODE(SUB_IYH) { _SUB(IY_H); }
-OPCODE(SUB_IYL) { _SUB(IY_L); }
+OPCODE(SUB_XYH) { _SUB(CACHED_ XY_H); }
+OPCODE(SUB_XYL) { _SUB(CACHED_ XY_L); }
 #endif
-OPCODE(SUB_NN) { _SUB(RdByte(PC++)); }
-OPCODE(SUB_iHL) { _SUB(RdByte(HL)); }
+OPCODE(SUB_NN) { PC++; _SUB(CACHED_ NN); }
+OPCODE(SUB_iHL) { _SUB(CACHED_ RdByte(HL)); }
 #ifdef Z80
-OPCODE(SUB_iIX_NN) { _SUB(RdByte(IX + (char)RdByte(PC++))); }
-OPCODE(SUB_iIY_NN) { _SUB(RdByte(IY + (char)RdByte(PC++))); }
+OPCODE(SUB_iXY_NN) { PC++; _SUB(CACHED_ RdByte(XY + (char)NN)); }
 #endif
 
 /* 8-bit subtract with carry */
 
-static inline void _SBC(Byte value)
+static INLINE void _SBC(CACHE_ Byte value)
 {
 	unsigned long result = (A - value - CARRY_FLAG) & 0x1FF;
-	Byte bits = gHalfCarryOverflowCarry[A ^ value ^ result];
-	F = (SUBTRACT) | gSignZeroMagic2Magic1[A = result] | bits;
+	SET_FLAGS(kFlagsSubtract, A, value, result);
+	A = result;
 }
 
-OPCODE(SBC_A) { _SBC(A); }
-OPCODE(SBC_B) { _SBC(B); }
-OPCODE(SBC_C) { _SBC(C); }
-OPCODE(SBC_D) { _SBC(D); }
-OPCODE(SBC_E) { _SBC(E); }
-OPCODE(SBC_H) { _SBC(H); }
-OPCODE(SBC_L) { _SBC(L); }
+OPCODE(SBC_A) { _SBC(CACHED_ A); }
+OPCODE(SBC_B) { _SBC(CACHED_ B); }
+OPCODE(SBC_C) { _SBC(CACHED_ C); }
+OPCODE(SBC_D) { _SBC(CACHED_ D); }
+OPCODE(SBC_E) { _SBC(CACHED_ E); }
+OPCODE(SBC_H) { _SBC(CACHED_ H); }
+OPCODE(SBC_L) { _SBC(CACHED_ L); }
 #ifdef Z80
-OPCODE(SBC_IXH) { _SBC(IX_H); }
-OPCODE(SBC_IXL) { _SBC(IX_L); }
-OPCODE(SBC_IYH) { _SBC(IY_H); }
-OPCODE(SBC_IYL) { _SBC(IY_L); }
+OPCODE(SBC_XYH) { _SBC(CACHED_ XY_H); }
+OPCODE(SBC_XYL) { _SBC(CACHED_ XY_L); }
 #endif
-OPCODE(SBC_NN) { _SBC(RdByte(PC++)); }
-OPCODE(SBC_iHL) { _SBC(RdByte(HL)); }
+OPCODE(SBC_NN) { PC++; _SBC(CACHED_ NN); }
+OPCODE(SBC_iHL) { _SBC(CACHED_ RdByte(HL)); }
 #ifdef Z80
-OPCODE(SBC_iIX_NN) { _SBC(RdByte(IX + (char)RdByte(PC++))); }
-OPCODE(SBC_iIY_NN) { _SBC(RdByte(IY + (char)RdByte(PC++))); }
+OPCODE(SBC_iXY_NN) { PC++; _SBC(CACHED_ RdByte(XY + (char)NN)); }
 #endif
 
 /* 16-bit subtract with carry */
 
 #ifdef Z80
 
-static inline void _SBC_WORD(Word value)
+static INLINE void _SBC_WORD(CACHE_ Word value)
 {
 	unsigned long result = (HL - value - CARRY_FLAG) & 0x1FFFF;
 	Byte bits = gHalfCarryOverflowCarry[(HL ^ value ^ result) >> 8];
@@ -1491,10 +1791,10 @@ static inline void _SBC_WORD(Word value)
 	    bits;
 }
 
-OPCODE(SBC_HL_BC) { _SBC_WORD(BC); }
-OPCODE(SBC_HL_DE) { _SBC_WORD(DE); }
-OPCODE(SBC_HL_HL) { _SBC_WORD(HL); }
-OPCODE(SBC_HL_SP) { _SBC_WORD(SP); }
+OPCODE(SBC_HL_BC) { _SBC_WORD(CACHED_ BC); }
+OPCODE(SBC_HL_DE) { _SBC_WORD(CACHED_ DE); }
+OPCODE(SBC_HL_HL) { _SBC_WORD(CACHED_ HL); }
+OPCODE(SBC_HL_SP) { _SBC_WORD(CACHED_ SP); }
 
 #endif
 
@@ -1503,83 +1803,77 @@ OPCODE(SBC_HL_SP) { _SBC_WORD(SP); }
 
 /* 8-bit and */
 
-static inline void _AND(Byte value)
+static INLINE void _AND(CACHE_ Byte value)
 {
-	F = (HALFCARRY) | gSignZeroMagic2Magic1Parity[A &= value];
+	A &= value;
+	SET_FLAGS(kFlagsAnd, 0, 0, A);
 }
 
-OPCODE(AND_A) { _AND(A); }
-OPCODE(AND_B) { _AND(B); }
-OPCODE(AND_C) { _AND(C); }
-OPCODE(AND_D) { _AND(D); }
-OPCODE(AND_E) { _AND(E); }
-OPCODE(AND_H) { _AND(H); }
-OPCODE(AND_L) { _AND(L); }
+OPCODE(AND_A) { _AND(CACHED_ A); }
+OPCODE(AND_B) { _AND(CACHED_ B); }
+OPCODE(AND_C) { _AND(CACHED_ C); }
+OPCODE(AND_D) { _AND(CACHED_ D); }
+OPCODE(AND_E) { _AND(CACHED_ E); }
+OPCODE(AND_H) { _AND(CACHED_ H); }
+OPCODE(AND_L) { _AND(CACHED_ L); }
 #ifdef Z80
-OPCODE(AND_IXH) { _AND(IX_H); }
-OPCODE(AND_IXL) { _AND(IX_L); }
-OPCODE(AND_IYH) { _AND(IY_H); }
-OPCODE(AND_IYL) { _AND(IY_L); }
+OPCODE(AND_XYH) { _AND(CACHED_ XY_H); }
+OPCODE(AND_XYL) { _AND(CACHED_ XY_L); }
 #endif
-OPCODE(AND_NN) { _AND(RdByte(PC++)); }
-OPCODE(AND_iHL) { _AND(RdByte(HL)); }
+OPCODE(AND_NN) { PC++; _AND(CACHED_ NN); }
+OPCODE(AND_iHL) { _AND(CACHED_ RdByte(HL)); }
 #ifdef Z80
-OPCODE(AND_iIX_NN) { _AND(RdByte(IX + (char)RdByte(PC++))); }
-OPCODE(AND_iIY_NN) { _AND(RdByte(IY + (char)RdByte(PC++))); }
+OPCODE(AND_iXY_NN) { PC++; _AND(CACHED_ RdByte(XY + (char)NN)); }
 #endif
 
 /* 8-bit or */
 
-static inline void _OR(Byte value)
+static INLINE void _OR(CACHE_ Byte value)
 {
-	F = gSignZeroMagic2Magic1Parity[A |= value];
+	A |= value;
+	SET_FLAGS(kFlagsParity, 0, 0, A);
 }
 
-OPCODE(OR_A) { _OR(A); }
-OPCODE(OR_B) { _OR(B); }
-OPCODE(OR_C) { _OR(C); }
-OPCODE(OR_D) { _OR(D); }
-OPCODE(OR_E) { _OR(E); }
-OPCODE(OR_H) { _OR(H); }
-OPCODE(OR_L) { _OR(L); }
+OPCODE(OR_A) { _OR(CACHED_ A); }
+OPCODE(OR_B) { _OR(CACHED_ B); }
+OPCODE(OR_C) { _OR(CACHED_ C); }
+OPCODE(OR_D) { _OR(CACHED_ D); }
+OPCODE(OR_E) { _OR(CACHED_ E); }
+OPCODE(OR_H) { _OR(CACHED_ H); }
+OPCODE(OR_L) { _OR(CACHED_ L); }
 #ifdef Z80
-OPCODE(OR_IXH) { _OR(IX_H); }
-OPCODE(OR_IXL) { _OR(IX_L); }
-OPCODE(OR_IYH) { _OR(IY_H); }
-OPCODE(OR_IYL) { _OR(IY_L); }
+OPCODE(OR_XYH) { _OR(CACHED_ XY_H); }
+OPCODE(OR_XYL) { _OR(CACHED_ XY_L); }
 #endif
-OPCODE(OR_NN) { _OR(RdByte(PC++)); }
-OPCODE(OR_iHL) { _OR(RdByte(HL)); }
+OPCODE(OR_NN) { PC++; _OR(CACHED_ NN); }
+OPCODE(OR_iHL) { _OR(CACHED_ RdByte(HL)); }
 #ifdef Z80
-OPCODE(OR_iIX_NN) { _OR(RdByte(IX + (char)RdByte(PC++))); }
-OPCODE(OR_iIY_NN) { _OR(RdByte(IY + (char)RdByte(PC++))); }
+OPCODE(OR_iXY_NN) { PC++; _OR(CACHED_ RdByte(XY + (char)NN)); }
 #endif
 
 /* 8-bit exclusive or */
 
-static inline void _XOR(Byte value)
+static INLINE void _XOR(CACHE_ Byte value)
 {
-	F = gSignZeroMagic2Magic1Parity[A ^= value];
+	A ^= value;
+	SET_FLAGS(kFlagsParity, 0, 0, A);
 }
 
-OPCODE(XOR_A) { _XOR(A); }
-OPCODE(XOR_B) { _XOR(B); }
-OPCODE(XOR_C) { _XOR(C); }
-OPCODE(XOR_D) { _XOR(D); }
-OPCODE(XOR_E) { _XOR(E); }
-OPCODE(XOR_H) { _XOR(H); }
-OPCODE(XOR_L) { _XOR(L); }
+OPCODE(XOR_A) { _XOR(CACHED_ A); }
+OPCODE(XOR_B) { _XOR(CACHED_ B); }
+OPCODE(XOR_C) { _XOR(CACHED_ C); }
+OPCODE(XOR_D) { _XOR(CACHED_ D); }
+OPCODE(XOR_E) { _XOR(CACHED_ E); }
+OPCODE(XOR_H) { _XOR(CACHED_ H); }
+OPCODE(XOR_L) { _XOR(CACHED_ L); }
 #ifdef Z80
-OPCODE(XOR_IXH) { _XOR(IX_H); }
-OPCODE(XOR_IXL) { _XOR(IX_L); }
-OPCODE(XOR_IYH) { _XOR(IY_H); }
-OPCODE(XOR_IYL) { _XOR(IY_L); }
+OPCODE(XOR_XYH) { _XOR(CACHED_ XY_H); }
+OPCODE(XOR_XYL) { _XOR(CACHED_ XY_L); }
 #endif
-OPCODE(XOR_NN) { _XOR(RdByte(PC++)); }
-OPCODE(XOR_iHL) { _XOR(RdByte(HL)); }
+OPCODE(XOR_NN) { PC++; _XOR(CACHED_ NN); }
+OPCODE(XOR_iHL) { _XOR(CACHED_ RdByte(HL)); }
 #ifdef Z80
-OPCODE(XOR_iIX_NN) { _XOR(RdByte(IX + (char)RdByte(PC++))); }
-OPCODE(XOR_iIY_NN) { _XOR(RdByte(IY + (char)RdByte(PC++))); }
+OPCODE(XOR_iXY_NN) { PC++; _XOR(CACHED_ RdByte(XY + (char)NN)); }
 #endif
 
 /**********************************************************************/
@@ -1587,38 +1881,79 @@ OPCODE(XOR_iIY_NN) { _XOR(RdByte(IY + (char)RdByte(PC++))); }
 
 /* 8-bit compare */
 
-static inline void _CP(Byte value)
+static INLINE void _CP(CACHE_ Byte value)
 {
 	unsigned long result = (A - value) & 0x1FF;
-	F = (SUBTRACT) |
-	    (result & SIGN) |
-	    (((result & 0xFF) == 0) << ZERO_SHIFT) |
-	    (value & (MAGIC1 | MAGIC2)) |
-	    gHalfCarryOverflowCarry[A ^ value ^ result];
+	SET_FLAGS(kFlagsCompare, A, value, result);
 }
 
-OPCODE(CP_A) { _CP(A); }
-OPCODE(CP_B) { _CP(B); }
-OPCODE(CP_C) { _CP(C); }
-OPCODE(CP_D) { _CP(D); }
-OPCODE(CP_E) { _CP(E); }
-OPCODE(CP_H) { _CP(H); }
-OPCODE(CP_L) { _CP(L); }
+OPCODE(CP_A) { _CP(CACHED_ A); }
+OPCODE(CP_B) { _CP(CACHED_ B); }
+OPCODE(CP_C) { _CP(CACHED_ C); }
+OPCODE(CP_D) { _CP(CACHED_ D); }
+OPCODE(CP_E) { _CP(CACHED_ E); }
+OPCODE(CP_H) { _CP(CACHED_ H); }
+OPCODE(CP_L) { _CP(CACHED_ L); }
 #ifdef Z80
-OPCODE(CP_IXH) { _CP(IX_H); }
-OPCODE(CP_IXL) { _CP(IX_L); }
-OPCODE(CP_IYH) { _CP(IY_H); }
-OPCODE(CP_IYL) { _CP(IY_L); }
+OPCODE(CP_XYH) { _CP(CACHED_ XY_H); }
+OPCODE(CP_XYL) { _CP(CACHED_ XY_L); }
 #endif
-OPCODE(CP_NN) { _CP(RdByte(PC++)); }
-OPCODE(CP_iHL) { _CP(RdByte(HL)); }
+OPCODE(CP_NN) { PC++; _CP(CACHED_ NN); }
+OPCODE(CP_iHL) { _CP(CACHED_ RdByte(HL)); }
 #ifdef Z80
-OPCODE(CP_iIX_NN) { _CP(RdByte(IX + (char)RdByte(PC++))); }
-OPCODE(CP_iIY_NN) { _CP(RdByte(IY + (char)RdByte(PC++))); }
+OPCODE(CP_iXY_NN) { PC++; _CP(CACHED_ RdByte(XY + (char)NN)); }
 #endif
 
 #ifdef Z80
 
+/* BlockSearch() compares A with up to count bytes (BC, 0 is 65536)
+ * from HL, stepping up or down, one bank span at a time, until one
+ * is equal. It leaves HL and BC as CPIR or CPDR would, and returns
+ * the last byte compared. A watched bank is searched one byte at a
+ * time.
+ */
+static INLINE Byte BlockSearch(CACHE_ unsigned long count, int step)
+{
+	Byte *span;
+	Byte *found;
+	Word size;
+	Word n;
+	Byte value = 0;
+
+	while (count > 0) {
+		size = (step > 0) ? BankTail(HL) : BankHead(HL);
+		if (size > count)
+			size = (Word)count;
+		span = RdSpan(HL);
+#ifdef WATCHPOINTS
+		if (span == 0) {
+			value = RdByte(HL);
+			HL += step;
+			BC--;
+			count = (value == A) ? 0 : count - 1;
+			continue;
+		}
+#endif
+		if (step > 0) {
+			found = memchr(span, A, size);
+			n = (found != 0) ? (Word)(found - span) : size;
+		}
+		else
+			for (n = 0; (n < size) && (span[-n] != A); n++)
+				;
+		/* The first n bytes are not equal, the next one is. */
+		if (n < size)
+			count = size = n + 1;
+		value = (step > 0) ? span[size - 1] : span[1 - size];
+		HL += (step > 0) ? size : -size;
+		BC -= size;
+		count -= size;
+	}
+
+	return value;
+
+}
+
 /* Compare bytes, increment pointer. */
 /* A = target */
 /* HL = pointer */
@@ -1649,12 +1984,12 @@ OPCODE(CPIR)
 	Byte value;
 	unsigned long result;
 	unsigned long bits;
+	Word count = BC;
 	int op;
-	do {
-		value = RdByte(HL++);
-		result = A - value;
-		op = (--BC != 0);
-	} while (op && (result != 0));
+	value = BlockSearch(CACHED_ count ? count : 0x10000, 1);
+	result = A - value;
+	op = (BC != 0);
+	CYCLES += kRepeatTaken * (Word)(count - BC - 1);
 	bits = A ^ value ^ result;
 	F = (F & CARRY) |
 	    (result & SIGN) |
@@ -1698,12 +2033,12 @@ OPCODE(CPDR)
 	Byte value;
 	unsigned long result;
 	unsigned long bits;
+	Word count = BC;
 	int op;
-	do {
-		value = RdByte(HL--);
-		result = A - value;
-		op = (--BC != 0);
-	} while (op && (result != 0));
+	value = BlockSearch(CACHED_ count ? count : 0x10000, -1);
+	result = A - value;
+	op = (BC != 0);
+	CYCLES += kRepeatTaken * (Word)(count - BC - 1);
 	bits = A ^ value ^ result;
 	F = (F & CARRY) |
 	    (result & SIGN) |
@@ -1765,7 +2100,7 @@ OPCODE(RRD_iHL)
 	Byte m = RdByte(HL);
 	WrByte(HL, (m >> 4) | ((A & 0x0F) << 4));
 	A = (A & 0xF0) | (m & 0x0F);
-	F = gSignZeroMagic2Magic1Parity[A] | (F & CARRY);
+	SET_FLAGS(kFlagsParity, 0, 0, A | (CARRY_FLAG << 8));
 }
 
 OPCODE(RLD_iHL)
@@ -1773,96 +2108,92 @@ OPCODE(RLD_iHL)
 	Byte m = RdByte(HL);
 	WrByte(HL, (m << 4) | (A &	0x0F));
 	A = (A & 0xF0) | (m >> 4);
-	F = gSignZeroMagic2Magic1Parity[A] | (F & CARRY);
+	SET_FLAGS(kFlagsParity, 0, 0, A | (CARRY_FLAG << 8));
 }
 
 #endif
 
 #ifdef Z80
 
-static inline void _RLC(Byte *value)
+static INLINE void _RLC(CACHE_ Byte *value)
 {
 	Byte result = (*value << 1) | (*value >> 7);
-	F = gSignZeroMagic2Magic1Parity[result & 0xFF] | (result & CARRY);
+	SET_FLAGS(kFlagsParity, 0, 0, result | ((result & CARRY) << 8));
 	*value = result;
 }
 
-OPCODE(RLC_A) { _RLC(&A); }
-OPCODE(RLC_B) { _RLC(&B); }
-OPCODE(RLC_C) { _RLC(&C); }
-OPCODE(RLC_D) { _RLC(&D); }
-OPCODE(RLC_E) { _RLC(&E); }
-OPCODE(RLC_H) { _RLC(&H); }
-OPCODE(RLC_L) { _RLC(&L); }
-OPCODE(RLC_iHL) { _RLC(RwByte(HL)); }
-OPCODE(RLC_iIX_NN) { _RLC(RwByte(IX + (char)RdByte(PC - 2))); }
-OPCODE(RLC_iIY_NN) { _RLC(RwByte(IY + (char)RdByte(PC - 2))); }
+OPCODE(RLC_A) { _RLC(CACHED_ &A); }
+OPCODE(RLC_B) { _RLC(CACHED_ &B); }
+OPCODE(RLC_C) { _RLC(CACHED_ &C); }
+OPCODE(RLC_D) { _RLC(CACHED_ &D); }
+OPCODE(RLC_E) { _RLC(CACHED_ &E); }
+OPCODE(RLC_H) { _RLC(CACHED_ &H); }
+OPCODE(RLC_L) { _RLC(CACHED_ &L); }
+OPCODE(RLC_iHL) { _RLC(CACHED_ RwByte(HL)); }
+OPCODE(RLC_iXY_NN) { _RLC(CACHED_ RwByte(XY + (char)NN)); }
 
 #endif
 
 #ifdef Z80
 
-static inline void _RRC(Byte *value)
+static INLINE void _RRC(CACHE_ Byte *value)
 {
 	Byte result = (*value >> 1) | (*value << 7);
-	F = gSignZeroMagic2Magic1Parity[result] | ((result >> 7) & CARRY);
+	SET_FLAGS(kFlagsParity, 0, 0, result | ((result & 0x80) << 1));
 	*value = result;
 }
 
-OPCODE(RRC_A) { _RRC(&A); }
-OPCODE(RRC_B) { _RRC(&B); }
-OPCODE(RRC_C) { _RRC(&C); }
-OPCODE(RRC_D) { _RRC(&D); }
-OPCODE(RRC_E) { _RRC(&E); }
-OPCODE(RRC_H) { _RRC(&H); }
-OPCODE(RRC_L) { _RRC(&L); }
-OPCODE(RRC_iHL) { _RRC(RwByte(HL)); }
-OPCODE(RRC_iIX_NN) { _RRC(RwByte(IX + (char)RdByte(PC - 2))); }
-OPCODE(RRC_iIY_NN) { _RRC(RwByte(IY + (char)RdByte(PC - 2))); }
+OPCODE(RRC_A) { _RRC(CACHED_ &A); }
+OPCODE(RRC_B) { _RRC(CACHED_ &B); }
+OPCODE(RRC_C) { _RRC(CACHED_ &C); }
+OPCODE(RRC_D) { _RRC(CACHED_ &D); }
+OPCODE(RRC_E) { _RRC(CACHED_ &E); }
+OPCODE(RRC_H) { _RRC(CACHED_ &H); }
+OPCODE(RRC_L) { _RRC(CACHED_ &L); }
+OPCODE(RRC_iHL) { _RRC(CACHED_ RwByte(HL)); }
+OPCODE(RRC_iXY_NN) { _RRC(CACHED_ RwByte(XY + (char)NN)); }
 
 #endif
 
 #ifdef Z80
 
-static inline void _RL(Byte *value)
+static INLINE void _RL(CACHE_ Byte *value)
 {
 	Byte result = (*value << 1) | CARRY_FLAG;
-	F = gSignZeroMagic2Magic1Parity[result] | ((*value >> 7) & CARRY);
+	SET_FLAGS(kFlagsParity, 0, 0, result | ((*value & 0x80) << 1));
 	*value = result;
 }
 
-OPCODE(RL_A) { _RL(&A); }
-OPCODE(RL_B) { _RL(&B); }
-OPCODE(RL_C) { _RL(&C); }
-OPCODE(RL_D) { _RL(&D); }
-OPCODE(RL_E) { _RL(&E); }
-OPCODE(RL_H) { _RL(&H); }
-OPCODE(RL_L) { _RL(&L); }
-OPCODE(RL_iHL) { _RL(RwByte(HL)); }
-OPCODE(RL_iIX_NN) { _RL(RwByte(IX + (char)RdByte(PC - 2))); }
-OPCODE(RL_iIY_NN) { _RL(RwByte(IY + (char)RdByte(PC - 2))); }
+OPCODE(RL_A) { _RL(CACHED_ &A); }
+OPCODE(RL_B) { _RL(CACHED_ &B); }
+OPCODE(RL_C) { _RL(CACHED_ &C); }
+OPCODE(RL_D) { _RL(CACHED_ &D); }
+OPCODE(RL_E) { _RL(CACHED_ &E); }
+OPCODE(RL_H) { _RL(CACHED_ &H); }
+OPCODE(RL_L) { _RL(CACHED_ &L); }
+OPCODE(RL_iHL) { _RL(CACHED_ RwByte(HL)); }
+OPCODE(RL_iXY_NN) { _RL(CACHED_ RwByte(XY + (char)NN)); }
 
 #endif
 
 #ifdef Z80
 
-static inline void _RR(Byte *value)
+static INLINE void _RR(CACHE_ Byte *value)
 {
 	Byte result = (*value >> 1) | (CARRY_FLAG << 7);
-	F = gSignZeroMagic2Magic1Parity[result] | (*value & CARRY);
+	SET_FLAGS(kFlagsParity, 0, 0, result | ((*value & CARRY) << 8));
 	*value = result;
 }
 
-OPCODE(RR_A) { _RR(&A); }
-OPCODE(RR_B) { _RR(&B); }
-OPCODE(RR_C) { _RR(&C); }
-OPCODE(RR_D) { _RR(&D); }
-OPCODE(RR_E) { _RR(&E); }
-OPCODE(RR_H) { _RR(&H); }
-OPCODE(RR_L) { _RR(&L); }
-OPCODE(RR_iHL) { _RR(RwByte(HL)); }
-OPCODE(RR_iIX_NN) { _RR(RwByte(IX + (char)RdByte(PC - 2))); }
-OPCODE(RR_iIY_NN) { _RR(RwByte(IY + (char)RdByte(PC - 2))); }
+OPCODE(RR_A) { _RR(CACHED_ &A); }
+OPCODE(RR_B) { _RR(CACHED_ &B); }
+OPCODE(RR_C) { _RR(CACHED_ &C); }
+OPCODE(RR_D) { _RR(CACHED_ &D); }
+OPCODE(RR_E) { _RR(CACHED_ &E); }
+OPCODE(RR_H) { _RR(CACHED_ &H); }
+OPCODE(RR_L) { _RR(CACHED_ &L); }
+OPCODE(RR_iHL) { _RR(CACHED_ RwByte(HL)); }
+OPCODE(RR_iXY_NN) { _RR(CACHED_ RwByte(XY + (char)NN)); }
 
 #endif
 
@@ -1871,89 +2202,85 @@ OPCODE(RR_iIY_NN) { _RR(RwByte(IY + (char)RdByte(PC - 2))); }
 
 #ifdef Z80
 
-static inline void _SLA(Byte *value)
+static INLINE void _SLA(CACHE_ Byte *value)
 {
 	Byte result = *value << 1;
-	F = gSignZeroMagic2Magic1Parity[result] | ((*value >> 7) & CARRY);
+	SET_FLAGS(kFlagsParity, 0, 0, result | ((*value & 0x80) << 1));
 	*value = result;
 }
 
-OPCODE(SLA_A) { _SLA(&A); }
-OPCODE(SLA_B) { _SLA(&B); }
-OPCODE(SLA_C) { _SLA(&C); }
-OPCODE(SLA_D) { _SLA(&D); }
-OPCODE(SLA_E) { _SLA(&E); }
-OPCODE(SLA_H) { _SLA(&H); }
-OPCODE(SLA_L) { _SLA(&L); }
-OPCODE(SLA_iHL) { _SLA(RwByte(HL)); }
-OPCODE(SLA_iIX_NN) { _SLA(RwByte(IX + (char)RdByte(PC - 2))); }
-OPCODE(SLA_iIY_NN) { _SLA(RwByte(IY + (char)RdByte(PC - 2))); }
+OPCODE(SLA_A) { _SLA(CACHED_ &A); }
+OPCODE(SLA_B) { _SLA(CACHED_ &B); }
+OPCODE(SLA_C) { _SLA(CACHED_ &C); }
+OPCODE(SLA_D) { _SLA(CACHED_ &D); }
+OPCODE(SLA_E) { _SLA(CACHED_ &E); }
+OPCODE(SLA_H) { _SLA(CACHED_ &H); }
+OPCODE(SLA_L) { _SLA(CACHED_ &L); }
+OPCODE(SLA_iHL) { _SLA(CACHED_ RwByte(HL)); }
+OPCODE(SLA_iXY_NN) { _SLA(CACHED_ RwByte(XY + (char)NN)); }
 
 #endif
 
 #ifdef Z80
 
-static inline void _SRA(Byte *value)
+static INLINE void _SRA(CACHE_ Byte *value)
 {
 	Byte result = (*value >> 1) | (*value & 0x80);
-	F = gSignZeroMagic2Magic1Parity[result] | (*value & CARRY);
+	SET_FLAGS(kFlagsParity, 0, 0, result | ((*value & CARRY) << 8));
 	*value = result;
 }
 
-OPCODE(SRA_A) { _SRA(&A); }
-OPCODE(SRA_B) { _SRA(&B); }
-OPCODE(SRA_C) { _SRA(&C); }
-OPCODE(SRA_D) { _SRA(&D); }
-OPCODE(SRA_E) { _SRA(&E); }
-OPCODE(SRA_H) { _SRA(&H); }
-OPCODE(SRA_L) { _SRA(&L); }
-OPCODE(SRA_iHL) { _SRA(RwByte(HL)); }
-OPCODE(SRA_iIX_NN) { _SRA(RwByte(IX + (char)RdByte(PC - 2))); }
-OPCODE(SRA_iIY_NN) { _SRA(RwByte(IY + (char)RdByte(PC - 2))); }
+OPCODE(SRA_A) { _SRA(CACHED_ &A); }
+OPCODE(SRA_B) { _SRA(CACHED_ &B); }
+OPCODE(SRA_C) { _SRA(CACHED_ &C); }
+OPCODE(SRA_D) { _SRA(CACHED_ &D); }
+OPCODE(SRA_E) { _SRA(CACHED_ &E); }
+OPCODE(SRA_H) { _SRA(CACHED_ &H); }
+OPCODE(SRA_L) { _SRA(CACHED_ &L); }
+OPCODE(SRA_iHL) { _SRA(CACHED_ RwByte(HL)); }
+OPCODE(SRA_iXY_NN) { _SRA(CACHED_ RwByte(XY + (char)NN)); }
 
 #endif
 
 #ifdef Z80
 
-static inline void _SLIA(Byte *value)
+static INLINE void _SLIA(CACHE_ Byte *value)
 {
 	Byte result = (*value << 1) | 1;
-	F = gSignZeroMagic2Magic1Parity[result] | ((*value >> 7) & CARRY);
+	SET_FLAGS(kFlagsParity, 0, 0, result | ((*value & 0x80) << 1));
 	*value = result;
 }
 
-OPCODE(SLIA_A) { _SLIA(&A); }
-OPCODE(SLIA_B) { _SLIA(&B); }
-OPCODE(SLIA_C) { _SLIA(&C); }
-OPCODE(SLIA_D) { _SLIA(&D); }
-OPCODE(SLIA_E) { _SLIA(&E); }
-OPCODE(SLIA_H) { _SLIA(&H); }
-OPCODE(SLIA_L) { _SLIA(&L); }
-OPCODE(SLIA_iHL) { _SLIA(RwByte(HL)); }
-OPCODE(SLIA_iIX_NN) { _SLIA(RwByte(IX + (char)RdByte(PC - 2))); }
-OPCODE(SLIA_iIY_NN) { _SLIA(RwByte(IY + (char)RdByte(PC - 2))); }
+OPCODE(SLIA_A) { _SLIA(CACHED_ &A); }
+OPCODE(SLIA_B) { _SLIA(CACHED_ &B); }
+OPCODE(SLIA_C) { _SLIA(CACHED_ &C); }
+OPCODE(SLIA_D) { _SLIA(CACHED_ &D); }
+OPCODE(SLIA_E) { _SLIA(CACHED_ &E); }
+OPCODE(SLIA_H) { _SLIA(CACHED_ &H); }
+OPCODE(SLIA_L) { _SLIA(CACHED_ &L); }
+OPCODE(SLIA_iHL) { _SLIA(CACHED_ RwByte(HL)); }
+OPCODE(SLIA_iXY_NN) { _SLIA(CACHED_ RwByte(XY + (char)NN)); }
 
 #endif
 
 #ifdef Z80
 
-static inline void _SRL(Byte *value)
+static INLINE void _SRL(CACHE_ Byte *value)
 {
 	Byte result = *value >> 1;
-	F = gSignZeroMagic2Magic1Parity[result] | (*value & CARRY);
+	SET_FLAGS(kFlagsParity, 0, 0, result | ((*value & CARRY) << 8));
 	*value = result;
 }
 
-OPCODE(SRL_A) { _SRL(&A); }
-OPCODE(SRL_B) { _SRL(&B); }
-OPCODE(SRL_C) { _SRL(&C); }
-OPCODE(SRL_D) { _SRL(&D); }
-OPCODE(SRL_E) { _SRL(&E); }
-OPCODE(SRL_H) { _SRL(&H); }
-OPCODE(SRL_L) { _SRL(&L); }
-OPCODE(SRL_iHL) { _SRL(RwByte(HL)); }
-OPCODE(SRL_iIX_NN) { _SRL(RwByte(IX + (char)RdByte(PC - 2))); }
-OPCODE(SRL_iIY_NN) { _SRL(RwByte(IY + (char)RdByte(PC - 2))); }
+OPCODE(SRL_A) { _SRL(CACHED_ &A); }
+OPCODE(SRL_B) { _SRL(CACHED_ &B); }
+OPCODE(SRL_C) { _SRL(CACHED_ &C); }
+OPCODE(SRL_D) { _SRL(CACHED_ &D); }
+OPCODE(SRL_E) { _SRL(CACHED_ &E); }
+OPCODE(SRL_H) { _SRL(CACHED_ &H); }
+OPCODE(SRL_L) { _SRL(CACHED_ &L); }
+OPCODE(SRL_iHL) { _SRL(CACHED_ RwByte(HL)); }
+OPCODE(SRL_iXY_NN) { _SRL(CACHED_ RwByte(XY + (char)NN)); }
 
 #endif
 
@@ -1965,7 +2292,7 @@ OPCODE(SRL_iIY_NN) { _SRL(RwByte(IY + (char)RdByte(PC - 2))); }
 /* Test one of 8 bits. */
 /* M set if bit is 1 */
 
-static inline void _BITM(Byte bit, Byte value)
+static INLINE void _BITM(CACHE_ Byte bit, Byte value)
 {
 	F &= ~(SIGN |
 	       ZERO |
@@ -1980,7 +2307,7 @@ static inline void _BITM(Byte bit, Byte value)
 		F |= HALFCARRY | ZERO | OVERFLOW;
 }
 
-static inline void _BIT(Byte bit, Byte value)
+static INLINE void _BIT(CACHE_ Byte bit, Byte value)
 {
 	F &= ~(SIGN |
 	       ZERO |
@@ -1996,95 +2323,86 @@ static inline void _BIT(Byte bit, Byte value)
 	F |= (value & (MAGIC1 | MAGIC2));
 }
 
-OPCODE(BIT_0_A) { _BIT(0x01, A); }
-OPCODE(BIT_1_A) { _BIT(0x02, A); }
-OPCODE(BIT_2_A) { _BIT(0x04, A); }
-OPCODE(BIT_3_A) { _BIT(0x08, A); }
-OPCODE(BIT_4_A) { _BIT(0x10, A); }
-OPCODE(BIT_5_A) { _BIT(0x20, A); }
-OPCODE(BIT_6_A) { _BIT(0x40, A); }
-OPCODE(BIT_7_A) { _BIT(0x80, A); }
-
-OPCODE(BIT_0_B) { _BIT(0x01, B); }
-OPCODE(BIT_1_B) { _BIT(0x02, B); }
-OPCODE(BIT_2_B) { _BIT(0x04, B); }
-OPCODE(BIT_3_B) { _BIT(0x08, B); }
-OPCODE(BIT_4_B) { _BIT(0x10, B); }
-OPCODE(BIT_5_B) { _BIT(0x20, B); }
-OPCODE(BIT_6_B) { _BIT(0x40, B); }
-OPCODE(BIT_7_B) { _BIT(0x80, B); }
-
-OPCODE(BIT_0_C) { _BIT(0x01, C); }
-OPCODE(BIT_1_C) { _BIT(0x02, C); }
-OPCODE(BIT_2_C) { _BIT(0x04, C); }
-OPCODE(BIT_3_C) { _BIT(0x08, C); }
-OPCODE(BIT_4_C) { _BIT(0x10, C); }
-OPCODE(BIT_5_C) { _BIT(0x20, C); }
-OPCODE(BIT_6_C) { _BIT(0x40, C); }
-OPCODE(BIT_7_C) { _BIT(0x80, C); }
-
-OPCODE(BIT_0_D) { _BIT(0x01, D); }
-OPCODE(BIT_1_D) { _BIT(0x02, D); }
-OPCODE(BIT_2_D) { _BIT(0x04, D); }
-OPCODE(BIT_3_D) { _BIT(0x08, D); }
-OPCODE(BIT_4_D) { _BIT(0x10, D); }
-OPCODE(BIT_5_D) { _BIT(0x20, D); }
-OPCODE(BIT_6_D) { _BIT(0x40, D); }
-OPCODE(BIT_7_D) { _BIT(0x80, D); }
-
-OPCODE(BIT_0_E) { _BIT(0x01, E); }
-OPCODE(BIT_1_E) { _BIT(0x02, E); }
-OPCODE(BIT_2_E) { _BIT(0x04, E); }
-OPCODE(BIT_3_E) { _BIT(0x08, E); }
-OPCODE(BIT_4_E) { _BIT(0x10, E); }
-OPCODE(BIT_5_E) { _BIT(0x20, E); }
-OPCODE(BIT_6_E) { _BIT(0x40, E); }
-OPCODE(BIT_7_E) { _BIT(0x80, E); }
-
-OPCODE(BIT_0_H) { _BIT(0x01, H); }
-OPCODE(BIT_1_H) { _BIT(0x02, H); }
-OPCODE(BIT_2_H) { _BIT(0x04, H); }
-OPCODE(BIT_3_H) { _BIT(0x08, H); }
-OPCODE(BIT_4_H) { _BIT(0x10, H); }
-OPCODE(BIT_5_H) { _BIT(0x20, H); }
-OPCODE(BIT_6_H) { _BIT(0x40, H); }
-OPCODE(BIT_7_H) { _BIT(0x80, H); }
-
-OPCODE(BIT_0_L) { _BIT(0x01, L); }
-OPCODE(BIT_1_L) { _BIT(0x02, L); }
-OPCODE(BIT_2_L) { _BIT(0x04, L); }
-OPCODE(BIT_3_L) { _BIT(0x08, L); }
-OPCODE(BIT_4_L) { _BIT(0x10, L); }
-OPCODE(BIT_5_L) { _BIT(0x20, L); }
-OPCODE(BIT_6_L) { _BIT(0x40, L); }
-OPCODE(BIT_7_L) { _BIT(0x80, L); }
-
-OPCODE(BIT_0_iHL) { _BITM(0x01, RdByte(HL)); }
-OPCODE(BIT_1_iHL) { _BITM(0x02, RdByte(HL)); }
-OPCODE(BIT_2_iHL) { _BITM(0x04, RdByte(HL)); }
-OPCODE(BIT_3_iHL) { _BITM(0x08, RdByte(HL)); }
-OPCODE(BIT_4_iHL) { _BITM(0x10, RdByte(HL)); }
-OPCODE(BIT_5_iHL) { _BITM(0x20, RdByte(HL)); }
-OPCODE(BIT_6_iHL) { _BITM(0x40, RdByte(HL)); }
-OPCODE(BIT_7_iHL) { _BITM(0x80, RdByte(HL)); }
-
-OPCODE(BIT_0_iIX_NN) { _BITM(0x01, RdByte(IX + (char)RdByte(PC - 2))); }
-OPCODE(BIT_1_iIX_NN) { _BITM(0x02, RdByte(IX + (char)RdByte(PC - 2))); }
-OPCODE(BIT_2_iIX_NN) { _BITM(0x04, RdByte(IX + (char)RdByte(PC - 2))); }
-OPCODE(BIT_3_iIX_NN) { _BITM(0x08, RdByte(IX + (char)RdByte(PC - 2))); }
-OPCODE(BIT_4_iIX_NN) { _BITM(0x10, RdByte(IX + (char)RdByte(PC - 2))); }
-OPCODE(BIT_5_iIX_NN) { _BITM(0x20, RdByte(IX + (char)RdByte(PC - 2))); }
-OPCODE(BIT_6_iIX_NN) { _BITM(0x40, RdByte(IX + (char)RdByte(PC - 2))); }
-OPCODE(BIT_7_iIX_NN) { _BITM(0x80, RdByte(IX + (char)RdByte(PC - 2))); }
-
-OPCODE(BIT_0_iIY_NN) { _BITM(0x01, RdByte(IY + (char)RdByte(PC - 2))); }
-OPCODE(BIT_1_iIY_NN) { _BITM(0x02, RdByte(IY + (char)RdByte(PC - 2))); }
-OPCODE(BIT_2_iIY_NN) { _BITM(0x04, RdByte(IY + (char)RdByte(PC - 2))); }
-OPCODE(BIT_3_iIY_NN) { _BITM(0x08, RdByte(IY + (char)RdByte(PC - 2))); }
-OPCODE(BIT_4_iIY_NN) { _BITM(0x10, RdByte(IY + (char)RdByte(PC - 2))); }
-OPCODE(BIT_5_iIY_NN) { _BITM(0x20, RdByte(IY + (char)RdByte(PC - 2))); }
-OPCODE(BIT_6_iIY_NN) { _BITM(0x40, RdByte(IY + (char)RdByte(PC - 2))); }
-OPCODE(BIT_7_iIY_NN) { _BITM(0x80, RdByte(IY + (char)RdByte(PC - 2))); }
+OPCODE(BIT_0_A) { _BIT(CACHED_ 0x01, A); }
+OPCODE(BIT_1_A) { _BIT(CACHED_ 0x02, A); }
+OPCODE(BIT_2_A) { _BIT(CACHED_ 0x04, A); }
+OPCODE(BIT_3_A) { _BIT(CACHED_ 0x08, A); }
+OPCODE(BIT_4_A) { _BIT(CACHED_ 0x10, A); }
+OPCODE(BIT_5_A) { _BIT(CACHED_ 0x20, A); }
+OPCODE(BIT_6_A) { _BIT(CACHED_ 0x40, A); }
+OPCODE(BIT_7_A) { _BIT(CACHED_ 0x80, A); }
+
+OPCODE(BIT_0_B) { _BIT(CACHED_ 0x01, B); }
+OPCODE(BIT_1_B) { _BIT(CACHED_ 0x02, B); }
+OPCODE(BIT_2_B) { _BIT(CACHED_ 0x04, B); }
+OPCODE(BIT_3_B) { _BIT(CACHED_ 0x08, B); }
+OPCODE(BIT_4_B) { _BIT(CACHED_ 0x10, B); }
+OPCODE(BIT_5_B) { _BIT(CACHED_ 0x20, B); }
+OPCODE(BIT_6_B) { _BIT(CACHED_ 0x40, B); }
+OPCODE(BIT_7_B) { _BIT(CACHED_ 0x80, B); }
+
+OPCODE(BIT_0_C) { _BIT(CACHED_ 0x01, C); }
+OPCODE(BIT_1_C) { _BIT(CACHED_ 0x02, C); }
+OPCODE(BIT_2_C) { _BIT(CACHED_ 0x04, C); }
+OPCODE(BIT_3_C) { _BIT(CACHED_ 0x08, C); }
+OPCODE(BIT_4_C) { _BIT(CACHED_ 0x10, C); }
+OPCODE(BIT_5_C) { _BIT(CACHED_ 0x20, C); }
+OPCODE(BIT_6_C) { _BIT(CACHED_ 0x40, C); }
+OPCODE(BIT_7_C) { _BIT(CACHED_ 0x80, C); }
+
+OPCODE(BIT_0_D) { _BIT(CACHED_ 0x01, D); }
+OPCODE(BIT_1_D) { _BIT(CACHED_ 0x02, D); }
+OPCODE(BIT_2_D) { _BIT(CACHED_ 0x04, D); }
+OPCODE(BIT_3_D) { _BIT(CACHED_ 0x08, D); }
+OPCODE(BIT_4_D) { _BIT(CACHED_ 0x10, D); }
+OPCODE(BIT_5_D) { _BIT(CACHED_ 0x20, D); }
+OPCODE(BIT_6_D) { _BIT(CACHED_ 0x40, D); }
+OPCODE(BIT_7_D) { _BIT(CACHED_ 0x80, D); }
+
+OPCODE(BIT_0_E) { _BIT(CACHED_ 0x01, E); }
+OPCODE(BIT_1_E) { _BIT(CACHED_ 0x02, E); }
+OPCODE(BIT_2_E) { _BIT(CACHED_ 0x04, E); }
+OPCODE(BIT_3_E) { _BIT(CACHED_ 0x08, E); }
+OPCODE(BIT_4_E) { _BIT(CACHED_ 0x10, E); }
+OPCODE(BIT_5_E) { _BIT(CACHED_ 0x20, E); }
+OPCODE(BIT_6_E) { _BIT(CACHED_ 0x40, E); }
+OPCODE(BIT_7_E) { _BIT(CACHED_ 0x80, E); }
+
+OPCODE(BIT_0_H) { _BIT(CACHED_ 0x01, H); }
+OPCODE(BIT_1_H) { _BIT(CACHED_ 0x02, H); }
+OPCODE(BIT_2_H) { _BIT(CACHED_ 0x04, H); }
+OPCODE(BIT_3_H) { _BIT(CACHED_ 0x08, H); }
+OPCODE(BIT_4_H) { _BIT(CACHED_ 0x10, H); }
+OPCODE(BIT_5_H) { _BIT(CACHED_ 0x20, H); }
+OPCODE(BIT_6_H) { _BIT(CACHED_ 0x40, H); }
+OPCODE(BIT_7_H) { _BIT(CACHED_ 0x80, H); }
+
+OPCODE(BIT_0_L) { _BIT(CACHED_ 0x01, L); }
+OPCODE(BIT_1_L) { _BIT(CACHED_ 0x02, L); }
+OPCODE(BIT_2_L) { _BIT(CACHED_ 0x04, L); }
+OPCODE(BIT_3_L) { _BIT(CACHED_ 0x08, L); }
+OPCODE(BIT_4_L) { _BIT(CACHED_ 0x10, L); }
+OPCODE(BIT_5_L) { _BIT(CACHED_ 0x20, L); }
+OPCODE(BIT_6_L) { _BIT(CACHED_ 0x40, L); }
+OPCODE(BIT_7_L) { _BIT(CACHED_ 0x80, L); }
+
+OPCODE(BIT_0_iHL) { _BITM(CACHED_ 0x01, RdByte(HL)); }
+OPCODE(BIT_1_iHL) { _BITM(CACHED_ 0x02, RdByte(HL)); }
+OPCODE(BIT_2_iHL) { _BITM(CACHED_ 0x04, RdByte(HL)); }
+OPCODE(BIT_3_iHL) { _BITM(CACHED_ 0x08, RdByte(HL)); }
+OPCODE(BIT_4_iHL) { _BITM(CACHED_ 0x10, RdByte(HL)); }
+OPCODE(BIT_5_iHL) { _BITM(CACHED_ 0x20, RdByte(HL)); }
+OPCODE(BIT_6_iHL) { _BITM(CACHED_ 0x40, RdByte(HL)); }
+OPCODE(BIT_7_iHL) { _BITM(CACHED_ 0x80, RdByte(HL)); }
+
+OPCODE(BIT_0_iXY_NN) { _BITM(CACHED_ 0x01, RdByte(XY + (char)NN)); }
+OPCODE(BIT_1_iXY_NN) { _BITM(CACHED_ 0x02, RdByte(XY + (char)NN)); }
+OPCODE(BIT_2_iXY_NN) { _BITM(CACHED_ 0x04, RdByte(XY + (char)NN)); }
+OPCODE(BIT_3_iXY_NN) { _BITM(CACHED_ 0x08, RdByte(XY + (char)NN)); }
+OPCODE(BIT_4_iXY_NN) { _BITM(CACHED_ 0x10, RdByte(XY + (char)NN)); }
+OPCODE(BIT_5_iXY_NN) { _BITM(CACHED_ 0x20, RdByte(XY + (char)NN)); }
+OPCODE(BIT_6_iXY_NN) { _BITM(CACHED_ 0x40, RdByte(XY + (char)NN)); }
+OPCODE(BIT_7_iXY_NN) { _BITM(CACHED_ 0x80, RdByte(XY + (char)NN)); }
 
 #endif
 
@@ -2092,100 +2410,91 @@ OPCODE(BIT_7_iIY_NN) { _BITM(0x80, RdByte(IY + (char)RdByte(PC - 2))); }
 
 /* Reset (clear) one of 8 bits. */
 
-static inline void _RES(Byte bit, Byte *value)
+static INLINE void _RES(CACHE_ Byte bit, Byte *value)
 {
 	*value &= ~bit;
 }
 
-OPCODE(RES_0_A) { _RES(0x01, &A); }
-OPCODE(RES_1_A) { _RES(0x02, &A); }
-OPCODE(RES_2_A) { _RES(0x04, &A); }
-OPCODE(RES_3_A) { _RES(0x08, &A); }
-OPCODE(RES_4_A) { _RES(0x10, &A); }
-OPCODE(RES_5_A) { _RES(0x20, &A); }
-OPCODE(RES_6_A) { _RES(0x40, &A); }
-OPCODE(RES_7_A) { _RES(0x80, &A); }
-
-OPCODE(RES_0_B) { _RES(0x01, &B); }
-OPCODE(RES_1_B) { _RES(0x02, &B); }
-OPCODE(RES_2_B) { _RES(0x04, &B); }
-OPCODE(RES_3_B) { _RES(0x08, &B); }
-OPCODE(RES_4_B) { _RES(0x10, &B); }
-OPCODE(RES_5_B) { _RES(0x20, &B); }
-OPCODE(RES_6_B) { _RES(0x40, &B); }
-OPCODE(RES_7_B) { _RES(0x80, &B); }
-
-OPCODE(RES_0_C) { _RES(0x01, &C); }
-OPCODE(RES_1_C) { _RES(0x02, &C); }
-OPCODE(RES_2_C) { _RES(0x04, &C); }
-OPCODE(RES_3_C) { _RES(0x08, &C); }
-OPCODE(RES_4_C) { _RES(0x10, &C); }
-OPCODE(RES_5_C) { _RES(0x20, &C); }
-OPCODE(RES_6_C) { _RES(0x40, &C); }
-OPCODE(RES_7_C) { _RES(0x80, &C); }
-
-OPCODE(RES_0_D) { _RES(0x01, &D); }
-OPCODE(RES_1_D) { _RES(0x02, &D); }
-OPCODE(RES_2_D) { _RES(0x04, &D); }
-OPCODE(RES_3_D) { _RES(0x08, &D); }
-OPCODE(RES_4_D) { _RES(0x10, &D); }
-OPCODE(RES_5_D) { _RES(0x20, &D); }
-OPCODE(RES_6_D) { _RES(0x40, &D); }
-OPCODE(RES_7_D) { _RES(0x80, &D); }
-
-OPCODE(RES_0_E) { _RES(0x01, &E); }
-OPCODE(RES_1_E) { _RES(0x02, &E); }
-OPCODE(RES_2_E) { _RES(0x04, &E); }
-OPCODE(RES_3_E) { _RES(0x08, &E); }
-OPCODE(RES_4_E) { _RES(0x10, &E); }
-OPCODE(RES_5_E) { _RES(0x20, &E); }
-OPCODE(RES_6_E) { _RES(0x40, &E); }
-OPCODE(RES_7_E) { _RES(0x80, &E); }
-
-OPCODE(RES_0_H) { _RES(0x01, &H); }
-OPCODE(RES_1_H) { _RES(0x02, &H); }
-OPCODE(RES_2_H) { _RES(0x04, &H); }
-OPCODE(RES_3_H) { _RES(0x08, &H); }
-OPCODE(RES_4_H) { _RES(0x10, &H); }
-OPCODE(RES_5_H) { _RES(0x20, &H); }
-OPCODE(RES_6_H) { _RES(0x40, &H); }
-OPCODE(RES_7_H) { _RES(0x80, &H); }
-
-OPCODE(RES_0_L) { _RES(0x01, &L); }
-OPCODE(RES_1_L) { _RES(0x02, &L); }
-OPCODE(RES_2_L) { _RES(0x04, &L); }
-OPCODE(RES_3_L) { _RES(0x08, &L); }
-OPCODE(RES_4_L) { _RES(0x10, &L); }
-OPCODE(RES_5_L) { _RES(0x20, &L); }
-OPCODE(RES_6_L) { _RES(0x40, &L); }
-OPCODE(RES_7_L) { _RES(0x80, &L); }
-
-OPCODE(RES_0_iHL) { _RES(0x01, RwByte(HL)); }
-OPCODE(RES_1_iHL) { _RES(0x02, RwByte(HL)); }
-OPCODE(RES_2_iHL) { _RES(0x04, RwByte(HL)); }
-OPCODE(RES_3_iHL) { _RES(0x08, RwByte(HL)); }
-OPCODE(RES_4_iHL) { _RES(0x10, RwByte(HL)); }
-OPCODE(RES_5_iHL) { _RES(0x20, RwByte(HL)); }
-OPCODE(RES_6_iHL) { _RES(0x40, RwByte(HL)); }
-OPCODE(RES_7_iHL) { _RES(0x80, RwByte(HL)); }
-
-OPCODE(RES_0_iIX_NN) { _RES(0x01, RwByte(IX + (char)RdByte(PC - 2))); }
-OPCODE(RES_1_iIX_NN) { _RES(0x02, RwByte(IX + (char)RdByte(PC - 2))); }
-OPCODE(RES_2_iIX_NN) { _RES(0x04, RwByte(IX + (char)RdByte(PC - 2))); }
-OPCODE(RES_3_iIX_NN) { _RES(0x08, RwByte(IX + (char)RdByte(PC - 2))); }
-OPCODE(RES_4_iIX_NN) { _RES(0x10, RwByte(IX + (char)RdByte(PC - 2))); }
-OPCODE(RES_5_iIX_NN) { _RES(0x20, RwByte(IX + (char)RdByte(PC - 2))); }
-OPCODE(RES_6_iIX_NN) { _RES(0x40, RwByte(IX + (char)RdByte(PC - 2))); }
-OPCODE(RES_7_iIX_NN) { _RES(0x80, RwByte(IX + (char)RdByte(PC - 2))); }
-
-OPCODE(RES_0_iIY_NN) { _RES(0x01, RwByte(IY + (char)RdByte(PC - 2))); }
-OPCODE(RES_1_iIY_NN) { _RES(0x02, RwByte(IY + (char)RdByte(PC - 2))); }
-OPCODE(RES_2_iIY_NN) { _RES(0x04, RwByte(IY + (char)RdByte(PC - 2))); }
-OPCODE(RES_3_iIY_NN) { _RES(0x08, RwByte(IY + (char)RdByte(PC - 2))); }
-OPCODE(RES_4_iIY_NN) { _RES(0x10, RwByte(IY + (char)RdByte(PC - 2))); }
-OPCODE(RES_5_iIY_NN) { _RES(0x20, RwByte(IY + (char)RdByte(PC - 2))); }
-OPCODE(RES_6_iIY_NN) { _RES(0x40, RwByte(IY + (char)RdByte(PC - 2))); }
-OPCODE(RES_7_iIY_NN) { _RES(0x80, RwByte(IY + (char)RdByte(PC - 2))); }
+OPCODE(RES_0_A) { _RES(CACHED_ 0x01, &A); }
+OPCODE(RES_1_A) { _RES(CACHED_ 0x02, &A); }
+OPCODE(RES_2_A) { _RES(CACHED_ 0x04, &A); }
+OPCODE(RES_3_A) { _RES(CACHED_ 0x08, &A); }
+OPCODE(RES_4_A) { _RES(CACHED_ 0x10, &A); }
+OPCODE(RES_5_A) { _RES(CACHED_ 0x20, &A); }
+OPCODE(RES_6_A) { _RES(CACHED_ 0x40, &A); }
+OPCODE(RES_7_A) { _RES(CACHED_ 0x80, &A); }
+
+OPCODE(RES_0_B) { _RES(CACHED_ 0x01, &B); }
+OPCODE(RES_1_B) { _RES(CACHED_ 0x02, &B); }
+OPCODE(RES_2_B) { _RES(CACHED_ 0x04, &B); }
+OPCODE(RES_3_B) { _RES(CACHED_ 0x08, &B); }
+OPCODE(RES_4_B) { _RES(CACHED_ 0x10, &B); }
+OPCODE(RES_5_B) { _RES(CACHED_ 0x20, &B); }
+OPCODE(RES_6_B) { _RES(CACHED_ 0x40, &B); }
+OPCODE(RES_7_B) { _RES(CACHED_ 0x80, &B); }
+
+OPCODE(RES_0_C) { _RES(CACHED_ 0x01, &C); }
+OPCODE(RES_1_C) { _RES(CACHED_ 0x02, &C); }
+OPCODE(RES_2_C) { _RES(CACHED_ 0x04, &C); }
+OPCODE(RES_3_C) { _RES(CACHED_ 0x08, &C); }
+OPCODE(RES_4_C) { _RES(CACHED_ 0x10, &C); }
+OPCODE(RES_5_C) { _RES(CACHED_ 0x20, &C); }
+OPCODE(RES_6_C) { _RES(CACHED_ 0x40, &C); }
+OPCODE(RES_7_C) { _RES(CACHED_ 0x80, &C); }
+
+OPCODE(RES_0_D) { _RES(CACHED_ 0x01, &D); }
+OPCODE(RES_1_D) { _RES(CACHED_ 0x02, &D); }
+OPCODE(RES_2_D) { _RES(CACHED_ 0x04, &D); }
+OPCODE(RES_3_D) { _RES(CACHED_ 0x08, &D); }
+OPCODE(RES_4_D) { _RES(CACHED_ 0x10, &D); }
+OPCODE(RES_5_D) { _RES(CACHED_ 0x20, &D); }
+OPCODE(RES_6_D) { _RES(CACHED_ 0x40, &D); }
+OPCODE(RES_7_D) { _RES(CACHED_ 0x80, &D); }
+
+OPCODE(RES_0_E) { _RES(CACHED_ 0x01, &E); }
+OPCODE(RES_1_E) { _RES(CACHED_ 0x02, &E); }
+OPCODE(RES_2_E) { _RES(CACHED_ 0x04, &E); }
+OPCODE(RES_3_E) { _RES(CACHED_ 0x08, &E); }
+OPCODE(RES_4_E) { _RES(CACHED_ 0x10, &E); }
+OPCODE(RES_5_E) { _RES(CACHED_ 0x20, &E); }
+OPCODE(RES_6_E) { _RES(CACHED_ 0x40, &E); }
+OPCODE(RES_7_E) { _RES(CACHED_ 0x80, &E); }
+
+OPCODE(RES_0_H) { _RES(CACHED_ 0x01, &H); }
+OPCODE(RES_1_H) { _RES(CACHED_ 0x02, &H); }
+OPCODE(RES_2_H) { _RES(CACHED_ 0x04, &H); }
+OPCODE(RES_3_H) { _RES(CACHED_ 0x08, &H); }
+OPCODE(RES_4_H) { _RES(CACHED_ 0x10, &H); }
+OPCODE(RES_5_H) { _RES(CACHED_ 0x20, &H); }
+OPCODE(RES_6_H) { _RES(CACHED_ 0x40, &H); }
+OPCODE(RES_7_H) { _RES(CACHED_ 0x80, &H); }
+
+OPCODE(RES_0_L) { _RES(CACHED_ 0x01, &L); }
+OPCODE(RES_1_L) { _RES(CACHED_ 0x02, &L); }
+OPCODE(RES_2_L) { _RES(CACHED_ 0x04, &L); }
+OPCODE(RES_3_L) { _RES(CACHED_ 0x08, &L); }
+OPCODE(RES_4_L) { _RES(CACHED_ 0x10, &L); }
+OPCODE(RES_5_L) { _RES(CACHED_ 0x20, &L); }
+OPCODE(RES_6_L) { _RES(CACHED_ 0x40, &L); }
+OPCODE(RES_7_L) { _RES(CACHED_ 0x80, &L); }
+
+OPCODE(RES_0_iHL) { _RES(CACHED_ 0x01, RwByte(HL)); }
+OPCODE(RES_1_iHL) { _RES(CACHED_ 0x02, RwByte(HL)); }
+OPCODE(RES_2_iHL) { _RES(CACHED_ 0x04, RwByte(HL)); }
+OPCODE(RES_3_iHL) { _RES(CACHED_ 0x08, RwByte(HL)); }
+OPCODE(RES_4_iHL) { _RES(CACHED_ 0x10, RwByte(HL)); }
+OPCODE(RES_5_iHL) { _RES(CACHED_ 0x20, RwByte(HL)); }
+OPCODE(RES_6_iHL) { _RES(CACHED_ 0x40, RwByte(HL)); }
+OPCODE(RES_7_iHL) { _RES(CACHED_ 0x80, RwByte(HL)); }
+
+OPCODE(RES_0_iXY_NN) { _RES(CACHED_ 0x01, RwByte(XY + (char)NN)); }
+OPCODE(RES_1_iXY_NN) { _RES(CACHED_ 0x02, RwByte(XY + (char)NN)); }
+OPCODE(RES_2_iXY_NN) { _RES(CACHED_ 0x04, RwByte(XY + (char)NN)); }
+OPCODE(RES_3_iXY_NN) { _RES(CACHED_ 0x08, RwByte(XY + (char)NN)); }
+OPCODE(RES_4_iXY_NN) { _RES(CACHED_ 0x10, RwByte(XY + (char)NN)); }
+OPCODE(RES_5_iXY_NN) { _RES(CACHED_ 0x20, RwByte(XY + (char)NN)); }
+OPCODE(RES_6_iXY_NN) { _RES(CACHED_ 0x40, RwByte(XY + (char)NN)); }
+OPCODE(RES_7_iXY_NN) { _RES(CACHED_ 0x80, RwByte(XY + (char)NN)); }
 
 #endif
 
@@ -2193,141 +2502,212 @@ OPCODE(RES_7_iIY_NN) { _RES(0x80, RwByte(IY + (char)RdByte(PC - 2))); }
 
 /* Set one of 8 bits. */
 
-static inline void _SET(Byte bit, Byte *value)
+static INLINE void _SET(CACHE_ Byte bit, Byte *value)
 {
 	*value |= bit;
 }
 
-OPCODE(SET_0_A) { _SET(0x01, &A); }
-OPCODE(SET_1_A) { _SET(0x02, &A); }
-OPCODE(SET_2_A) { _SET(0x04, &A); }
-OPCODE(SET_3_A) { _SET(0x08, &A); }
-OPCODE(SET_4_A) { _SET(0x10, &A); }
-OPCODE(SET_5_A) { _SET(0x20, &A); }
-OPCODE(SET_6_A) { _SET(0x40, &A); }
-OPCODE(SET_7_A) { _SET(0x80, &A); }
-
-OPCODE(SET_0_B) { _SET(0x01, &B); }
-OPCODE(SET_1_B) { _SET(0x02, &B); }
-OPCODE(SET_2_B) { _SET(0x04, &B); }
-OPCODE(SET_3_B) { _SET(0x08, &B); }
-OPCODE(SET_4_B) { _SET(0x10, &B); }
-OPCODE(SET_5_B) { _SET(0x20, &B); }
-OPCODE(SET_6_B) { _SET(0x40, &B); }
-OPCODE(SET_7_B) { _SET(0x80, &B); }
-
-OPCODE(SET_0_C) { _SET(0x01, &C); }
-OPCODE(SET_1_C) { _SET(0x02, &C); }
-OPCODE(SET_2_C) { _SET(0x04, &C); }
-OPCODE(SET_3_C) { _SET(0x08, &C); }
-OPCODE(SET_4_C) { _SET(0x10, &C); }
-OPCODE(SET_5_C) { _SET(0x20, &C); }
-OPCODE(SET_6_C) { _SET(0x40, &C); }
-OPCODE(SET_7_C) { _SET(0x80, &C); }
-
-OPCODE(SET_0_D) { _SET(0x01, &D); }
-OPCODE(SET_1_D) { _SET(0x02, &D); }
-OPCODE(SET_2_D) { _SET(0x04, &D); }
-OPCODE(SET_3_D) { _SET(0x08, &D); }
-OPCODE(SET_4_D) { _SET(0x10, &D); }
-OPCODE(SET_5_D) { _SET(0x20, &D); }
-OPCODE(SET_6_D) { _SET(0x40, &D); }
-OPCODE(SET_7_D) { _SET(0x80, &D); }
-
-OPCODE(SET_0_E) { _SET(0x01, &E); }
-OPCODE(SET_1_E) { _SET(0x02, &E); }
-OPCODE(SET_2_E) { _SET(0x04, &E); }
-OPCODE(SET_3_E) { _SET(0x08, &E); }
-OPCODE(SET_4_E) { _SET(0x10, &E); }
-OPCODE(SET_5_E) { _SET(0x20, &E); }
-OPCODE(SET_6_E) { _SET(0x40, &E); }
-OPCODE(SET_7_E) { _SET(0x80, &E); }
-
-OPCODE(SET_0_H) { _SET(0x01, &H); }
-OPCODE(SET_1_H) { _SET(0x02, &H); }
-OPCODE(SET_2_H) { _SET(0x04, &H); }
-OPCODE(SET_3_H) { _SET(0x08, &H); }
-OPCODE(SET_4_H) { _SET(0x10, &H); }
-OPCODE(SET_5_H) { _SET(0x20, &H); }
-OPCODE(SET_6_H) { _SET(0x40, &H); }
-OPCODE(SET_7_H) { _SET(0x80, &H); }
-
-OPCODE(SET_0_L) { _SET(0x01, &L); }
-OPCODE(SET_1_L) { _SET(0x02, &L); }
-OPCODE(SET_2_L) { _SET(0x04, &L); }
-OPCODE(SET_3_L) { _SET(0x08, &L); }
-OPCODE(SET_4_L) { _SET(0x10, &L); }
-OPCODE(SET_5_L) { _SET(0x20, &L); }
-OPCODE(SET_6_L) { _SET(0x40, &L); }
-OPCODE(SET_7_L) { _SET(0x80, &L); }
-
-OPCODE(SET_0_iHL) { _SET(0x01, RwByte(HL)); }
-OPCODE(SET_1_iHL) { _SET(0x02, RwByte(HL)); }
-OPCODE(SET_2_iHL) { _SET(0x04, RwByte(HL)); }
-OPCODE(SET_3_iHL) { _SET(0x08, RwByte(HL)); }
-OPCODE(SET_4_iHL) { _SET(0x10, RwByte(HL)); }
-OPCODE(SET_5_iHL) { _SET(0x20, RwByte(HL)); }
-OPCODE(SET_6_iHL) { _SET(0x40, RwByte(HL)); }
-OPCODE(SET_7_iHL) { _SET(0x80, RwByte(HL)); }
-
-OPCODE(SET_0_iIX_NN) { _SET(0x01, RwByte(IX + (char)RdByte(PC - 2))); }
-OPCODE(SET_1_iIX_NN) { _SET(0x02, RwByte(IX + (char)RdByte(PC - 2))); }
-OPCODE(SET_2_iIX_NN) { _SET(0x04, RwByte(IX + (char)RdByte(PC - 2))); }
-OPCODE(SET_3_iIX_NN) { _SET(0x08, RwByte(IX + (char)RdByte(PC - 2))); }
-OPCODE(SET_4_iIX_NN) { _SET(0x10, RwByte(IX + (char)RdByte(PC - 2))); }
-OPCODE(SET_5_iIX_NN) { _SET(0x20, RwByte(IX + (char)RdByte(PC - 2))); }
-OPCODE(SET_6_iIX_NN) { _SET(0x40, RwByte(IX + (char)RdByte(PC - 2))); }
-OPCODE(SET_7_iIX_NN) { _SET(0x80, RwByte(IX + (char)RdByte(PC - 2))); }
-
-OPCODE(SET_0_iIY_NN) { _SET(0x01, RwByte(IY + (char)RdByte(PC - 2))); }
-OPCODE(SET_1_iIY_NN) { _SET(0x02, RwByte(IY + (char)RdByte(PC - 2))); }
-OPCODE(SET_2_iIY_NN) { _SET(0x04, RwByte(IY + (char)RdByte(PC - 2))); }
-OPCODE(SET_3_iIY_NN) { _SET(0x08, RwByte(IY + (char)RdByte(PC - 2))); }
-OPCODE(SET_4_iIY_NN) { _SET(0x10, RwByte(IY + (char)RdByte(PC - 2))); }
-OPCODE(SET_5_iIY_NN) { _SET(0x20, RwByte(IY + (char)RdByte(PC - 2))); }
-OPCODE(SET_6_iIY_NN) { _SET(0x40, RwByte(IY + (char)RdByte(PC - 2))); }
-OPCODE(SET_7_iIY_NN) { _SET(0x80, RwByte(IY + (char)RdByte(PC - 2))); }
+OPCODE(SET_0_A) { _SET(CACHED_ 0x01, &A); }
+OPCODE(SET_1_A) { _SET(CACHED_ 0x02, &A); }
+OPCODE(SET_2_A) { _SET(CACHED_ 0x04, &A); }
+OPCODE(SET_3_A) { _SET(CACHED_ 0x08, &A); }
+OPCODE(SET_4_A) { _SET(CACHED_ 0x10, &A); }
+OPCODE(SET_5_A) { _SET(CACHED_ 0x20, &A); }
+OPCODE(SET_6_A) { _SET(CACHED_ 0x40, &A); }
+OPCODE(SET_7_A) { _SET(CACHED_ 0x80, &A); }
+
+OPCODE(SET_0_B) { _SET(CACHED_ 0x01, &B); }
+OPCODE(SET_1_B) { _SET(CACHED_ 0x02, &B); }
+OPCODE(SET_2_B) { _SET(CACHED_ 0x04, &B); }
+OPCODE(SET_3_B) { _SET(CACHED_ 0x08, &B); }
+OPCODE(SET_4_B) { _SET(CACHED_ 0x10, &B); }
+OPCODE(SET_5_B) { _SET(CACHED_ 0x20, &B); }
+OPCODE(SET_6_B) { _SET(CACHED_ 0x40, &B); }
+OPCODE(SET_7_B) { _SET(CACHED_ 0x80, &B); }
+
+OPCODE(SET_0_C) { _SET(CACHED_ 0x01, &C); }
+OPCODE(SET_1_C) { _SET(CACHED_ 0x02, &C); }
+OPCODE(SET_2_C) { _SET(CACHED_ 0x04, &C); }
+OPCODE(SET_3_C) { _SET(CACHED_ 0x08, &C); }
+OPCODE(SET_4_C) { _SET(CACHED_ 0x10, &C); }
+OPCODE(SET_5_C) { _SET(CACHED_ 0x20, &C); }
+OPCODE(SET_6_C) { _SET(CACHED_ 0x40, &C); }
+OPCODE(SET_7_C) { _SET(CACHED_ 0x80, &C); }
+
+OPCODE(SET_0_D) { _SET(CACHED_ 0x01, &D); }
+OPCODE(SET_1_D) { _SET(CACHED_ 0x02, &D); }
+OPCODE(SET_2_D) { _SET(CACHED_ 0x04, &D); }
+OPCODE(SET_3_D) { _SET(CACHED_ 0x08, &D); }
+OPCODE(SET_4_D) { _SET(CACHED_ 0x10, &D); }
+OPCODE(SET_5_D) { _SET(CACHED_ 0x20, &D); }
+OPCODE(SET_6_D) { _SET(CACHED_ 0x40, &D); }
+OPCODE(SET_7_D) { _SET(CACHED_ 0x80, &D); }
+
+OPCODE(SET_0_E) { _SET(CACHED_ 0x01, &E); }
+OPCODE(SET_1_E) { _SET(CACHED_ 0x02, &E); }
+OPCODE(SET_2_E) { _SET(CACHED_ 0x04, &E); }
+OPCODE(SET_3_E) { _SET(CACHED_ 0x08, &E); }
+OPCODE(SET_4_E) { _SET(CACHED_ 0x10, &E); }
+OPCODE(SET_5_E) { _SET(CACHED_ 0x20, &E); }
+OPCODE(SET_6_E) { _SET(CACHED_ 0x40, &E); }
+OPCODE(SET_7_E) { _SET(CACHED_ 0x80, &E); }
+
+OPCODE(SET_0_H) { _SET(CACHED_ 0x01, &H); }
+OPCODE(SET_1_H) { _SET(CACHED_ 0x02, &H); }
+OPCODE(SET_2_H) { _SET(CACHED_ 0x04, &H); }
+OPCODE(SET_3_H) { _SET(CACHED_ 0x08, &H); }
+OPCODE(SET_4_H) { _SET(CACHED_ 0x10, &H); }
+OPCODE(SET_5_H) { _SET(CACHED_ 0x20, &H); }
+OPCODE(SET_6_H) { _SET(CACHED_ 0x40, &H); }
+OPCODE(SET_7_H) { _SET(CACHED_ 0x80, &H); }
+
+OPCODE(SET_0_L) { _SET(CACHED_ 0x01, &L); }
+OPCODE(SET_1_L) { _SET(CACHED_ 0x02, &L); }
+OPCODE(SET_2_L) { _SET(CACHED_ 0x04, &L); }
+OPCODE(SET_3_L) { _SET(CACHED_ 0x08, &L); }
+OPCODE(SET_4_L) { _SET(CACHED_ 0x10, &L); }
+OPCODE(SET_5_L) { _SET(CACHED_ 0x20, &L); }
+OPCODE(SET_6_L) { _SET(CACHED_ 0x40, &L); }
+OPCODE(SET_7_L) { _SET(CACHED_ 0x80, &L); }
+
+OPCODE(SET_0_iHL) { _SET(CACHED_ 0x01, RwByte(HL)); }
+OPCODE(SET_1_iHL) { _SET(CACHED_ 0x02, RwByte(HL)); }
+OPCODE(SET_2_iHL) { _SET(CACHED_ 0x04, RwByte(HL)); }
+OPCODE(SET_3_iHL) { _SET(CACHED_ 0x08, RwByte(HL)); }
+OPCODE(SET_4_iHL) { _SET(CACHED_ 0x10, RwByte(HL)); }
+OPCODE(SET_5_iHL) { _SET(CACHED_ 0x20, RwByte(HL)); }
+OPCODE(SET_6_iHL) { _SET(CACHED_ 0x40, RwByte(HL)); }
+OPCODE(SET_7_iHL) { _SET(CACHED_ 0x80, RwByte(HL)); }
+
+OPCODE(SET_0_iXY_NN) { _SET(CACHED_ 0x01, RwByte(XY + (char)NN)); }
+OPCODE(SET_1_iXY_NN) { _SET(CACHED_ 0x02, RwByte(XY + (char)NN)); }
+OPCODE(SET_2_iXY_NN) { _SET(CACHED_ 0x04, RwByte(XY + (char)NN)); }
+OPCODE(SET_3_iXY_NN) { _SET(CACHED_ 0x08, RwByte(XY + (char)NN)); }
+OPCODE(SET_4_iXY_NN) { _SET(CACHED_ 0x10, RwByte(XY + (char)NN)); }
+OPCODE(SET_5_iXY_NN) { _SET(CACHED_ 0x20, RwByte(XY + (char)NN)); }
+OPCODE(SET_6_iXY_NN) { _SET(CACHED_ 0x40, RwByte(XY + (char)NN)); }
+OPCODE(SET_7_iXY_NN) { _SET(CACHED_ 0x80, RwByte(XY + (char)NN)); }
 
 #endif
 
 /**********************************************************************/
 #pragma mark OPERATION TABLE
 
-typedef void (*operation_t)(void);
+typedef void (*operation_t)(CACHE_ unsigned long fetch, WordBytes *xy);
+
+/* The length tables give the bytes RdFetch() reads from an opcode on */
+/* where it cannot read four at once. CODE spells out two hex digits */
+/* per instruction byte; the prefix tables leave out the prefix, and */
+/* DDCB and FDCB are fetched from the CB on. */
+#define OPERATION(INDEX, CODE, JMP, N8080, NZ80, F8080, FZ80, T8080, TZ80) \
+	sizeof(#CODE) / 2 - PREFIX,
+
+#define PREFIX 0
+static const Byte length[256] = {
+#include "op.h"
+};
+#undef PREFIX
 
 #ifdef Z80
 
-#define OPERATION(INDEX, CODE, JMP, N8080, NZ80, F8080, FZ80) FZ80,
+#define PREFIX 1
 
-static operation_t operation_DDCB[256] = {
+static const Byte length_DDCB[256] = {
 #include "opddcb.h"
 };
-OPCODE(DDCB_OP) { PC++; (*operation_DDCB[RdByte(PC++)])(); }
 
-static operation_t operation_DD[256] = {
+static const Byte length_DD[256] = {
 #include "opdd.h"
 };
-OPCODE(DD_OP) { (*operation_DD[RdByte(PC++)])(); }
 
-static operation_t operation_FDCB[256] = {
-#include "opfdcb.h"
+static const Byte length_CB[256] = {
+#include "opcb.h"
 };
-OPCODE(FDCB_OP) { PC++; (*operation_FDCB[RdByte(PC++)])(); }
 
-static operation_t operation_FD[256] = {
-#include "opfd.h"
+static const Byte length_ED[256] = {
+#include "oped.h"
+};
+
+#undef PREFIX
+
+#endif
+
+#undef OPERATION
+
+/* DISPATCH() fetches an instruction, counts its T-states and executes */
+/* it. EXECUTE() counts and executes an opcode already fetched. */
+/* The prefix tables (CB, DD ...) count the prefix, so op.h gives 0. */
+/* DISPATCH_XY() hands the DD table the index register to work on. */
+#define DISPATCH(TABLE) DISPATCH_XY(TABLE, 0)
+
+#define DISPATCH_XY(TABLE, POINTER) \
+	do { \
+		unsigned long fetched = RdFetch(PC++, length##TABLE); \
+		EXECUTE(TABLE, (Byte)fetched, fetched, POINTER); \
+	} while (0)
+
+#define EXECUTE(TABLE, INDEX, FETCH, POINTER) \
+	do { \
+		CYCLES += cycles##TABLE[INDEX]; \
+		(*operation##TABLE[INDEX])(CACHED_ FETCH, POINTER); \
+	} while (0)
+
+/* DDCB and FDCB put the displacement ahead of the opcode. */
+#define DISPATCH_INDEXED(TABLE) \
+	do { \
+		unsigned long fetched = RdFetch(PC - 1, length##TABLE); \
+		PC += 2; \
+		EXECUTE(TABLE, (Byte)(fetched >> 16), fetched, xy); \
+	} while (0)
+
+#ifdef Z80
+
+#define OPERATION(INDEX, CODE, JMP, N8080, NZ80, F8080, FZ80, T8080, TZ80) TZ80,
+
+static const Byte cycles_DDCB[256] = {
+#include "opddcb.h"
+};
+
+static const Byte cycles_DD[256] = {
+#include "opdd.h"
+};
+
+static const Byte cycles_CB[256] = {
+#include "opcb.h"
 };
-OPCODE(FD_OP) { (*operation_FD[RdByte(PC++)])(); }
+
+static const Byte cycles_ED[256] = {
+#include "oped.h"
+};
+
+static const Byte cycles[256] = {
+#include "op.h"
+};
+
+#undef OPERATION
+#define OPERATION(INDEX, CODE, JMP, N8080, NZ80, F8080, FZ80, T8080, TZ80) FZ80,
+
+/* FD dispatches through the DD tables, see XY. */
+static operation_t operation_DDCB[256] = {
+#include "opddcb.h"
+};
+OPCODE(XYCB_OP) { DISPATCH_INDEXED(_DDCB); }
+
+static operation_t operation_DD[256] = {
+#include "opdd.h"
+};
+OPCODE(DD_OP) { DISPATCH_XY(_DD, &gCpuState.ix); }
+OPCODE(FD_OP) { DISPATCH_XY(_DD, &gCpuState.iy); }
 
 static operation_t operation_CB[256] = {
 #include "opcb.h"
 };
-OPCODE(CB_OP) { (*operation_CB[RdByte(PC++)])(); }
+OPCODE(CB_OP) { DISPATCH(_CB); }
 
 static operation_t operation_ED[256] = {
 #include "oped.h"
 };
-OPCODE(ED_OP) { (*operation_ED[RdByte(PC++)])(); }
+OPCODE(ED_OP) { DISPATCH(_ED); }
 
 static operation_t operation[256] = {
 #include "op.h"
@@ -2335,7 +2715,14 @@ static operation_t operation[256] = {
 
 #else
 
-#define OPERATION(INDEX, CODE, JMP, N8080, NZ80, F8080, FZ80) F8080,
+#define OPERATION(INDEX, CODE, JMP, N8080, NZ80, F8080, FZ80, T8080, TZ80) T8080,
+
+static const Byte cycles[256] = {
+#include "op.h"
+};
+
+#undef OPERATION
+#define OPERATION(INDEX, CODE, JMP, N8080, NZ80, F8080, FZ80, T8080, TZ80) F8080,
 
 static operation_t operation[256] = {
 #include "op.h"
@@ -2343,19 +2730,2003 @@ static operation_t operation[256] = {
 
 #endif
 
+#undef OPERATION
+
+#if defined(BLOCK_CACHE) && !defined(THREADED) && !defined(JIT)
+
+/* A fused handler runs both instructions of a pair of opfuse.h from */
+/* one block record, see FuseBlockOps(), and counts the second as */
+/* RunBlock() counts the records. Neither instruction has operands. */
+#define FUSE(FIRST, SECOND, F1, F2) \
+	OPCODE(F1##__##F2) \
+	{ \
+		F1(CACHED_ fetch, xy); \
+		PC++; \
+		F2(CACHED_ fetch >> 8, xy); \
+		gCheckForInterrupts++; \
+	}
+#include "opfuse.h"
+#undef FUSE
+
+#define FUSE(FIRST, SECOND, F1, F2) F1##__##F2,
+static const operation_t operation_FUSE[] = {
+#include "opfuse.h"
+};
+#undef FUSE
+
+#endif
+
+#ifdef CACHED_REGISTERS
+#undef REGISTERS
+#define REGISTERS gCpuState
+#undef RdByte
+#undef WrByte
+#undef RwByte
+#undef RdFetch
+#endif
+
 void InitCpuToMonitor(void)
 {
-  MonitorFlags(&gCpuState);
+  MonitorFlags(GetCpuState());
 }
 
-void Cpu(void)
+/* CpuSnapshot() saves or loads the CPU state. The INT line is */
+/* raised again by SystemSnapshot(), and MemorySnapshot() makes */
+/* the block cache forget the old code. */
+void CpuSnapshot(SnapshotPtr s)
 {
 
-#ifdef CALCULATE_TABLES
-	CalculateTables();
+	SnapshotValue(s, *GetCpuState());
+	SnapshotValue(s, gEIDelay);
+
+#ifdef REVERSE
+	/* The history did not lead up to the loaded state. */
+	if (s->isLoad)
+		CpuHistory(CpuHistorySize());
+#endif
+
+}
+
+#ifdef REVERSE
+
+/**********************************************************************/
+#pragma mark HISTORY
+
+/* gHistory[] is a ring of gHistoryMask + 1 records, non-zero while a
+ * history is kept. gHistoryCount counts every record ever added, the
+ * records from gHistoryFirst on lead up to the current state. Each
+ * record holds the state before an instruction, and the undo log
+ * count, so that undoing the log back to it undoes the instruction
+ * and all that followed. Remember() is all Cpu() does per instruction,
+ * so a record is kept to 48 bytes: gEIDelay, 0 or 1, shares a word
+ * with the undo log count.
+ */
+typedef struct History History;
+
+struct History {
+	CpuState state;
+	unsigned long long undo : 63;
+	unsigned long long eiDelay : 1;
+};
+
+static MACHINE History *gHistory;
+static MACHINE unsigned long gHistoryMask;
+static MACHINE unsigned long long gHistoryCount;
+static MACHINE unsigned long long gHistoryFirst;
+
+/* Remember() adds the state before the next instruction. */
+static inline void Remember(void)
+{
+	History *h = &gHistory[gHistoryCount++ & gHistoryMask];
+
+	h->state = *GetCpuState();
+	h->undo = gUndoCount;
+	h->eiDelay = gEIDelay;
+
+}
+
+/* HistoryAt() returns the record n instructions back. */
+static inline History *HistoryAt(unsigned long n)
+{
+
+	return &gHistory[(gHistoryCount - n) & gHistoryMask];
+
+}
+
+/* CpuHistory() keeps a history of at least size instructions, or */
+/* none if size is zero. Returns zero if there was an error. */
+int CpuHistory(unsigned long size)
+{
+	unsigned long entries = 1;
+
+	free(gHistory);
+	gHistory = 0;
+	gHistoryMask = 0;
+	gHistoryCount = gHistoryFirst = 0;
+
+	/* As many writes are logged as instructions are kept. */
+	if (!OpenUndo(size))
+		goto error;
+	if (size == 0)
+		return 1;
+
+	while (entries < size)
+		entries <<= 1;
+	if ((gHistory = malloc(entries * sizeof(History))) == 0) {
+		OpenUndo(0);
+		goto error;
+	}
+	gHistoryMask = entries - 1;
+
+	/* All done, no error, return non-zero. */
+	return 1;
+
+	/* Return zero if there was an error. */
+error:
+	return 0;
+
+}
+
+/* CpuHistorySize() returns the number of instructions kept. */
+unsigned long CpuHistorySize(void)
+{
+
+	return (gHistory == 0) ? 0 : gHistoryMask + 1;
+
+}
+
+/* CpuHistoryDepth() returns the number of instructions that can */
+/* be rewound. The oldest records may need writes that the undo */
+/* log has already lost; the undo counts only grow, so the first */
+/* record still covered by the log is found by a binary search. */
+unsigned long CpuHistoryDepth(void)
+{
+	unsigned long long kept = gHistoryCount - gHistoryFirst;
+	unsigned long low = 0;
+	unsigned long high;
+	unsigned long n;
+
+	if (gHistory == 0)
+		return 0;
+
+	high = (kept > gHistoryMask) ? gHistoryMask + 1 : (unsigned long)kept;
+	while (low < high) {
+		n = high - (high - low) / 2;
+		if (gUndoCount - HistoryAt(n)->undo <= gUndoMask + 1)
+			low = n;
+		else
+			high = n - 1;
+	}
+
+	return low;
+
+}
+
+/* CpuHistoryState() returns the state n instructions back. */
+CpuStatePtr CpuHistoryState(unsigned long n)
+{
+
+	if ((n == 0) || (n > CpuHistoryDepth()))
+		return 0;
+
+	return &HistoryAt(n)->state;
+
+}
+
+/* CpuBackstep() rewinds the CPU and memory n instructions. */
+/* Returns zero if they are not all in the history. */
+int CpuBackstep(unsigned long n)
+{
+	History *h;
+
+	if ((n == 0) || (n > CpuHistoryDepth()))
+		return 0;
+
+	h = HistoryAt(n);
+	if (!UndoWrites(h->undo))
+		return 0;
+
+	/* GetCpuState() drops any pending F before it is replaced. */
+	*GetCpuState() = h->state;
+	gEIDelay = h->eiDelay;
+	UpdateINT();
+
+	/* The instructions rewound will be remembered again. */
+	gHistoryCount -= n;
+
+	return 1;
+
+}
+
+#endif
+
+/**********************************************************************/
+#pragma mark INTERRUPTS
+
+/* CpuInterrupt() asserts (level != 0) or releases the INT line. */
+/* The vector is the byte on the data bus when INT is accepted. */
+void CpuInterrupt(int level, Byte vector)
+{
+
+	gINT = (level != 0);
+	gINTVector = vector;
+	UpdateINT();
+
+}
+
+/* CpuNMI() signals a non-maskable interrupt (Z80 only). */
+void CpuNMI(void)
+{
+
+	SetSystemFlags(kSystemNMI, 0);
+
+}
+
+/* CpuCurrentState() returns the CPU state; it is up to date when */
+/* Cpu() polls the system (see GetSystemFlags()) or stops. */
+CpuStatePtr CpuCurrentState(void)
+{
+
+	return &gCpuState;
+
+}
+
+/* Vector() pushes PC and jumps to pc, as RST does. Interrupt() */
+/* runs on gCpuState, not the handlers' cache. */
+static void Vector(Word pc)
+{
+
+	WrByte(--SP, PC_H);
+	WrByte(--SP, PC_L);
+	PC = pc;
+
+}
+
+/* Interrupt() accepts an NMI, or an INT unless EI has just been */
+/* executed. A HALT waiting for the interrupt is left behind. */
+/* IM 0 (and the i8080) only take an RST instruction from the bus. */
+static void Interrupt(void)
+{
+#ifdef Z80
+	WordBytes x;
+	WordBytes y;
+#endif
+
+	if (gSystemFlags & kSystemNMI) {
+		SetSystemFlags(0, kSystemNMI);
+#ifdef Z80
+		IFF1 = 0;
+		UpdateINT();
+		PC += HALTED;
+		HALTED = 0;
+		Vector(0x0066);
+		CYCLES += 11;
+#endif
+		return;
+	}
+
+	/* No INT is taken before the instruction after EI, not even */
+	/* one raised since EI ran. */
+	if (gEIDelay) {
+		gEIDelay = 0;
+		UpdateINT();
+		return;
+	}
+
+	if (!IFF1) {
+		UpdateINT();
+		return;
+	}
+
+	IFF1 = IFF2 = 0;
+	UpdateINT();
+	PC += HALTED;
+	HALTED = 0;
+
+#ifdef Z80
+	switch (IM) {
+	case 2:
+		x.word = (Word)((I << 8) | gINTVector);
+		y.byte.low = RdByte(x.word);
+		y.byte.high = RdByte(x.word + 1);
+		Vector(y.word);
+		CYCLES += 19;
+		return;
+	case 1:
+		Vector(0x0038);
+		CYCLES += 13;
+		return;
+	}
+	Vector(gINTVector & 0x38);
+	CYCLES += 13;
+#else
+	Vector(gINTVector & 0x38);
+	CYCLES += 11;
+#endif
+
+}
+
+/* AtBreak() returns non-zero if there is a breakpoint at PC. */
+static inline int AtBreak(void)
+{
+
+	return (gBreakCount > 0) && IsBreak(PC);
+
+}
+
+/* CpuBreakFlags() calls MonitorFlags() at a breakpoint, and */
+/* returns non-zero if Cpu() should return. */
+static inline Byte CpuBreakFlags(void)
+{
+
+	if (!AtBreak())
+		return 0;
+
+	return MonitorFlags(GetCpuState());
+
+}
+
+/* CpuFlags() handles the system flags before an instruction. It */
+/* takes any interrupt, then passes the other flags on to */
+/* MonitorFlags(), and returns non-zero if Cpu() should return. */
+static Byte CpuFlags(void)
+{
+	Byte stop;
+
+	if (gSystemFlags & (kSystemINT | kSystemNMI))
+		Interrupt();
+
+	if (!(gSystemFlags & ~(kSystemINT | kSystemNMI)))
+		stop = CpuBreakFlags();
+	else
+		stop = MonitorFlags(GetCpuState());
+
+#ifdef REVERSE
+	/* Remember the state once the instruction is sure to run. */
+	if (!stop && (gHistory != 0))
+		Remember();
+#endif
+
+	return stop;
+
+}
+
+/* CpuStep() is checked before every block, and returns non-zero if */
+/* the next instruction must be stepped through CpuFlags(): while a */
+/* system flag is set, at a breakpoint, or while history is kept. */
+#ifdef REVERSE
+#define CpuStep() (GetSystemFlags() || AtBreak() || (gHistory != 0))
+#else
+#define CpuStep() (GetSystemFlags() || AtBreak())
+#endif
+
+/* CpuStop() is checked before every instruction, and returns */
+/* non-zero if Cpu() should return. The breakpoint map is tested in */
+/* line, so CpuFlags() is only called at a breakpoint, not before */
+/* every instruction while any is set. */
+#define CpuStop() (CpuStep() && CpuFlags())
+
+/**********************************************************************/
+#pragma mark BLOCK CACHE
+
+/* With BLOCK_CACHE defined, Cpu() executes blocks, straight line runs
+ * of instructions that are decoded once into arrays of BlockOp records,
+ * instead of fetching and decoding every opcode. A block ends after a
+ * jump, call, return, restart, halt or port I/O instruction, or at the
+ * end of a code page. Writing to a code page invalidates its blocks
+ * (see memory.h). A block is also left as soon as PC does not continue
+ * at the next record, which covers repeating instructions like LDIR
+ * and registers changed by the monitor. While any system flag is set,
+ * instructions are executed one at a time exactly as without the cache.
+ */
+
+#ifdef BLOCK_CACHE
+
+#define kMaxBlockLength 64
+#define kMaxBlockOps 65536
+
+#ifdef JIT
+#define kJitSize (4 * 1024 * 1024)
+#define kJitMaxCode (kMaxBlockLength * 256)
+#define kJitHot 16
+#define kJitMaxDirty 4
+#endif
+
+/* The FD tables give the FD mnemonics but run the DD handlers, */
+/* see DecodeBlockOp(). */
+enum {
+	kOpTable,
+#ifdef Z80
+	kCBTable,
+	kEDTable,
+	kDDTable,
+	kDDCBTable,
+	kFDTable,
+	kFDCBTable,
+#endif
+	kMaxTable
+};
+
+#ifdef THREADED
+typedef const void *block_t;
+#else
+typedef operation_t block_t;
+#endif
+
+typedef struct BlockOp {
+	block_t operation;  /* handler, or threaded label */
+	Word pc;            /* address of the instruction */
+	Byte skip;          /* bytes of prefix and opcode */
+	Byte last;          /* non-zero if last in the block */
+	Byte cycles;        /* T-states, see DISPATCH() */
+	unsigned long fetch; /* bytes from the opcode on, see NN */
+	WordBytes *xy;      /* IX or IY, see XY */
+#ifdef JIT
+	Word hits;          /* runs of the block, in its first record */
+#endif
+} BlockOp, *BlockOpPtr;
+
+typedef struct BlockInfo {
+	Byte length;
+	char jmp;
+	Byte cycles;
+	const char *mnemonic;
+} BlockInfo;
+
+/* CODE spells out two hex digits per instruction byte. */
+#ifdef Z80
+#define OPERATION(INDEX, CODE, JMP, N8080, NZ80, F8080, FZ80, T8080, TZ80) \
+	{ sizeof(#CODE) / 2, #JMP[0], TZ80, NZ80 },
+#else
+#define OPERATION(INDEX, CODE, JMP, N8080, NZ80, F8080, FZ80, T8080, TZ80) \
+	{ sizeof(#CODE) / 2, #JMP[0], T8080, N8080 },
+#endif
+
+static const BlockInfo gBlockInfo[kMaxTable][256] = {
+	{
+#include "op.h"
+	},
+#ifdef Z80
+	{
+#include "opcb.h"
+	},
+	{
+#include "oped.h"
+	},
+	{
+#include "opdd.h"
+	},
+	{
+#include "opddcb.h"
+	},
+	{
+#include "opfd.h"
+	},
+	{
+#include "opfdcb.h"
+	},
+#endif
+};
+
+#undef OPERATION
+
+#ifdef THREADED
+/* ThreadedCpu() fills in its label tables. */
+static MACHINE const block_t *gBlockOperation[kMaxTable];
+#else
+static const block_t *gBlockOperation[kMaxTable] = {
+	operation,
+#ifdef Z80
+	operation_CB,
+	operation_ED,
+	operation_DD,
+	operation_DDCB,
+	operation_DD,
+	operation_DDCB,
+#endif
+};
+#endif
+
+static const Byte *const gBlockLength[kMaxTable] = {
+	length,
+#ifdef Z80
+	length_CB,
+	length_ED,
+	length_DD,
+	length_DDCB,
+	length_DD,
+	length_DDCB,
+#endif
+};
+
+/* The JIT compiles the pairs of opfuse.h as it is, so only the block */
+/* interpreters fuse them, see FuseBlockOps(). */
+#ifndef JIT
+
+#define FUSE(FIRST, SECOND, F1, F2) { FIRST, SECOND },
+static const Byte gFusePair[][2] = {
+#include "opfuse.h"
+};
+#undef FUSE
+
+#define kMaxFuse (sizeof(gFusePair) / sizeof(gFusePair[0]))
+
+#ifdef THREADED
+/* ThreadedCpu() fills in its labels of the pairs. */
+static MACHINE const block_t *gFuseOperation;
+#else
+static const block_t *const gFuseOperation = operation_FUSE;
+#endif
+
+#endif
+
+static MACHINE BlockOp gBlockOp[kMaxBlockOps];
+static MACHINE unsigned gBlockOps;
+static MACHINE BlockOpPtr gBlockAt[65536];
+static MACHINE Byte gBlockPage[kMaxCodePage];
+static MACHINE Byte gBlockSpill[kMaxCodePage];
+
+#ifdef JIT
+typedef unsigned (*jit_t)(Byte *code);
+static Byte *gJitCode;
+static Byte *gJitBlocks;
+static Byte *gJitNext;
+static Byte *gJitExit;
+static jit_t gJitEnter;
+static Byte *gJitAt[65536];
+static Byte gJitPage[kMaxCodePage];
+static Byte gJitDirty[kMaxCodePage];
+#endif
+
+/* DecodeBlockOp() decodes the instruction at pc into op. */
+/* The instruction length is returned. */
+static unsigned DecodeBlockOp(Word pc, BlockOpPtr op, const BlockInfo **info)
+{
+	unsigned table = kOpTable;
+	unsigned index = RdByte(pc);
+	unsigned skip = 1;
+	WordBytes *xy = 0;
+	Word at;
+
+#ifdef Z80
+	if (operation[index] == CB_OP) {
+		table = kCBTable;
+		index = RdByte(pc + 1);
+		skip = 2;
+	}
+	else if (operation[index] == ED_OP) {
+		table = kEDTable;
+		index = RdByte(pc + 1);
+		skip = 2;
+	}
+	else if (operation[index] == DD_OP) {
+		table = kDDTable;
+		index = RdByte(pc + 1);
+		skip = 2;
+		xy = &gCpuState.ix;
+		if (operation_DD[index] == XYCB_OP) {
+			table = kDDCBTable;
+			index = RdByte(pc + 3);
+			skip = 4;
+		}
+	}
+	else if (operation[index] == FD_OP) {
+		table = kFDTable;
+		index = RdByte(pc + 1);
+		skip = 2;
+		xy = &gCpuState.iy;
+		if (operation_DD[index] == XYCB_OP) {
+			table = kFDCBTable;
+			index = RdByte(pc + 3);
+			skip = 4;
+		}
+	}
+#endif
+
+	op->operation = gBlockOperation[table][index];
+	op->pc = pc;
+	op->skip = skip;
+	op->last = 0;
+	op->cycles = gBlockInfo[table][index].cycles;
+
+	/* The operands are fetched once, here, as DISPATCH() would. */
+	at = (Word)(pc + skip - 1);
+#ifdef Z80
+	if ((table == kDDCBTable) || (table == kFDCBTable))
+		at = (Word)(pc + 1);
+#endif
+	op->fetch = RdFetch(at, gBlockLength[table]);
+	op->xy = xy;
+#ifdef JIT
+	op->hits = 0;
+#endif
+
+	*info = &gBlockInfo[table][index];
+
+	return (*info)->length;
+
+}
+
+#ifndef JIT
+
+/* FuseBlockOps() makes op and the record after it one record, if */
+/* the two instructions are a pair of opfuse.h. Returns non-zero if */
+/* it did. A block never runs on past a breakpoint, nor while */
+/* tracing, so the pair is never stepped apart. */
+static int FuseBlockOps(BlockOpPtr op)
+{
+	unsigned first;
+	unsigned second;
+	unsigned n;
+
+	/* One byte instructions of op.h; a fused record is two bytes. */
+	if ((op[0].skip != 1) || (op[1].skip != 1) ||
+	    (op[1].pc != (Word)(op[0].pc + 1)))
+		return 0;
+	first = RdByte(op[0].pc);
+	second = RdByte(op[1].pc);
+	if (gBlockInfo[kOpTable][second].length != 1)
+		return 0;
+
+	for (n = 0; n < kMaxFuse; n++)
+		if ((gFusePair[n][0] == first) && (gFusePair[n][1] == second)) {
+			op->operation = gFuseOperation[n];
+			op->cycles += op[1].cycles;
+			return 1;
+		}
+
+	return 0;
+
+}
+
+#endif
+
+/* EndsBlock() returns non-zero if an instruction ends a block. */
+static int EndsBlock(const BlockInfo *info)
+{
+	const char *mnemonic = info->mnemonic;
+
+	/* Jumps, calls, returns and restarts. */
+	if ((info->jmp != SIMPLE) && (info->jmp != REF_DATA))
+		return 1;
+
+	/* Port I/O may change the system flags or the memory map. */
+	return (strncmp(mnemonic, "IN ", 3) == 0) ||
+	       (strncmp(mnemonic, "INI", 3) == 0) ||
+	       (strncmp(mnemonic, "IND", 3) == 0) ||
+	       (strncmp(mnemonic, "OUT", 3) == 0) ||
+	       (strncmp(mnemonic, "OT", 2) == 0);
+
+}
+
+/* ForgetBlocks() forgets the blocks that start in a code page. */
+static void ForgetBlocks(unsigned page)
+{
+
+	if (gBlockPage[page]) {
+		gBlockPage[page] = 0;
+		gBlockSpill[page] = 0;
+		memset(&gBlockAt[page * kCodePageSize],
+		       0,
+		       kCodePageSize * sizeof(*gBlockAt));
+	}
+
+#ifdef JIT
+	if (gJitPage[page]) {
+		gJitPage[page] = 0;
+		memset(&gJitAt[page * kCodePageSize],
+		       0,
+		       kCodePageSize * sizeof(*gJitAt));
+	}
+#endif
+
+}
+
+/* FlushBlocks() forgets every block. */
+static void FlushBlocks(void)
+{
+	unsigned page;
+
+	for (page = 0; page < kMaxCodePage; page++)
+		ForgetBlocks(page);
+	gBlockOps = 0;
+
+#ifdef JIT
+	gJitNext = gJitBlocks;
+#endif
+
+}
+
+/* InvalidateBlocks() forgets the blocks in every stale code page. */
+static void InvalidateBlocks(void)
+{
+	unsigned page;
+
+	gCodeChanged = 0;
+
+	for (page = 0; page < kMaxCodePage; page++)
+		if (gCodeStale[page]) {
+			gCodeStale[page] = 0;
+#ifdef JIT
+			/* Count rewrites of compiled code, see JitBlock(). */
+			if (gJitPage[page] && (gJitDirty[page] < kJitMaxDirty))
+				gJitDirty[page]++;
+#endif
+			ForgetBlocks(page);
+			/* A block can run over from the previous page. */
+			if (gBlockSpill[(page - 1) % kMaxCodePage])
+				ForgetBlocks((page - 1) % kMaxCodePage);
+		}
+
+}
+
+/* TranslateBlock() decodes the block that starts at pc. */
+static BlockOpPtr TranslateBlock(Word pc)
+{
+	unsigned page = pc / kCodePageSize;
+	const BlockInfo *info;
+	BlockOpPtr block;
+	BlockOpPtr op;
+	unsigned length;
+	Word start = pc;
+
+	/* Start over if the block might not fit. */
+	if (gBlockOps + kMaxBlockLength > kMaxBlockOps)
+		FlushBlocks();
+
+	block = op = &gBlockOp[gBlockOps];
+
+	for (;;) {
+		length = DecodeBlockOp(pc, op, &info);
+		pc += length;
+#ifndef JIT
+		if ((op > block) && FuseBlockOps(op - 1))
+			op--;
+#endif
+		if (EndsBlock(info))
+			break;
+		if (op - block + 1 >= kMaxBlockLength)
+			break;
+		if (pc / kCodePageSize != page)
+			break;
+		/* Cpu() only tests the breakpoints between blocks. */
+		if ((gBreakCount > 0) && IsBreak(pc))
+			break;
+		op++;
+	}
+
+	op->last = 1;
+	gBlockOps += op - block + 1;
+
+	MarkCode(start, pc - start);
+
+	gBlockAt[block->pc] = block;
+	gBlockPage[page] = 1;
+	if ((Word)(pc - 1) / kCodePageSize != page)
+		gBlockSpill[page] = 1;
+
+	return block;
+
+}
+
+#ifndef THREADED
+
+/* RunBlock() executes a block, and returns the record after the */
+/* last instruction executed. */
+static BlockOpPtr RunBlock(BlockOpPtr block)
+{
+	BlockOpPtr op = block;
+
+	do {
+		PC += op->skip;
+		CYCLES += op->cycles;
+		(*op->operation)(op->fetch, op->xy);
+	} while (!(op++)->last && (PC == op->pc) && !gCodeChanged);
+
+	return op;
+
+}
+
+static void BlockCpu(void)
+{
+	BlockOpPtr block;
+
+	for (;;) {
+
+		/* Blocks end ahead of breakpoints, see TranslateBlock(). */
+		if (CpuStep()) {
+			if (CpuFlags())
+				return;
+			DISPATCH();
+			continue;
+		}
+
+		if (gCodeChanged)
+			InvalidateBlocks();
+
+		if ((block = gBlockAt[PC]) == 0)
+			block = TranslateBlock(PC);
+
+		/* GetSystemFlags() counted the first instruction. */
+		gCheckForInterrupts += RunBlock(block) - block - 1;
+
+	}
+
+}
+
+#endif
+
+/**********************************************************************/
+#pragma mark JIT
+
+/* With JIT defined (x86-64 hosts only), a block that has run kJitHot
+ * times is compiled into host code. Compiled blocks are entered through
+ * gJitEnter(), which keeps &gCpuState in rbx, &gCodeChanged in r12,
+ * gRdBank in r13, gWrBank in r14 and gCodeMap in r15, and return the
+ * number of instructions they executed. Register moves and loads, 8-bit
+ * arithmetic and logic (flags from the same tables as the handlers),
+ * 16-bit adds, increments and decrements, memory loads and stores,
+ * PUSH, POP, jumps, calls, returns and port I/O (calling gSystemPort[]
+ * directly) are translated; every other instruction calls its handler.
+ * The Z80 registers stay in gCpuState, which rbx addresses directly.
+ * A block is left as soon as cached code is written, or PC does not
+ * continue at the next instruction after a handler. Blocks run fewer
+ * than kJitHot times are left to the block interpreter. A code page
+ * whose compiled code is rewritten kJitMaxDirty times is interpreted
+ * one instruction at a time from then on, as is everything while a
+ * system flag (monitor, breakpoint, trace) is set.
+ */
+
+#ifdef JIT
+
+#define kJitPC offsetof(CpuState, pc)
+#define kJitSP offsetof(CpuState, sp)
+#define kJitF  offsetof(CpuState, af.byte.low)
+#define kJitA  offsetof(CpuState, af.byte.high)
+#define kJitB  offsetof(CpuState, bc.byte.high)
+#define kJitHL offsetof(CpuState, hl)
+#define kJitCycles offsetof(CpuState, cycles)
+
+/* Bytes of code emitted by JitExit(). */
+#define kJitExitSize 18
+
+/* T-states of the instructions compiled so far into the block. */
+static unsigned gJitCycles;
+
+/* Offsets of the registers numbered by the opcode bits. */
+static const Byte gJitRegister[8] = {
+	offsetof(CpuState, bc.byte.high),
+	offsetof(CpuState, bc.byte.low),
+	offsetof(CpuState, de.byte.high),
+	offsetof(CpuState, de.byte.low),
+	offsetof(CpuState, hl.byte.high),
+	offsetof(CpuState, hl.byte.low),
+	0,
+	offsetof(CpuState, af.byte.high)
+};
+
+/* Register pairs, BC DE HL SP, and BC DE HL AF for PUSH and POP. */
+static const Byte gJitPair[2][4] = {
+	{
+		offsetof(CpuState, bc),
+		offsetof(CpuState, de),
+		offsetof(CpuState, hl),
+		offsetof(CpuState, sp)
+	},
+	{
+		offsetof(CpuState, bc),
+		offsetof(CpuState, de),
+		offsetof(CpuState, hl),
+		offsetof(CpuState, af)
+	}
+};
+
+/* The flag tested by each condition code, NZ Z NC C PO PE P M. */
+static const Byte gJitCondition[4] = { ZERO, CARRY, PARITY, SIGN };
+
+enum {
+	kJitNone,      /* not translated */
+	kJitNative,    /* translated */
+	kJitWrite,     /* translated, and may write cached code */
+	kJitLeave      /* translated, and leaves the block */
+};
+
+/* 8-bit operations, in opcode order. */
+enum {
+	kJitADD,
+	kJitADC,
+	kJitSUB,
+	kJitSBC,
+	kJitAND,
+	kJitXOR,
+	kJitOR,
+	kJitCP
+};
+
+static void JitByte(unsigned value)
+{
+	*gJitNext++ = (Byte)value;
+}
+
+static void JitWord(unsigned value)
+{
+	JitByte(value);
+	JitByte(value >> 8);
+}
+
+static void JitLong(unsigned long value)
+{
+	JitWord((unsigned)value);
+	JitWord((unsigned)(value >> 16));
+}
+
+static void JitAddress(const void *address)
+{
+	unsigned long long value = (unsigned long long)(size_t)address;
+
+	JitLong((unsigned long)value);
+	JitLong((unsigned long)(value >> 32));
+
+}
+
+/* j<condition> rel32, to be set by JitLand(). */
+static Byte *JitJump(unsigned condition)
+{
+	JitByte(0x0F); JitByte(condition); JitLong(0);
+	return gJitNext;
+}
+
+static void JitLand(Byte *jump)
+{
+	Byte *next = gJitNext;
+
+	gJitNext = jump - 4;
+	JitLong((unsigned long)(next - jump));
+	gJitNext = next;
+
+}
+
+/* mov word [rbx + offset], value */
+static void JitSetWord(unsigned offset, Word value)
+{
+	JitByte(0x66); JitByte(0xC7); JitByte(0x43); JitByte(offset);
+	JitWord(value);
+}
+
+/* mov rsi, table */
+static void JitTable(const Byte *table)
+{
+	JitByte(0x48); JitByte(0xBE); JitAddress(table);
+}
+
+/* add qword [rbx + cycles], cycles */
+static void JitCycles(unsigned cycles)
+{
+	JitByte(0x48); JitByte(0x81); JitByte(0x43); JitByte(kJitCycles);
+	JitLong(cycles);
+}
+
+/* Count gJitCycles; mov eax, count; jmp gJitExit */
+static void JitExit(unsigned count)
+{
+	JitCycles(gJitCycles);
+	JitByte(0xB8); JitLong(count);
+	JitByte(0xE9); JitLong((unsigned long)(gJitExit - (gJitNext + 4)));
+}
+
+/* Leave the block unless PC is next. */
+static void JitExitUnlessPC(Word next, unsigned count)
+{
+	JitByte(0x66); JitByte(0x81); JitByte(0x7B); JitByte(kJitPC);
+	JitWord(next);
+	JitByte(0x74); JitByte(kJitExitSize);
+	JitExit(count);
+}
+
+/* Leave the block if any cached code was written, at pc if not 0. */
+static void JitExitIfChanged(Word pc, unsigned count)
+{
+	JitByte(0x41); JitByte(0x80); JitByte(0x3C); JitByte(0x24); JitByte(0x00);
+	JitByte(0x74); JitByte(pc ? 6 + kJitExitSize : kJitExitSize);
+	if (pc)
+		JitSetWord(kJitPC, pc);
+	JitExit(count);
+}
+
+/* test byte [rbx + F], flag for condition cc, and return the jump */
+/* condition that skips over code for when it holds. */
+static unsigned JitTest(unsigned cc)
+{
+	JitByte(0xF6); JitByte(0x43); JitByte(kJitF);
+	JitByte(gJitCondition[cc >> 1]);
+	return (cc & 1) ? 0x84 : 0x85;
+}
+
+/* ecx = RdByte(eax), like RdByte(). */
+static void JitRead(void)
+{
+	JitByte(0x89); JitByte(0xC2);                          /* mov edx,eax */
+	JitByte(0xC1); JitByte(0xEA); JitByte(0x0E);           /* shr edx,14 */
+	JitByte(0x25); JitLong(0x3FFF);                        /* and eax,3FFF */
+	JitByte(0x49); JitByte(0x8B); JitByte(0x54);
+	JitByte(0xD5); JitByte(0x00);                          /* mov rdx,[r13+rdx*8] */
+	JitByte(0x0F); JitByte(0xB6); JitByte(0x0C); JitByte(0x02);
+	                                                       /* movzx ecx,[rdx+rax] */
+}
+
+/* WrByte(eax, cl), like WrByte(). */
+static void JitWrite(void)
+{
+	Byte *jump;
+
+	JitByte(0x89); JitByte(0xC6);                          /* mov esi,eax */
+	JitByte(0x89); JitByte(0xC2);                          /* mov edx,eax */
+	JitByte(0xC1); JitByte(0xEA); JitByte(0x0E);           /* shr edx,14 */
+	JitByte(0x25); JitLong(0x3FFF);                        /* and eax,3FFF */
+	JitByte(0x49); JitByte(0x8B); JitByte(0x14); JitByte(0xD6);
+	                                                       /* mov rdx,[r14+rdx*8] */
+	JitByte(0x88); JitByte(0x0C); JitByte(0x02);           /* mov [rdx+rax],cl */
+#ifdef DIRTY_PAGES
+	JitByte(0xC1); JitByte(0xE8); JitByte(0x08);           /* shr eax,8 */
+	JitByte(0x89); JitByte(0xF2);                          /* mov edx,esi */
+	JitByte(0xC1); JitByte(0xEA); JitByte(0x0E);           /* shr edx,14 */
+	JitByte(0x48); JitByte(0xBF); JitAddress(gWrDirty);    /* mov rdi,gWrDirty */
+	JitByte(0x48); JitByte(0x8B); JitByte(0x14); JitByte(0xD7);
+	                                                       /* mov rdx,[rdi+rdx*8] */
+	JitByte(0x48); JitByte(0xBF); JitAddress(&gDirtyEpoch);
+	                                                       /* mov rdi,&gDirtyEpoch */
+	JitByte(0x48); JitByte(0x8B); JitByte(0x3F);           /* mov rdi,[rdi] */
+	JitByte(0x48); JitByte(0x89); JitByte(0x3C); JitByte(0xC2);
+	                                                       /* mov [rdx+rax*8],rdi */
+#endif
+	JitByte(0x41); JitByte(0x80); JitByte(0x3C);
+	JitByte(0x37); JitByte(0x00);                          /* cmp [r15+rsi],0 */
+	jump = JitJump(0x84);
+	JitByte(0x89); JitByte(0xF7);                          /* mov edi,esi */
+	JitByte(0x48); JitByte(0xB8); JitAddress((void *)CodeWritten);
+	JitByte(0xFF); JitByte(0xD0);                          /* call CodeWritten */
+	JitLand(jump);
+}
+
+/* movzx eax, word [rbx + offset] */
+static void JitGetWord(unsigned offset)
+{
+	JitByte(0x0F); JitByte(0xB7); JitByte(0x43); JitByte(offset);
+}
+
+/* movzx ecx, byte [rbx + offset] */
+static void JitGetByte(unsigned offset)
+{
+	JitByte(0x0F); JitByte(0xB6); JitByte(0x4B); JitByte(offset);
+}
+
+/* mov [rbx + offset], cl */
+static void JitPutByte(unsigned offset)
+{
+	JitByte(0x88); JitByte(0x4B); JitByte(offset);
+}
+
+/* WrByte(--SP, cl) */
+static void JitPush(void)
+{
+	JitByte(0x66); JitByte(0xFF); JitByte(0x4B); JitByte(kJitSP);
+	JitGetWord(kJitSP);
+	JitWrite();
+}
+
+/* WrByte(--SP, value >> 8); WrByte(--SP, value) */
+static void JitPushWord(Word value)
+{
+	JitByte(0xB9); JitLong(value >> 8);
+	JitPush();
+	JitByte(0xB9); JitLong(value & 0xFF);
+	JitPush();
+}
+
+/* cl = RdByte(SP++) */
+static void JitPop(void)
+{
+	JitGetWord(kJitSP);
+	JitByte(0x66); JitByte(0xFF); JitByte(0x43); JitByte(kJitSP);
+	JitRead();
+}
+
+/* The 8-bit operation on A and ecx, see _ADD() and friends. */
+static void JitOperation(unsigned operation)
+{
+
+	JitByte(0x0F); JitByte(0xB6); JitByte(0x43); JitByte(kJitA);
+
+	switch (operation) {
+
+	case kJitAND:
+	case kJitXOR:
+	case kJitOR:
+		JitByte((operation == kJitAND) ? 0x21 :
+		        (operation == kJitXOR) ? 0x31 : 0x09);
+		JitByte(0xC8);                             /* op eax,ecx */
+		JitByte(0x88); JitByte(0x43); JitByte(kJitA);
+		JitTable(gSignZeroMagic2Magic1Parity);
+		JitByte(0x0F); JitByte(0xB6); JitByte(0x04); JitByte(0x06);
+		if (operation == kJitAND) {
+			JitByte(0x83); JitByte(0xC8); JitByte(HALFCARRY);
+		}
+		JitByte(0x88); JitByte(0x43); JitByte(kJitF);
+		return;
+
+	}
+
+	JitByte(0x89); JitByte(0xC2);                      /* mov edx,eax */
+	JitByte(0x31); JitByte(0xCA);                      /* xor edx,ecx */
+	if ((operation == kJitADD) || (operation == kJitADC)) {
+		JitByte(0x01); JitByte(0xC8);                  /* add eax,ecx */
+	}
+	else {
+		JitByte(0x29); JitByte(0xC8);                  /* sub eax,ecx */
+	}
+	if ((operation == kJitADC) || (operation == kJitSBC)) {
+		JitByte(0x0F); JitByte(0xB6); JitByte(0x73); JitByte(kJitF);
+		JitByte(0x83); JitByte(0xE6); JitByte(CARRY);  /* and esi,CARRY */
+		JitByte((operation == kJitADC) ? 0x01 : 0x29);
+		JitByte(0xF0);                                 /* add/sub eax,esi */
+	}
+	if ((operation != kJitADD) && (operation != kJitADC)) {
+		JitByte(0x25); JitLong(0x1FF);                 /* and eax,1FF */
+	}
+	JitByte(0x31); JitByte(0xC2);                      /* xor edx,eax */
+	JitTable(gHalfCarryOverflowCarry);
+	JitByte(0x0F); JitByte(0xB6); JitByte(0x14); JitByte(0x16);
+
+	if (operation == kJitCP) {
+		JitByte(0x89); JitByte(0xC6);                  /* mov esi,eax */
+		JitByte(0x81); JitByte(0xE6); JitLong(SIGN);   /* and esi,SIGN */
+		JitByte(0x09); JitByte(0xF2);                  /* or edx,esi */
+		JitByte(0x84); JitByte(0xC0);                  /* test al,al */
+		JitByte(0x75); JitByte(3);
+		JitByte(0x83); JitByte(0xCA); JitByte(ZERO);   /* or edx,ZERO */
+		JitByte(0x89); JitByte(0xCE);                  /* mov esi,ecx */
+		JitByte(0x83); JitByte(0xE6); JitByte(MAGIC1 | MAGIC2);
+		JitByte(0x09); JitByte(0xF2);                  /* or edx,esi */
+		JitByte(0x83); JitByte(0xCA); JitByte(SUBTRACT);
+		JitByte(0x88); JitByte(0x53); JitByte(kJitF);  /* mov F,dl */
+		return;
+	}
+
+	JitByte(0x88); JitByte(0x43); JitByte(kJitA);      /* mov A,al */
+	JitByte(0x0F); JitByte(0xB6); JitByte(0xC0);       /* movzx eax,al */
+	JitTable(gSignZeroMagic2Magic1);
+	JitByte(0x0F); JitByte(0xB6); JitByte(0x04); JitByte(0x06);
+	JitByte(0x09); JitByte(0xD0);                      /* or eax,edx */
+	if ((operation == kJitSUB) || (operation == kJitSBC)) {
+		JitByte(0x83); JitByte(0xC8); JitByte(SUBTRACT);
+	}
+	JitByte(0x88); JitByte(0x43); JitByte(kJitF);
+
+}
+
+/* INC r or DEC r, see _INC() and _DEC(). */
+static void JitIncrement(unsigned offset, int decrement)
+{
+	JitByte(0x0F); JitByte(0xB6); JitByte(0x43); JitByte(offset);
+	JitByte(0xFE); JitByte(decrement ? 0xC8 : 0xC0);   /* inc/dec al */
+	JitByte(0x88); JitByte(0x43); JitByte(offset);
+	JitByte(0x0F); JitByte(0xB6); JitByte(0xC0);       /* movzx eax,al */
+	JitTable(decrement ? gSignZeroMagic2HalfCarryMagic1OverflowSubtract
+	                   : gSignZeroMagic2HalfCarryMagic1Overflow);
+	JitByte(0x0F); JitByte(0xB6); JitByte(0x04); JitByte(0x06);
+	JitGetByte(kJitF);
+	JitByte(0x83); JitByte(0xE1); JitByte(CARRY);      /* and ecx,CARRY */
+	JitByte(0x09); JitByte(0xC8);                      /* or eax,ecx */
+	JitByte(0x88); JitByte(0x43); JitByte(kJitF);
+}
+
+/* ADD HL,rr, see _ADD_WORD(). */
+static void JitAddWord(unsigned offset)
+{
+	JitGetWord(kJitHL);
+	JitByte(0x0F); JitByte(0xB7); JitByte(0x4B); JitByte(offset);
+	JitByte(0x89); JitByte(0xC2);                      /* mov edx,eax */
+	JitByte(0x31); JitByte(0xCA);                      /* xor edx,ecx */
+	JitByte(0x01); JitByte(0xC8);                      /* add eax,ecx */
+	JitByte(0x31); JitByte(0xC2);                      /* xor edx,eax */
+	JitByte(0xC1); JitByte(0xEA); JitByte(8);          /* shr edx,8 */
+	JitTable(gHalfCarryCarry);
+	JitByte(0x0F); JitByte(0xB6); JitByte(0x14); JitByte(0x16);
+	JitByte(0x66); JitByte(0x89); JitByte(0x43); JitByte(kJitHL);
+	JitByte(0xC1); JitByte(0xE8); JitByte(8);          /* shr eax,8 */
+	JitByte(0x83); JitByte(0xE0); JitByte(MAGIC1 | MAGIC2);
+	JitByte(0x09); JitByte(0xC2);                      /* or edx,eax */
+	JitByte(0x0F); JitByte(0xB6); JitByte(0x43); JitByte(kJitF);
+	JitByte(0x25);
+	JitLong((Byte)~(MAGIC2 | HALFCARRY | MAGIC1 | SUBTRACT | CARRY));
+	JitByte(0x09); JitByte(0xD0);                      /* or eax,edx */
+	JitByte(0x88); JitByte(0x43); JitByte(kJitF);
+}
+
+/* Set PC to target if condition cc holds, else to next, and leave. */
+/* A taken branch adds cycles. */
+static void
+	JitBranch(unsigned cc,
+	          Word next,
+	          Word target,
+	          unsigned count,
+	          unsigned cycles)
+{
+	Byte *jump;
+
+	JitSetWord(kJitPC, next);
+	jump = JitJump(JitTest(cc));
+	JitSetWord(kJitPC, target);
+	if (cycles)
+		JitCycles(cycles);
+	JitLand(jump);
+	JitExit(count);
+}
+
+/* Count and call gSystemPort[port] for IN A,(port) or OUT (port),A. */
+static void JitPort(Byte port, int input)
+{
+	unsigned long *count = input ? &gSystemStats.input[port]
+	                             : &gSystemStats.output[port];
+
+	/* mov rax,count; inc qword [rax] */
+	JitByte(0x48); JitByte(0xB8); JitAddress(count);
+	JitByte(0x48); JitByte(0xFF); JitByte(0x00);
+
+	if (input) {
+		JitByte(0x48); JitByte(0x8D); JitByte(0x7B); JitByte(kJitA);
+		JitByte(0x31); JitByte(0xF6);
+	}
+	else {
+		JitByte(0x31); JitByte(0xFF);
+		JitByte(0x0F); JitByte(0xB6); JitByte(0x73); JitByte(kJitA);
+	}
+	JitByte(0x48); JitByte(0xB8); JitAddress(&gSystemPort[port]);
+	JitByte(0xFF); JitByte(0x10);                      /* call [rax] */
+
+}
+
+/* JitNative() translates the instruction at pc, if it can. */
+static int JitNative(unsigned opcode, Word pc, Word next, unsigned count)
+{
+	unsigned x = (opcode >> 3) & 7;
+	unsigned z = opcode & 7;
+	unsigned p = (opcode >> 4) & 3;
+	Byte n = RdByte(pc + 1);
+	Word nn = (Word)(n | (RdByte(pc + 2) << 8));
+	Byte *jump;
+
+	/* LD r,r' */
+	if (((opcode & 0xC0) == 0x40) && (x != 6) && (z != 6)) {
+		JitGetByte(gJitRegister[z]);
+		JitPutByte(gJitRegister[x]);
+		return kJitNative;
+	}
+
+	/* LD r,(HL) */
+	if (((opcode & 0xC7) == 0x46) && (x != 6)) {
+		JitGetWord(kJitHL);
+		JitRead();
+		JitPutByte(gJitRegister[x]);
+		return kJitNative;
+	}
+
+	/* LD (HL),r */
+	if (((opcode & 0xF8) == 0x70) && (z != 6)) {
+		JitGetByte(gJitRegister[z]);
+		JitGetWord(kJitHL);
+		JitWrite();
+		return kJitWrite;
+	}
+
+	/* LD r,NN */
+	if (((opcode & 0xC7) == 0x06) && (x != 6)) {
+		JitByte(0xC6); JitByte(0x43); JitByte(gJitRegister[x]);
+		JitByte(n);
+		return kJitNative;
+	}
+
+	/* ADD ADC SUB SBC AND XOR OR CP r or (HL) */
+	if ((opcode & 0xC0) == 0x80) {
+		if (z == 6) {
+			JitGetWord(kJitHL);
+			JitRead();
+		}
+		else
+			JitGetByte(gJitRegister[z]);
+		JitOperation(x);
+		return kJitNative;
+	}
+
+	/* ADD ADC SUB SBC AND XOR OR CP NN */
+	if ((opcode & 0xC7) == 0xC6) {
+		JitByte(0xB9); JitLong(n);
+		JitOperation(x);
+		return kJitNative;
+	}
+
+	/* INC r, DEC r */
+	if (((opcode & 0xC6) == 0x04) && (x != 6)) {
+		JitIncrement(gJitRegister[x], opcode & 1);
+		return kJitNative;
+	}
+
+	/* LD rr,NNNN */
+	if ((opcode & 0xCF) == 0x01) {
+		JitSetWord(gJitPair[0][p], nn);
+		return kJitNative;
+	}
+
+	/* INC rr, DEC rr */
+	if (((opcode & 0xCF) == 0x03) || ((opcode & 0xCF) == 0x0B)) {
+		JitByte(0x66); JitByte(0xFF);
+		JitByte((opcode & 0x08) ? 0x4B : 0x43); JitByte(gJitPair[0][p]);
+		return kJitNative;
+	}
+
+	/* ADD HL,rr */
+	if ((opcode & 0xCF) == 0x09) {
+		JitAddWord(gJitPair[0][p]);
+		return kJitNative;
+	}
+
+	/* PUSH rr */
+	if ((opcode & 0xCF) == 0xC5) {
+		JitGetByte(gJitPair[1][p] + 1);
+		JitPush();
+		JitGetByte(gJitPair[1][p]);
+		JitPush();
+		return kJitWrite;
+	}
+
+	/* POP rr */
+	if ((opcode & 0xCF) == 0xC1) {
+		JitPop();
+		JitPutByte(gJitPair[1][p]);
+		JitPop();
+		JitPutByte(gJitPair[1][p] + 1);
+		return kJitNative;
+	}
+
+	/* JP cc,NNNN */
+	if ((opcode & 0xC7) == 0xC2) {
+		JitBranch(x, next, nn, count, 0);
+		return kJitLeave;
+	}
+
+	/* CALL cc,NNNN */
+	if ((opcode & 0xC7) == 0xC4) {
+		JitSetWord(kJitPC, next);
+		jump = JitJump(JitTest(x));
+		JitPushWord(next);
+		JitSetWord(kJitPC, nn);
+		JitCycles(kCallTaken);
+		JitLand(jump);
+		JitExit(count);
+		return kJitLeave;
+	}
+
+	/* RET cc */
+	if ((opcode & 0xC7) == 0xC0) {
+		JitSetWord(kJitPC, next);
+		jump = JitJump(JitTest(x));
+		JitPop();
+		JitPutByte(kJitPC);
+		JitPop();
+		JitPutByte(kJitPC + 1);
+		JitCycles(kReturnTaken);
+		JitLand(jump);
+		JitExit(count);
+		return kJitLeave;
+	}
+
+#ifdef Z80
+	/* JR cc,NN */
+	if ((opcode & 0xE7) == 0x20) {
+		JitBranch(x - 4, next, (Word)(next + (char)n), count, kJumpTaken);
+		return kJitLeave;
+	}
+#endif
+
+	switch (opcode) {
+
+	case 0x00: /* NOP */
+		return kJitNative;
+
+	case 0x02: /* LD (BC),A */
+	case 0x12: /* LD (DE),A */
+		JitGetByte(kJitA);
+		JitGetWord(gJitPair[0][p]);
+		JitWrite();
+		return kJitWrite;
+
+	case 0x0A: /* LD A,(BC) */
+	case 0x1A: /* LD A,(DE) */
+		JitGetWord(gJitPair[0][p]);
+		JitRead();
+		JitPutByte(kJitA);
+		return kJitNative;
+
+	case 0x32: /* LD (NNNN),A */
+		JitGetByte(kJitA);
+		JitByte(0xB8); JitLong(nn);
+		JitWrite();
+		return kJitWrite;
+
+	case 0x3A: /* LD A,(NNNN) */
+		JitByte(0xB8); JitLong(nn);
+		JitRead();
+		JitPutByte(kJitA);
+		return kJitNative;
+
+	case 0x36: /* LD (HL),NN */
+		JitByte(0xB9); JitLong(n);
+		JitGetWord(kJitHL);
+		JitWrite();
+		return kJitWrite;
+
+	case 0xEB: /* EX DE,HL */
+		JitGetWord(gJitPair[0][1]);
+		JitByte(0x0F); JitByte(0xB7); JitByte(0x4B); JitByte(kJitHL);
+		JitByte(0x66); JitByte(0x89); JitByte(0x4B); JitByte(gJitPair[0][1]);
+		JitByte(0x66); JitByte(0x89); JitByte(0x43); JitByte(kJitHL);
+		return kJitNative;
+
+	case 0xF9: /* LD SP,HL */
+		JitGetWord(kJitHL);
+		JitByte(0x66); JitByte(0x89); JitByte(0x43); JitByte(kJitSP);
+		return kJitNative;
+
+	case 0xC3: /* JP NNNN */
+		JitSetWord(kJitPC, nn);
+		JitExit(count);
+		return kJitLeave;
+
+	case 0xCD: /* CALL NNNN */
+		JitPushWord(next);
+		JitSetWord(kJitPC, nn);
+		JitExit(count);
+		return kJitLeave;
+
+	case 0xC9: /* RET */
+		JitPop();
+		JitPutByte(kJitPC);
+		JitPop();
+		JitPutByte(kJitPC + 1);
+		JitExit(count);
+		return kJitLeave;
+
+	case 0xD3: /* OUT (NN),A */
+	case 0xDB: /* IN A,(NN) */
+		JitSetWord(kJitPC, next);
+		JitPort(n, opcode == 0xDB);
+		JitExit(count);
+		return kJitLeave;
+
+#ifdef Z80
+	case 0x18: /* JR NN */
+		JitSetWord(kJitPC, (Word)(next + (char)n));
+		JitExit(count);
+		return kJitLeave;
+
+	case 0x10: /* DJNZ NN */
+		JitSetWord(kJitPC, next);
+		JitByte(0xFE); JitByte(0x4B); JitByte(kJitB);  /* dec B */
+		jump = JitJump(0x84);
+		JitSetWord(kJitPC, (Word)(next + (char)n));
+		JitCycles(kJumpTaken);
+		JitLand(jump);
+		JitExit(count);
+		return kJitLeave;
+#endif
+
+	}
+
+	return kJitNone;
+
+}
+
+/* JitOpen() allocates the code buffer, starting with the entry and */
+/* exit code shared by all blocks. Without it, blocks are not compiled. */
+static int JitOpen(void)
+{
+	void *code;
+
+	code = mmap(0,
+	            kJitSize,
+	            PROT_READ | PROT_WRITE | PROT_EXEC,
+	            MAP_PRIVATE | MAP_ANONYMOUS,
+	            -1,
+	            0);
+	if (code == MAP_FAILED) {
+		printf("?JIT\n");
+		return 0;
+	}
+
+	gJitCode = gJitNext = code;
+
+	/* pop r15; pop r14; pop r13; pop r12; pop rbx; ret */
+	gJitExit = gJitNext;
+	JitByte(0x41); JitByte(0x5F);
+	JitByte(0x41); JitByte(0x5E);
+	JitByte(0x41); JitByte(0x5D);
+	JitByte(0x41); JitByte(0x5C);
+	JitByte(0x5B);
+	JitByte(0xC3);
+
+	/* push rbx; push r12; push r13; push r14; push r15 */
+	gJitEnter = (jit_t)gJitNext;
+	JitByte(0x53);
+	JitByte(0x41); JitByte(0x54);
+	JitByte(0x41); JitByte(0x55);
+	JitByte(0x41); JitByte(0x56);
+	JitByte(0x41); JitByte(0x57);
+
+	/* Load the pinned registers, and jmp rdi. */
+	JitByte(0x48); JitByte(0xBB); JitAddress(&gCpuState);
+	JitByte(0x49); JitByte(0xBC); JitAddress(&gCodeChanged);
+	JitByte(0x49); JitByte(0xBD); JitAddress(gRdBank);
+	JitByte(0x49); JitByte(0xBE); JitAddress(gWrBank);
+	JitByte(0x49); JitByte(0xBF); JitAddress(gCodeMap);
+	JitByte(0xFF); JitByte(0xE7);
+
+	gJitBlocks = gJitNext;
+
+	return 1;
+
+}
+
+/* JitBlock() compiles the block that starts at pc. */
+static Byte *JitBlock(Word pc)
+{
+	const BlockInfo *info;
+	BlockOp decoded;
+	BlockOpPtr op;
+	Byte *code;
+	unsigned count;
+	unsigned index;
+	Word next;
+
+	if (gJitCode == 0)
+		return 0;
+
+	/* Start over if the block might not fit. */
+	if (gJitNext + kJitMaxCode > gJitCode + kJitSize) {
+		FlushBlocks();
+		TranslateBlock(pc);
+	}
+
+	code = gJitNext;
+	gJitCycles = 0;
+
+	for (op = gBlockAt[pc], count = 1; ; op++, count++) {
+
+		gJitCycles += op->cycles;
+		DecodeBlockOp(op->pc, &decoded, &info);
+		index = info - &gBlockInfo[kOpTable][0];
+		next = op->pc + info->length;
+
+		switch ((index < 256) ? JitNative(index, op->pc, next, count)
+		                      : kJitNone) {
+
+		case kJitNone:
+			/* mov edi,fetch; mov rsi,xy; mov rax,operation; call rax */
+			JitSetWord(kJitPC, op->pc + op->skip);
+			JitByte(0xBF); JitLong(op->fetch);
+			if (op->xy != 0) {
+				JitByte(0x48); JitByte(0xBE); JitAddress(op->xy);
+			}
+			JitByte(0x48); JitByte(0xB8); JitAddress((void *)op->operation);
+			JitByte(0xFF); JitByte(0xD0);
+			if (op->last)
+				JitExit(count);
+			else {
+				JitExitUnlessPC(next, count);
+				JitExitIfChanged(0, count);
+			}
+			break;
+
+		case kJitWrite:
+			JitExitIfChanged(next, count);
+			/* fall through */
+
+		case kJitNative:
+			if (op->last) {
+				JitSetWord(kJitPC, next);
+				JitExit(count);
+			}
+			break;
+
+		}
+
+		if (op->last)
+			break;
+
+	}
+
+	gJitAt[pc] = code;
+	gJitPage[pc / kCodePageSize] = 1;
+
+	return code;
+
+}
+
+static void JitCpu(void)
+{
+	static int opened;
+	BlockOpPtr block;
+	Byte *code;
+
+	if (!opened) {
+		opened = 1;
+		JitOpen();
+	}
+
+	for (;;) {
+
+		/* Blocks end ahead of breakpoints, see TranslateBlock(). */
+		if (CpuStep()) {
+			if (CpuFlags())
+				return;
+			DISPATCH();
+			continue;
+		}
+
+		if (gCodeChanged)
+			InvalidateBlocks();
+
+		/* Self modifying code is not worth translating. */
+		if (gJitDirty[PC / kCodePageSize] >= kJitMaxDirty) {
+			DISPATCH();
+			continue;
+		}
+
+		if ((block = gBlockAt[PC]) == 0)
+			block = TranslateBlock(PC);
+
+		if (((code = gJitAt[PC]) == 0) && (++block->hits == kJitHot))
+			code = JitBlock(PC);
+
+#ifdef WATCHPOINTS
+		/* Compiled code does not take the watchpoint trap path. */
+		if (gWatchArmed)
+			code = 0;
+#endif
+
+		/* GetSystemFlags() counted the first instruction. */
+		if (code != 0)
+			gCheckForInterrupts += (*gJitEnter)(code) - 1;
+		else {
+			block = gBlockAt[PC];
+			gCheckForInterrupts += RunBlock(block) - block - 1;
+		}
+
+	}
+
+}
+
+#endif
+
+#endif
+
+/**********************************************************************/
+#pragma mark BREAKPOINTS
+
+MACHINE Byte gBreakMap[65536 / 8];
+MACHINE unsigned gBreakCount;
+
+/* CpuBreak() sets or clears the breakpoint at address. With */
+/* BLOCK_CACHE, the blocks are translated again to end ahead of it. */
+void CpuBreak(Word address, int set)
+{
+
+	if (!set == !IsBreak(address))
+		return;
+
+	gBreakMap[address >> 3] ^= 1 << (address & 7);
+	if (set)
+		gBreakCount++;
+	else
+		gBreakCount--;
+
+#ifdef BLOCK_CACHE
+	FlushBlocks();
+#endif
+
+}
+
+/**********************************************************************/
+#pragma mark THREADED DISPATCH
+
+/* With THREADED defined (GNU C labels as values), Cpu() runs a direct
+ * threaded interpreter instead of the operation[] function pointer
+ * loop. Every OPERATION() of every table becomes a label that executes
+ * its handler inline and then jumps straight to the label of the next
+ * opcode. The prefix handlers jump into their sub tables rather than
+ * calling through a second function pointer. Both engines are built
+ * from the same op*.h tables, and both check the system flags before
+ * every instruction.
+ *
+ * With CACHED_REGISTERS, the check before every instruction is made
+ * on the cached count, and only when it calls for CpuStop() are the
+ * registers saved (and loaded again if the run goes on).
+ */
+
+#ifdef THREADED
+
+#ifdef BLOCK_CACHE
+#define THREAD_NEXT \
+	if (!(op++)->last && (PC == op->pc) && !gCodeChanged) { \
+		PC += op->skip; \
+		fetch = op->fetch; \
+		xy = op->xy; \
+		goto *op->operation; \
+	} \
+	goto block
+#elif defined(CACHED_REGISTERS)
+#define THREAD_NEXT \
+	if (CachedStop()) \
+		goto sync; \
+	cache->check++; \
+	THREAD_FETCH
+#else
+#define THREAD_NEXT \
+	if (CpuStop()) \
+		return; \
+	THREAD_FETCH
+#endif
+
+/* THREAD_FETCH fetches the next instruction and jumps to its label. */
+#define THREAD_FETCH \
+	fetch = RdFetch(PC++, length); \
+	goto *thread[(Byte)fetch]
+
+/* CachedStop() is non-zero when CpuStop() has anything to do: the */
+/* poll is due (see GetSystemFlags()), a flag is set, PC (the cached */
+/* one) is at a breakpoint, or a history is kept. */
+#ifdef REVERSE
+#define CachedStop() \
+	((cache->check > kCheckForInterrupts) | gSystemFlags | \
+	 (gBreakCount && IsBreak(PC)) | (gHistory != 0))
+#else
+#define CachedStop() \
+	((cache->check > kCheckForInterrupts) | gSystemFlags | \
+	 (gBreakCount && IsBreak(PC)))
+#endif
+
+#define THREAD_LABEL(INDEX) THREAD_TABLE(INDEX)
+
+#ifdef CACHED_REGISTERS
+#undef REGISTERS
+#define REGISTERS (*cache)
+#define RdFetch(ADDRESS, LENGTHS) \
+	RdBankFetch(cache->flat, (ADDRESS), (LENGTHS))
+#endif
+
+/* Global common subexpression elimination merges the jumps to the */
+/* next label into one, which undoes the threading (see the GCC manual */
+/* on -fgcse), once the fetch is more than a byte. */
+__attribute__((optimize("no-gcse")))
+static void ThreadedCpu(void)
+{
+	unsigned long fetch;
+	WordBytes *xy = 0;
+#ifdef CACHED_REGISTERS
+	Byte *rdBanks[kMaxBank];
+	Byte *wrBanks[kMaxBank];
+	CachedRegisters registers = { .rdBanks = rdBanks, .wrBanks = wrBanks };
+	CachedRegisters *const cache = &registers;
+#endif
+
+#define OPERATION(INDEX, CODE, JMP, N8080, NZ80, F8080, FZ80, T8080, TZ80) \
+	&&THREAD_LABEL(INDEX),
+
+#ifdef Z80
+
+#define THREAD_TABLE(INDEX) CB_##INDEX
+	static const void *const thread_CB[256] = {
+#include "opcb.h"
+	};
+#undef THREAD_TABLE
+
+#define THREAD_TABLE(INDEX) ED_##INDEX
+	static const void *const thread_ED[256] = {
+#include "oped.h"
+	};
+#undef THREAD_TABLE
+
+#define THREAD_TABLE(INDEX) DD_##INDEX
+	static const void *const thread_DD[256] = {
+#include "opdd.h"
+	};
+#undef THREAD_TABLE
+
+#define THREAD_TABLE(INDEX) DDCB_##INDEX
+	static const void *const thread_DDCB[256] = {
+#include "opddcb.h"
+	};
+#undef THREAD_TABLE
+
+#endif
+
+#define THREAD_TABLE(INDEX) OP_##INDEX
+	static const void *const thread[256] = {
+#include "op.h"
+	};
+#undef THREAD_TABLE
+
+#undef OPERATION
+
+#ifdef BLOCK_CACHE
+#define FUSE(FIRST, SECOND, F1, F2) &&FUSE_##F1##__##F2,
+	static const void *const thread_FUSE[] = {
+#include "opfuse.h"
+	};
+#undef FUSE
+#endif
+
+/* The prefix handlers become jumps into the sub tables; */
+/* FD shares the DD labels, with xy at IY. */
+#ifdef Z80
+#define CB_OP(...) \
+	fetch = RdFetch(PC++, length_CB); goto *thread_CB[(Byte)fetch]
+#define ED_OP(...) \
+	fetch = RdFetch(PC++, length_ED); goto *thread_ED[(Byte)fetch]
+#define DD_OP(...) \
+	xy = &gCpuState.ix; \
+	fetch = RdFetch(PC++, length_DD); goto *thread_DD[(Byte)fetch]
+#define FD_OP(...) \
+	xy = &gCpuState.iy; \
+	fetch = RdFetch(PC++, length_DD); goto *thread_DD[(Byte)fetch]
+#define XYCB_OP(...) \
+	fetch = RdFetch(PC - 1, length_DDCB); PC += 2; \
+	goto *thread_DDCB[(Byte)(fetch >> 16)]
+#define OPERATION(INDEX, CODE, JMP, N8080, NZ80, F8080, FZ80, T8080, TZ80) \
+	THREAD_LABEL(INDEX): CYCLES += TZ80; FZ80(CACHED_ fetch, xy); THREAD_NEXT;
+#else
+#define OPERATION(INDEX, CODE, JMP, N8080, NZ80, F8080, FZ80, T8080, TZ80) \
+	THREAD_LABEL(INDEX): CYCLES += T8080; F8080(CACHED_ fetch, xy); THREAD_NEXT;
+#endif
+
+#ifdef BLOCK_CACHE
+
+	/* The block records hold label addresses. */
+	static BlockOp step = { 0, 0, 0, 1 };
+	BlockOpPtr block = &step;
+	BlockOpPtr op = block + 1;
+
+	gBlockOperation[kOpTable] = thread;
+#ifdef Z80
+	gBlockOperation[kCBTable] = thread_CB;
+	gBlockOperation[kEDTable] = thread_ED;
+	gBlockOperation[kDDTable] = thread_DD;
+	gBlockOperation[kDDCBTable] = thread_DDCB;
+	gBlockOperation[kFDTable] = thread_DD;
+	gBlockOperation[kFDCBTable] = thread_DDCB;
+#endif
+	gFuseOperation = thread_FUSE;
+
+block:
+
+	/* GetSystemFlags() counts the first instruction. */
+	gCheckForInterrupts += op - block - 1;
+
+	/* Step one instruction while any system flag is set, */
+	/* and at a breakpoint, see TranslateBlock(). */
+	if (CpuStep()) {
+		if (CpuFlags())
+			return;
+		block = op = &step;
+		THREAD_FETCH;
+	}
+
+	if (gCodeChanged)
+		InvalidateBlocks();
+
+	if ((block = gBlockAt[PC]) == 0)
+		block = TranslateBlock(PC);
+
+	op = block;
+	PC += op->skip;
+	fetch = op->fetch;
+	xy = op->xy;
+	goto *op->operation;
+
+#elif defined(CACHED_REGISTERS)
+
+	LoadRegisters(cache);
+	THREAD_NEXT;
+
+	/* CpuStop() counts the instruction, and may take an interrupt, */
+	/* poll the system or enter the monitor, all on gCpuState. */
+sync:
+	SaveRegisters(cache);
+	if (CpuStop())
+		return;
+	LoadRegisters(cache);
+	THREAD_FETCH;
+
+#else
+
+	THREAD_NEXT;
+
+#endif
+
+#ifdef Z80
+
+#define THREAD_TABLE(INDEX) CB_##INDEX
+#include "opcb.h"
+#undef THREAD_TABLE
+
+#define THREAD_TABLE(INDEX) ED_##INDEX
+#include "oped.h"
+#undef THREAD_TABLE
+
+#define THREAD_TABLE(INDEX) DD_##INDEX
+#include "opdd.h"
+#undef THREAD_TABLE
+
+#define THREAD_TABLE(INDEX) DDCB_##INDEX
+#include "opddcb.h"
+#undef THREAD_TABLE
+
+#endif
+
+#define THREAD_TABLE(INDEX) OP_##INDEX
+#include "op.h"
+#undef THREAD_TABLE
+
+#undef OPERATION
+
+/* The pairs of opfuse.h, see FuseBlockOps(); the record counts */
+/* the T-states of both. */
+#ifdef BLOCK_CACHE
+#define FUSE(FIRST, SECOND, F1, F2) \
+	FUSE_##F1##__##F2: \
+	CYCLES += op->cycles; \
+	F1(CACHED_ fetch, xy); \
+	PC++; \
+	F2(CACHED_ fetch >> 8, xy); \
+	gCheckForInterrupts++; \
+	THREAD_NEXT;
+#include "opfuse.h"
+#undef FUSE
+#endif
+
+#ifdef Z80
+#undef CB_OP
+#undef ED_OP
+#undef DD_OP
+#undef FD_OP
+#undef XYCB_OP
+#endif
+
+}
+
+#ifdef CACHED_REGISTERS
+#undef REGISTERS
+#define REGISTERS gCpuState
+#undef RdFetch
+#endif
+
+#endif
+
+void Cpu(void)
+{
+
+#ifdef CALCULATE_TABLES
+	CalculateTables();
 #endif
 
-	while (!GetSystemFlags() || !MonitorFlags(&gCpuState))
-		(*operation[RdByte(PC++)])();
+#if defined(JIT)
+	JitCpu();
+#elif defined(THREADED)
+	ThreadedCpu();
+#elif defined(BLOCK_CACHE)
+	BlockCpu();
+#else
+	while (!CpuStop())
+		DISPATCH();
+#endif
 
 }
@@ -1 +1 @@
-/* uSim cpu.h * Copyright (C) 2000, Tsurishaddai Williamson, tsuri@earthlink.net *  * This program is free software; you can redistribute it and/or * modify it under the terms of the GNU General Public License * as published by the Free Software Foundation; either version 2 * of the License, or (at your option) any later version. *  * This program is distributed in the hope that it will be useful, * but WITHOUT ANY WARRANTY; without even the implied warranty of * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the * GNU General Public License for more details. *  * You should have received a copy of the GNU General Public License * along with this program; if not, write to the Free Software * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA. *//**********************************************************************/#ifdef Z80#define CPU "Z80"#else#define CPU "i8080"#endifstruct CpuState {	WordBytes af;	WordBytes bc;	WordBytes de;	WordBytes hl;	WordBytes sp;	WordBytes pc;#ifdef Z80	WordBytes ix;	WordBytes iy;	struct {		WordBytes af;		WordBytes bc;		WordBytes de;		WordBytes hl;	} prime;	Byte i;	Byte r;	Byte im;#endif};enum {	CARRY		= 0x01,	SUBTRACT	= 0x02,	PARITY		= 0x04,	OVERFLOW	= 0x04,	MAGIC1		= 0x08,	HALFCARRY	= 0x10,	MAGIC2		= 0x20,	ZERO		= 0x40,	SIGN		= 0x80};extern void InitCpuToMonitor(void);extern void Cpu(void);
\ No newline at end of file
+/* uSim cpu.h * Copyright (C) 2000, Tsurishaddai Williamson, tsuri@earthlink.net *  * This program is free software; you can redistribute it and/or * modify it under the terms of the GNU General Public License * as published by the Free Software Foundation; either version 2 * of the License, or (at your option) any later version. *  * This program is distributed in the hope that it will be useful, * but WITHOUT ANY WARRANTY; without even the implied warranty of * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the * GNU General Public License for more details. *  * You should have received a copy of the GNU General Public License * along with this program; if not, write to the Free Software * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA. *//**********************************************************************/#ifdef Z80#define CPU "Z80"#else#define CPU "i8080"#endifstruct CpuState {	WordBytes af;	WordBytes bc;	WordBytes de;	WordBytes hl;	WordBytes sp;	WordBytes pc;#ifdef Z80	WordBytes ix;	WordBytes iy;	struct {		WordBytes af;		WordBytes bc;		WordBytes de;		WordBytes hl;	} prime;	Byte i;	Byte r;	Byte im;#endif	Byte iff1;	/* Interrupts enabled (INTE on the i8080). */	Byte iff2;	/* IFF1 saved by an NMI, restored by RETN. */	Byte halt;	/* HALT is waiting for an interrupt. */	unsigned long long cycles;};enum {	CARRY		= 0x01,	SUBTRACT	= 0x02,	PARITY		= 0x04,	OVERFLOW	= 0x04,	MAGIC1		= 0x08,	HALFCARRY	= 0x10,	MAGIC2		= 0x20,	ZERO		= 0x40,	SIGN		= 0x80};extern void InitCpuToMonitor(void);extern void Cpu(void);extern void CpuInterrupt(int level, Byte vector);extern void CpuNMI(void);/* CpuCurrentState() returns the CPU state; it is up to date when *//* Cpu() polls the system (see GetSystemFlags()) or stops. */extern CpuStatePtr CpuCurrentState(void);/* gBreakMap[] has a bit for each address the CPU breaks at. Cpu() *//* tests the bit for PC itself and calls MonitorFlags() on a hit, so *//* breakpoints do not need kSystemBreak. Set bits with CpuBreak(). */extern MACHINE Byte gBreakMap[65536 / 8];extern MACHINE unsigned gBreakCount;extern void CpuBreak(Word address, int set);static inline int IsBreak(Word address){	return gBreakMap[address >> 3] & (1 << (address & 7));}#ifdef REVERSE/* With REVERSE defined, Cpu() can keep a ring of the CPU state before * each of the last instructions executed, and the memory undo log (see * memory.h) of the bytes they wrote. CpuHistory() sets the number of * instructions kept, rounded up to a power of two, or zero to keep * none. CpuHistoryDepth() returns how many can still be rewound, and * CpuHistoryState() the state n instructions back, 1 being the last. * CpuBackstep() rewinds the CPU and memory n instructions; the devices * and the bank mapping are not rewound. */extern int CpuHistory(unsigned long size);extern unsigned long CpuHistorySize(void);extern unsigned long CpuHistoryDepth(void);extern CpuStatePtr CpuHistoryState(unsigned long n);extern int CpuBackstep(unsigned long n);#endif
\ No newline at end of file
@@ -32,9 +32,16 @@
 #include "monitor.h"
 #include "bdev.h"
 #include "cdev.h"
+#include "clock.h"
+
+#if defined(SGTTY) || defined(TERMIOS)
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#endif
 
 /**********************************************************************/
-#pragma mark *** MAIN ***
+#pragma mark *** MACHINE ***
 
 #define kMaxRom (64 * 1024)
 
@@ -78,30 +85,48 @@ static const char *gAboutText =
 	"Note: Use <ESCAPE><ESCAPE> to enter the monitor.\n"
 	"      Use <ESCAPE><ESCAPE><ESCAPE> to quit.";
 
-int main(void)
+static Byte *gRom = 0;
+static Byte *gRam = 0;
+static Byte *gBitBucket = 0;
+
+/* MachineClose() deallocates the machine. */
+static void MachineClose(void)
 {
-	Byte *rom = 0;
-	Byte *ram = 0;
-	Byte *bitBucket = 0;
 
-	/* Open the console. */
-	if (!ConsoleOpen(gWindowTitle, gAboutTitle, gAboutText))
-		goto error;
+	BDevUnmount(0);
+	CDevDetach(0);
+	MonitorClose();
+	MemoryClose();
+	if (gBitBucket != 0)
+		free(gBitBucket);
+	gBitBucket = 0;
+	if (gRam != 0)
+		free(gRam);
+	gRam = 0;
+	if (gRom != 0)
+		free(gRom);
+	gRom = 0;
+
+}
+
+/* MachineOpen() prepares the memory system and the I/O ports. */
+static int MachineOpen(void)
+{
 
 	/* Prepare the memory system. */
-	if ((rom = malloc(kMaxRom)) == 0) {
+	if ((gRom = malloc(kMaxRom)) == 0) {
 		SystemMessage("?MALLOC [rom]\n");
 		goto error;
 	}
-	if ((ram = malloc(kMaxRam)) == 0) {
+	if ((gRam = malloc(kMaxRam)) == 0) {
 		SystemMessage("?MALLOC [ram]\n");
 		goto error;
 	}
-	if ((bitBucket = malloc(kBankSize)) == 0) {
+	if ((gBitBucket = malloc(kBankSize)) == 0) {
 		SystemMessage("?MALLOC [bitBucket]\n");
 		goto error;
 	}
-	if (!MemoryOpen(rom, kMaxRom, ram, kMaxRam, bitBucket)) {
+	if (!MemoryOpen(gRom, kMaxRom, gRam, kMaxRam, gBitBucket)) {
 		SystemMessage("?MEMORY\n");
 		goto error;
 	}
@@ -109,28 +134,523 @@ int main(void)
 	/* Prepare the I/O ports. */
 	SetupSystemPorts();
 
-  InitCpuToMonitor();
+	InitCpuToMonitor();
+
+	/* All done, no error, return non-zero. */
+	return 1;
+
+	/* Return zero if there was an error. */
+error:
+	MachineClose();
+	return 0;
+
+}
+
+/**********************************************************************/
+#pragma mark *** BATCH ***
+
+/* uSim -b JOBFILE runs CP/M jobs without a terminal, each in its own
+ * process, up to -j at a time (by default one per processor). Each
+ * line of the JOBFILE is a job:
+ *
+ *     DISK TIMEOUT OUTPUT COMMAND!COMMAND...
+ *
+ * DISK is mounted as A:, and the COMMANDs (or the lines of the file
+ * @FILE) are typed into CP/M one at a time, each once the previous
+ * one waits for input. Everything printed goes to the file OUTPUT.
+ * A job ends when the machine halts (HALT with interrupts disabled,
+ * or SYSHLT written to the SYSFLG port), after it has waited -i
+ * seconds for input with no COMMANDs left, or after TIMEOUT seconds.
+ * Jobs run at the same time must not write to the same DISK.
+ * With --restore SNAPSHOT, a job whose DISK is "-" starts from the
+ * SNAPSHOT (see the SNAPSHOT command), with its disks, instead of
+ * booting.
+ *
+ * A job whose DISK is "=" is a clone of the nearest job above it that
+ * is not: once that job has gone idle, its process forks a clone for
+ * each, up to -j at a time, and each clone carries on from that very
+ * machine state with its own COMMANDs and OUTPUT. The memory is shared
+ * copy-on-write, and the writes of each clone to its disks are kept
+ * private (see BDevPrivate()). Lines beginning with ';' are comments.
+ */
+
+#if defined(SGTTY) || defined(TERMIOS)
+
+#define kBatchIdle 5
+
+#define kMaxJobLine 1024
+
+typedef struct Batch Batch;
+typedef Batch *BatchPtr;
+
+struct Batch {
+	unsigned workers;
+	unsigned idleSeconds;
+	const char *restore;
+};
+
+typedef struct Job Job;
+typedef Job *JobPtr;
+
+struct Job {
+	char *disk;
+	unsigned timeout;
+	char *output;
+	char *commands;
+	int clones;
+};
+
+typedef int (*JobFunction)(JobPtr, int, BatchPtr);
+
+/* JobCommands() returns the command lines of a job, malloc()'ed. */
+static char *JobCommands(char *commands)
+{
+	char *result;
+	FILE *f;
+	long size;
+	char *s;
+
+	/* @FILE reads the command lines from the FILE. */
+	if (*commands == '@') {
+		if ((f = fopen(&commands[1], "r")) == 0)
+			goto error;
+		fseek(f, 0, SEEK_END);
+		size = ftell(f);
+		rewind(f);
+		if ((result = malloc(size + 1)) == 0) {
+			fclose(f);
+			goto error;
+		}
+		size = fread(result, 1, size, f);
+		result[size] = 0;
+		fclose(f);
+	}
+	/* Otherwise '!' separates the command lines. */
+	else {
+		if ((result = malloc(strlen(commands) + 1)) == 0)
+			goto error;
+		strcpy(result, commands);
+		for (s = result; *s != 0; s++)
+			if (*s == '!')
+				*s = '\n';
+	}
+
+	return result;
+
+error:
+	return 0;
+
+}
+
+/* ReadJobs() reads the JOBFILE, returning the number of jobs. */
+static int ReadJobs(const char *name, JobPtr *jobs)
+{
+	char line[kMaxJobLine];
+	JobPtr job;
+	FILE *f;
+	int n = 0;
+	int parent = -1;
+	char *timeout;
+	char *commands;
+
+	*jobs = 0;
+
+	if ((f = fopen(name, "r")) == 0) {
+		fprintf(stderr, "?OPEN [%s]\n", name);
+		goto error;
+	}
+
+	while (fgets(line, sizeof(line), f) != 0) {
+		line[strcspn(line, "\r\n")] = 0;
+		if ((line[0] == ';') || (strspn(line, " \t") == strlen(line)))
+			continue;
+		if ((job = realloc(*jobs, (n + 1) * sizeof(Job))) == 0)
+			goto error;
+		*jobs = job;
+		job = &job[n];
+		if (((job->disk = strtok(line, " \t")) == 0) ||
+		    ((timeout = strtok(0, " \t")) == 0) ||
+		    ((job->output = strtok(0, " \t")) == 0) ||
+		    ((commands = strtok(0, "")) == 0)) {
+			fprintf(stderr, "?JOB [%s:%d]\n", name, n + 1);
+			goto error;
+		}
+		/* A clone belongs to the nearest job above that is not. */
+		job->clones = 0;
+		if (strcmp(job->disk, "="))
+			parent = n;
+		else if (parent < 0) {
+			fprintf(stderr, "?CLONE [%s:%d]\n", name, n + 1);
+			goto error;
+		}
+		else
+			(*jobs)[parent].clones++;
+		commands += strspn(commands, " \t");
+		job->timeout = (unsigned)strtoul(timeout, 0, 10);
+		job->disk = strdup(job->disk);
+		job->output = strdup(job->output);
+		if ((job->commands = JobCommands(commands)) == 0) {
+			fprintf(stderr, "?COMMANDS [%s]\n", commands);
+			goto error;
+		}
+		n++;
+	}
+
+	fclose(f);
+
+	return n;
+
+error:
+	if (f != 0)
+		fclose(f);
+	return -1;
+
+}
+
+/* JobOpen() opens the batch console on the OUTPUT file of a job. */
+static FILE *JobOpen(JobPtr job, int number, BatchPtr batch)
+{
+	FILE *output;
+
+	if ((output = fopen(job->output, "w")) == 0)
+		goto error;
+
+	if (!ConsoleOpenBatch(output,
+	                      job->commands,
+	                      batch->idleSeconds,
+	                      job->timeout)) {
+		fclose(output);
+		goto error;
+	}
+
+	return output;
+
+error:
+	fprintf(stdout,
+	        "%d %s ERROR ?OPEN [%s]\n",
+	        number,
+	        job->disk,
+	        job->output);
+	return 0;
+
+}
+
+/* JobReport() reports how a job ended on stdout. */
+/* Returns the batch console status. */
+static int
+	JobReport(JobPtr job,
+	          int number,
+	          unsigned long instructions,
+	          unsigned long start)
+{
+	static const char *status[] = { "HALT", "IDLE", "TIMEOUT" };
+	unsigned long ms = GetTicks() - start;
+	int result = ConsoleBatchStatus();
+
+	fprintf(stdout,
+	        "%d %s %s %lu instructions %lu.%03lu seconds\n",
+	        number,
+	        job->disk,
+	        status[result],
+	        instructions,
+	        ms / 1000,
+	        ms % 1000);
+	fflush(stdout);
+
+	return result;
+
+}
+
+/* RunJobs() runs n jobs, each in a process of its own, with */
+/* batch->workers at a time. Returns non-zero if any job failed. */
+static int
+	RunJobs(JobPtr jobs,
+	        int n,
+	        int number,
+	        BatchPtr batch,
+	        JobFunction run)
+{
+	unsigned running = 0;
+	int failed = 0;
+	int status;
+	int next;
+	pid_t pid;
+
+	/* Start a job whenever a worker is free. */
+	for (next = 0; (next < n) || (running > 0); ) {
+		if ((next < n) && (running < batch->workers)) {
+			fflush(0);
+			if ((pid = fork()) == 0)
+				exit(run(&jobs[next], number + next, batch));
+			if (pid < 0) {
+				fprintf(stdout,
+				        "%d %s ERROR ?FORK\n",
+				        number + next,
+				        jobs[next].disk);
+				failed = 1;
+			}
+			else
+				running++;
+			/* The clones of a job are run by its process. */
+			next += 1 + jobs[next].clones;
+		}
+		else if (wait(&status) > 0) {
+			running--;
+			if (!WIFEXITED(status) || (WEXITSTATUS(status) != 0))
+				failed = 1;
+		}
+		else
+			break;
+	}
+
+	return failed;
+
+}
+
+/* RunClone() runs a clone, from the machine state it was forked */
+/* with. Returns the exit status for the clone's process. */
+static int RunClone(JobPtr job, int number, BatchPtr batch)
+{
+	unsigned long start = GetTicks();
+	unsigned long instructions = SystemInstructions();
+	FILE *output;
+	int result;
+
+	/* Open the batch console on the OUTPUT file. */
+	if ((output = JobOpen(job, number, batch)) == 0)
+		return 1;
+
+	/* Keep the writes to the disks private. */
+	if (!BDevPrivate())
+		goto error;
+
+	/* Carry on running the CPU until halted. */
+	SetSystemFlags(0, kSystemHalt);
+	Cpu();
+
+	result = JobReport(job,
+	                   number,
+	                   SystemInstructions() - instructions,
+	                   start);
+
+	MachineClose();
+	ConsoleClose();
+	fclose(output);
+
+	/* A clone that timed out failed. */
+	return result == kConsoleBatchTimeout;
+
+error:
+	fprintf(stdout,
+	        "%d %s ERROR see %s\n",
+	        number,
+	        job->disk,
+	        job->output);
+	MachineClose();
+	ConsoleClose();
+	fclose(output);
+	return 1;
 
-	/* Issue the BOOT command. */
-	MonitorCommand("BOOT");
+}
+
+/* RunJob() runs one job, and then its clones. */
+/* Returns the exit status for the job's process. */
+static int RunJob(JobPtr job, int number, BatchPtr batch)
+{
+	unsigned long start = GetTicks();
+	FILE *output;
+	int result;
+	int failed = 0;
+	int i;
+
+	/* Open the batch console on the OUTPUT file. */
+	if ((output = JobOpen(job, number, batch)) == 0)
+		return 1;
+
+	if (!MachineOpen())
+		goto error;
+
+	/* Restore the snapshot and GO... */
+	if (!strcmp(job->disk, "-")) {
+		if ((batch->restore == 0) ||
+		    !MonitorCommand("SNAPSHOT LOAD %s", batch->restore) ||
+		    !MonitorCommand("GO"))
+			goto error;
+	}
+	/* or RESET, LOAD, MOUNT the DISK and GO. */
+	else if (!MonitorCommand("RESET") ||
+	    !MonitorCommand("LOAD") ||
+	    !MonitorCommand("MOUNT A:%s", job->disk) ||
+	    !MonitorCommand("GO"))
+		goto error;
+
+	/* Run the CPU until halted. */
+	Cpu();
+
+	result = JobReport(job, number, SystemInstructions(), start);
+
+	/* Fork the clones from the idle machine. */
+	if (job->clones > 0) {
+		if (result == kConsoleBatchIdle)
+			failed = RunJobs(&job[1],
+			                 job->clones,
+			                 number + 1,
+			                 batch,
+			                 RunClone);
+		else {
+			for (i = 1; i <= job->clones; i++)
+				fprintf(stdout,
+				        "%d %s ERROR ?NOT IDLE\n",
+				        number + i,
+				        job[i].disk);
+			failed = 1;
+		}
+	}
+
+	MachineClose();
+	ConsoleClose();
+	fclose(output);
+
+	/* A job that timed out failed. */
+	return (result == kConsoleBatchTimeout) || failed;
+
+error:
+	fprintf(stdout,
+	        "%d %s ERROR see %s\n",
+	        number,
+	        job->disk,
+	        job->output);
+	MachineClose();
+	ConsoleClose();
+	fclose(output);
+	return 1;
+
+}
+
+/* RunBatch() runs the jobs of the JOBFILE. */
+/* Returns non-zero if any job failed. */
+static int RunBatch(const char *name, BatchPtr batch)
+{
+	JobPtr jobs;
+	int failed;
+	int n;
+	int i;
+
+	if ((n = ReadJobs(name, &jobs)) < 0)
+		goto error;
+
+	if (batch->workers == 0)
+		batch->workers = (unsigned)sysconf(_SC_NPROCESSORS_ONLN);
+	if (batch->workers == 0)
+		batch->workers = 1;
+
+	failed = RunJobs(jobs, n, 1, batch, RunJob);
+
+	for (i = 0; i < n; i++) {
+		free(jobs[i].disk);
+		free(jobs[i].output);
+		free(jobs[i].commands);
+	}
+	free(jobs);
+
+	return failed;
+
+error:
+	free(jobs);
+	return 1;
+
+}
+
+#endif
+
+/**********************************************************************/
+#pragma mark *** MAIN ***
+
+int main(int argc, char **argv)
+{
+	const char *jobFile = 0;
+	const char *restore = 0;
+	unsigned workers = 0;
+	unsigned idleSeconds = 0;
+	int i;
+#if defined(SGTTY) || defined(TERMIOS)
+	Batch batch;
+#endif
+
+	/* Parse the command line switches. */
+	for (i = 1; (i < argc) && (*(argv[i]) == '-'); i++) {
+		char *token = argv[i];
+		if (++i >= argc)
+			goto usage;
+		if (!strcmp(token, "--restore")) {
+			restore = argv[i];
+			continue;
+		}
+		if (token[2] != 0)
+			goto usage;
+		switch (token[1]) {
+		case 'b':
+			jobFile = argv[i];
+			break;
+		case 'j':
+			workers = (unsigned)strtoul(argv[i], 0, 10);
+			break;
+		case 'i':
+			idleSeconds = (unsigned)strtoul(argv[i], 0, 10);
+			break;
+		default:
+			goto usage;
+		}
+	}
+	/* No more arguments are allowed. */
+	if (i < argc)
+		goto usage;
+
+	/* Run the batch of jobs. */
+	if (jobFile != 0) {
+#if defined(SGTTY) || defined(TERMIOS)
+		batch.workers = workers;
+		batch.idleSeconds = (idleSeconds != 0) ? idleSeconds : kBatchIdle;
+		batch.restore = restore;
+		return RunBatch(jobFile, &batch);
+#else
+		goto usage;
+#endif
+	}
+
+	/* Open the console. */
+	if (!ConsoleOpen(gWindowTitle, gAboutTitle, gAboutText))
+		goto error;
+
+	/* Prepare the machine. */
+	if (!MachineOpen())
+		goto error;
+
+	/* Restore the snapshot and GO, or issue the BOOT command. */
+	if (restore != 0) {
+		if (!MonitorCommand("SNAPSHOT LOAD %s", restore) ||
+		    !MonitorCommand("GO"))
+			goto error;
+	}
+	else
+		MonitorCommand("BOOT");
 
 	/* Run the CPU until halted. */
 	Cpu();
 
 	/* All done, deallocate everything and exit. */
 error:
-	BDevUnmount(0);
-	CDevDetach(0);
-	MonitorClose();
-	MemoryClose();
-	if (bitBucket != 0)
-		free(bitBucket);
-	if (ram != 0)
-		free(ram);
-	if (rom != 0)
-		free(rom);
+	MachineClose();
 	ConsoleClose();
 
 	return 0;
 
+	/* Command line syntax error. */
+usage:
+	fprintf(stderr,
+	        "usage: %s [ --restore SNAPSHOT ]"
+	        " [ -j WORKERS ] [ -i IDLESECONDS ] [ -b JOBFILE ]\n",
+	        argv[0]);
+	return 1;
+
 }
@@ -20,14 +20,17 @@
 
 #include "ustdio.h"
 #include <string.h>
+#include <stdlib.h>
 
 #include "memory.h"
+#include "system.h"
+#include "snapshot.h"
 
 /**********************************************************************/
 #pragma mark *** MEMORY ***
 
 #pragma mark struct Memory
-static struct Memory {
+static MACHINE struct Memory {
 
 	unsigned long maxRom;
 	unsigned minRomBank;
@@ -41,11 +44,371 @@ static struct Memory {
 
 	Byte *bitBucket;
 	unsigned index[kMaxBank];
+	Byte *rdBank[kMaxBank];
+	Byte *wrBank[kMaxBank];
+
+#ifdef DIRTY_PAGES
+	unsigned long *dirty;
+#endif
 
 } gMemory;
 
-Byte *gRdBank[kMaxBank];
-Byte *gWrBank[kMaxBank];
+MACHINE Byte *gRdBank[kMaxBank];
+MACHINE Byte *gWrBank[kMaxBank];
+
+MACHINE Byte *gFlat;
+
+/* MapFlat() sets gFlat if the logical banks, as mapped, are 64K of */
+/* contiguous RAM that is read and written alike. */
+static void MapFlat(void)
+{
+	unsigned logical;
+
+	gFlat = 0;
+
+	for (logical = 0; logical < kMaxBank; logical++)
+		if ((gRdBank[logical] == 0) ||
+		    (gRdBank[logical] != gRdBank[0] + (logical * kBankSize)) ||
+		    (gWrBank[logical] != gRdBank[logical]))
+			return;
+
+	gFlat = gRdBank[0];
+
+}
+
+#ifdef BLOCK_CACHE
+
+/**********************************************************************/
+#pragma mark *** CODE PAGES ***
+
+#define kBankPages (kBankSize / kCodePageSize)
+
+MACHINE Byte gCodeMap[65536];
+MACHINE Byte gCodePage[kMaxCodePage];
+MACHINE Byte gCodeStale[kMaxCodePage];
+MACHINE Byte gCodeChanged;
+
+/* StaleCodePage() forgets the code in a page and marks it stale. */
+static void StaleCodePage(unsigned page)
+{
+
+	MemoryZero(&gCodeMap[page * kCodePageSize], kCodePageSize);
+	gCodePage[page] = 0;
+	gCodeStale[page] = 1;
+	gCodeChanged = 1;
+
+}
+
+/* MarkCode() marks size bytes at address, and every logical */
+/* address that maps the same physical memory, as cached code. */
+void MarkCode(Word address, Word size)
+{
+	unsigned physical;
+	unsigned logical;
+	Word alias;
+
+	for (; size--; address++) {
+		physical = gMemory.index[address / kBankSize];
+		for (logical = 0; logical < kMaxBank; logical++)
+			if (gMemory.index[logical] == physical) {
+				alias = logical * kBankSize + address % kBankSize;
+				gCodeMap[alias] = 1;
+				gCodePage[alias / kCodePageSize] = 1;
+			}
+	}
+
+}
+
+/* CodeWritten() marks the code page holding address, and all */
+/* of its aliases, as stale. WrByte() and RwByte() call it. */
+void CodeWritten(Word address)
+{
+	unsigned physical = gMemory.index[address / kBankSize];
+	unsigned page = (address / kCodePageSize) % kBankPages;
+	unsigned logical;
+
+	for (logical = 0; logical < kMaxBank; logical++)
+		if (gMemory.index[logical] == physical)
+			StaleCodePage(logical * kBankPages + page);
+
+}
+
+/* CodeWrittenBytes() calls CodeWritten() if any of size bytes */
+/* at address, all in one code page, holds cached code. */
+void CodeWrittenBytes(Word address, Word size)
+{
+
+	for (; size--; address++)
+		if (gCodeMap[address]) {
+			CodeWritten(address);
+			break;
+		}
+
+}
+
+/* FlushCodePages() marks every code page as stale. */
+void FlushCodePages(void)
+{
+	unsigned page;
+
+	for (page = 0; page < kMaxCodePage; page++)
+		if (gCodePage[page])
+			StaleCodePage(page);
+
+}
+
+#endif
+
+#ifdef DIRTY_PAGES
+
+/**********************************************************************/
+#pragma mark *** DIRTY PAGES ***
+
+MACHINE unsigned long *gWrDirty[kMaxBank];
+MACHINE unsigned long gDirtyEpoch;
+
+/* The stamps of the pages of physical bank n. The bit bucket has */
+/* a bank of stamps of its own, after the RAM, never looked at. */
+#define DirtyBank(n) (&gMemory.dirty[(n) * kBankDirtyPages])
+
+/* DirtyAll() stamps every page, after writes that bypass gWrBank[]. */
+static void DirtyAll(void)
+{
+	unsigned page;
+
+	if (gMemory.dirty != 0)
+		for (page = 0; page < MaxDirtyPage(); page++)
+			gMemory.dirty[page] = gDirtyEpoch;
+
+}
+
+/* NewDirtyEpoch() starts a new epoch, and returns its number. */
+unsigned long NewDirtyEpoch(void)
+{
+
+	return ++gDirtyEpoch;
+
+}
+
+/* MaxDirtyPage() returns the number of pages of ROM and RAM. */
+/* Page n is at physical bank n / kBankDirtyPages. */
+unsigned MaxDirtyPage(void)
+{
+
+	return gMemory.maxRamBank * kBankDirtyPages;
+
+}
+
+/* PagesWritten() returns the number of pages written since the */
+/* start of the epoch, and sets their bits in the bitmap (if not */
+/* zero) of MaxDirtyPage() bits, clearing the others. */
+unsigned PagesWritten(unsigned long epoch, Byte *bitmap)
+{
+	unsigned count = 0;
+	unsigned page;
+	Byte bit;
+
+	for (page = 0; page < MaxDirtyPage(); page++) {
+		bit = (Byte)(1 << (page % 8));
+		if (gMemory.dirty[page] >= epoch) {
+			count++;
+			if (bitmap != 0)
+				bitmap[page / 8] |= bit;
+		}
+		else if (bitmap != 0)
+			bitmap[page / 8] &= (Byte)~bit;
+	}
+
+	return count;
+
+}
+
+#endif
+
+#ifdef WATCHPOINTS
+
+/**********************************************************************/
+#pragma mark *** WATCH ***
+
+MACHINE Watch gWatch[kMaxWatch];
+MACHINE unsigned gMaxWatch;
+MACHINE Word gWatchHitAddress;
+MACHINE Byte gWatchHitKind;
+MACHINE int gWatchArmed;
+
+/* WatchKinds() returns the kinds of watchpoint in a logical bank. */
+static unsigned WatchKinds(unsigned logical)
+{
+	unsigned long first = (unsigned long)logical * kBankSize;
+	unsigned long last = first + kBankSize - 1;
+	unsigned kinds = 0;
+	unsigned i;
+
+	for (i = 0; i < gMaxWatch; i++)
+		if ((gWatch[i].first <= last) && (gWatch[i].last >= first))
+			kinds |= gWatch[i].kind;
+
+	return kinds;
+
+}
+
+/* MapBank() points gRdBank[] and gWrBank[] at a logical bank, or */
+/* at zero to take the trap path while it is watched. */
+static void MapBank(unsigned logical)
+{
+	unsigned kinds = gWatchArmed ? WatchKinds(logical) : 0;
+
+	gRdBank[logical] = (kinds & kWatchRead) ? 0 : gMemory.rdBank[logical];
+	gWrBank[logical] = (kinds & kWatchWrite) ? 0 : gMemory.wrBank[logical];
+
+}
+
+/* ArmWatch() arms or disarms the watchpoints. The monitor keeps */
+/* them disarmed while it runs, so its own accesses are not hits. */
+void ArmWatch(int arm)
+{
+	unsigned logical;
+
+	gWatchArmed = arm && (gMaxWatch > 0);
+
+	for (logical = 0; logical < kMaxBank; logical++)
+		MapBank(logical);
+	MapFlat();
+
+}
+
+/* WatchAccess() notes the first hit on a watchpoint, and breaks. */
+static void WatchAccess(Word address, Byte kind)
+{
+	unsigned i;
+
+	for (i = 0; i < gMaxWatch; i++)
+		if ((gWatch[i].kind & kind) &&
+		    (address >= gWatch[i].first) &&
+		    (address <= gWatch[i].last)) {
+			if (gWatchHitKind == 0) {
+				gWatchHitAddress = address;
+				gWatchHitKind = kind;
+				SetSystemFlags(kSystemBreak, 0);
+			}
+			break;
+		}
+
+}
+
+/* WatchRead() is the trap path of RdByte() in a watched bank. */
+/* Returns the bank to read from. */
+Byte *WatchRead(Word address)
+{
+
+	WatchAccess(address, kWatchRead);
+
+	return gMemory.rdBank[address >> 14];
+
+}
+
+/* WatchWrite() is the trap path of WrByte() in a watched bank. */
+/* Returns the bank to write to. */
+Byte *WatchWrite(Word address)
+{
+
+	WatchAccess(address, kWatchWrite);
+
+	return gMemory.wrBank[address >> 14];
+
+}
+
+#else
+
+/* MapBank() points gRdBank[] and gWrBank[] at a logical bank. */
+static void MapBank(unsigned logical)
+{
+
+	gRdBank[logical] = gMemory.rdBank[logical];
+	gWrBank[logical] = gMemory.wrBank[logical];
+
+}
+
+#endif
+
+#ifdef REVERSE
+
+/**********************************************************************/
+#pragma mark *** UNDO ***
+
+MACHINE UndoPtr gUndo;
+MACHINE unsigned long gUndoMask;
+MACHINE unsigned long long gUndoCount;
+
+static MACHINE UndoPtr gUndoLog;
+
+/* OpenUndo() allocates an undo log of at least size entries, or */
+/* frees it if size is zero. Returns zero if there was an error. */
+int OpenUndo(unsigned long size)
+{
+	unsigned long entries = 1;
+
+	gUndo = 0;
+	free(gUndoLog);
+	gUndoLog = 0;
+	gUndoMask = 0;
+	gUndoCount = 0;
+
+	if (size == 0)
+		return 1;
+
+	while (entries < size)
+		entries <<= 1;
+	if ((gUndoLog = malloc(entries * sizeof(Undo))) == 0)
+		return 0;
+	gUndoMask = entries - 1;
+
+	return 1;
+
+}
+
+/* ArmUndo() arms or disarms the undo log. The monitor keeps it */
+/* disarmed while it runs, so its own writes are not undone. */
+void ArmUndo(int arm)
+{
+
+	gUndo = arm ? gUndoLog : 0;
+
+}
+
+/* UndoWrites() undoes the writes logged since count, the latest */
+/* first. Returns zero if some of them are no longer in the log. */
+int UndoWrites(unsigned long long count)
+{
+	UndoPtr undo;
+
+	if ((count > gUndoCount) || (gUndoCount - count > gUndoMask + 1))
+		return 0;
+	if (count == gUndoCount)
+		return 1;
+
+	while (gUndoCount > count) {
+		undo = &gUndoLog[--gUndoCount & gUndoMask];
+		*undo->where = undo->value;
+	}
+
+#ifdef BLOCK_CACHE
+	/* The bytes were written behind the code map's back. */
+	FlushCodePages();
+#endif
+
+#ifdef DIRTY_PAGES
+	DirtyAll();
+#endif
+
+	return 1;
+
+}
+
+#endif
+
+/**********************************************************************/
+#pragma mark *** PHYSICAL MEMORY ***
 
 /* RomSize() returns the size of the physical ROM. */
 unsigned long RomSize(void)
@@ -70,6 +433,15 @@ void WrRom(Word address, Byte value)
 	if (address < gMemory.maxRom)
 		gMemory.rom[address] = value;
 
+#ifdef DIRTY_PAGES
+	if (address < gMemory.maxRom)
+		gMemory.dirty[address / kDirtyPageSize] = gDirtyEpoch;
+#endif
+
+#ifdef BLOCK_CACHE
+	FlushCodePages();
+#endif
+
 }
 
 /* ZeroRom() zeros the physical ROM. */
@@ -78,6 +450,14 @@ void ZeroRom(void)
 
 	MemoryZero(gMemory.rom, gMemory.maxRom);
 
+#ifdef DIRTY_PAGES
+	DirtyAll();
+#endif
+
+#ifdef BLOCK_CACHE
+	FlushCodePages();
+#endif
+
 }
 
 /* RamSize() returns the size of the physical RAM. */
@@ -103,6 +483,16 @@ void WrRam(Word address, Byte value)
 	if (address < gMemory.maxRam)
 		gMemory.ram[address] = value;
 
+#ifdef DIRTY_PAGES
+	if (address < gMemory.maxRam)
+		DirtyBank(gMemory.minRamBank)[address / kDirtyPageSize] =
+			gDirtyEpoch;
+#endif
+
+#ifdef BLOCK_CACHE
+	FlushCodePages();
+#endif
+
 }
 
 /* ZeroRam() zeros the physical RAM. */
@@ -111,6 +501,14 @@ void ZeroRam(void)
 
 	MemoryZero(gMemory.ram, gMemory.maxRam);
 
+#ifdef DIRTY_PAGES
+	DirtyAll();
+#endif
+
+#ifdef BLOCK_CACHE
+	FlushCodePages();
+#endif
+
 }
 
 /* MinRomBank() returns the minimum ROM bank index. */
@@ -188,24 +586,40 @@ unsigned WrBank(unsigned logical, unsigned physical)
 
 	/* Set the physical bank index. */
 	gMemory.index[logical] = physical;
+	gSystemStats.banks++;
+
+#ifdef BLOCK_CACHE
+	/* Cached code may now be mapped differently. */
+	FlushCodePages();
+#endif
 
 	/* If the physical bank is ROM... */
 	if (physical < gMemory.minRamBank) {
 		/* then set the read bank to ROM... */
-		gRdBank[logical] =
+		gMemory.rdBank[logical] =
 			&gMemory.rom[(physical - gMemory.minRomBank) * kBankSize];
 		/* and set the write bank to the bit bucket. */
-		gWrBank[logical] = gMemory.bitBucket;
+		gMemory.wrBank[logical] = gMemory.bitBucket;
+#ifdef DIRTY_PAGES
+		gWrDirty[logical] = DirtyBank(gMemory.maxRamBank);
+#endif
 	}
 	/* If the physical bank is RAM... */
 	else {
 		/* then set the read bank to RAM... */
-		gRdBank[logical] = 
+		gMemory.rdBank[logical] =
 			&gMemory.ram[(physical - gMemory.minRamBank) * kBankSize];
 		/* and set the write bank to RAM. */
-		gWrBank[logical] = gRdBank[logical];
+		gMemory.wrBank[logical] = gMemory.rdBank[logical];
+#ifdef DIRTY_PAGES
+		gWrDirty[logical] = DirtyBank(physical);
+#endif
 	}
 
+	/* Map the logical bank, watched or not, and see if all are flat. */
+	MapBank(logical);
+	MapFlat();
+
 	/* All done, no error, return the physical bank index. */
 	return physical;
 
@@ -227,6 +641,33 @@ static inline void WrByte(Word address, Byte value);
 /* RwByte() returns a pointer to read and write a byte of memory. */
 static inline Byte *RwByte(Word address);
 
+#pragma mark RdFetch
+/* RdFetch() reads an instruction for the decoder. */
+static inline unsigned long RdFetch(Word address, const Byte *lengths);
+
+/* RdFetchBytes() reads an instruction while the memory is not flat, */
+/* see RdBankFetch(). */
+unsigned long RdFetchBytes(Word address, const Byte *lengths)
+{
+	Byte *bank = gRdBank[address >> 14];
+	Word offset = (Word)(address & 0x3FFF);
+	unsigned long fetch;
+	unsigned i;
+
+#ifdef WATCHPOINTS
+	if (bank != 0)
+#endif
+		if (offset <= kBankSize - 4)
+			return FetchBytes(&bank[offset]);
+
+	fetch = RdByte(address);
+	for (i = 1; i < lengths[fetch]; i++)
+		fetch |= (unsigned long)RdByte((Word)(address + i)) << (8 * i);
+
+	return fetch;
+
+}
+
 /* RdBytes() reads many bytes of memory. */
 void RdBytes(Byte *destination, Word sourceAddress, Word size)
 {
@@ -276,6 +717,10 @@ int MemoryReset(void)
 	/* Zero the RAM. */
 	MemoryZero(gMemory.ram, gMemory.maxRam);
 
+#ifdef DIRTY_PAGES
+	DirtyAll();
+#endif
+
 	/* Map in the ROM. */
 	for (n = 0; n < kMaxBank; n++)
 		WrBank(n, 0);
@@ -308,6 +753,13 @@ void MemoryClose(void)
 	gMemory.maxRamBank = 0;
 	gMemory.ram = 0;
 
+#ifdef DIRTY_PAGES
+	/* Deallocate the page stamps. */
+	if (gMemory.dirty != 0)
+		free(gMemory.dirty);
+	gMemory.dirty = 0;
+#endif
+
 }
 
 /* MemoryOpen() prepares the memory system for normal operation. */
@@ -352,6 +804,18 @@ int
 		goto error;
 	gMemory.bitBucket = bitBucket;
 
+#ifdef DIRTY_PAGES
+	/* Allocate the page stamps, and a bank more for the bit bucket. */
+	if (gMemory.dirty != 0)
+		free(gMemory.dirty);
+	gMemory.dirty =
+		malloc((gMemory.maxRamBank + 1) * kBankDirtyPages *
+		       sizeof(unsigned long));
+	if (gMemory.dirty == 0)
+		goto error;
+	gDirtyEpoch = 1;
+#endif
+
 	/* Reset the memory system. */
 	if (!MemoryReset())
 		goto error;
@@ -366,6 +830,40 @@ error:
 
 }
 
+/* MemorySnapshot() saves or loads the ROM, the RAM, the MAP and */
+/* the DMA address. The memory sizes must match. */
+void MemorySnapshot(SnapshotPtr s)
+{
+	unsigned long maxRom = gMemory.maxRom;
+	unsigned long maxRam = gMemory.maxRam;
+	unsigned index[kMaxBank];
+	unsigned n;
+
+	SnapshotValue(s, maxRom);
+	SnapshotValue(s, maxRam);
+	if ((maxRom != gMemory.maxRom) || (maxRam != gMemory.maxRam))
+		s->isError = 1;
+
+	SnapshotBytes(s, gMemory.rom, gMemory.maxRom);
+	SnapshotBytes(s, gMemory.ram, gMemory.maxRam);
+
+	memcpy(index, gMemory.index, sizeof(index));
+	SnapshotValue(s, index);
+	SnapshotValue(s, gDMA);
+
+	/* Map the banks, this also flushes any cached code. */
+	if (s->isLoad && !s->isError)
+		for (n = 0; n < kMaxBank; n++)
+			WrBank(n, index[n]);
+
+#ifdef DIRTY_PAGES
+	/* Every page may have changed. */
+	if (s->isLoad)
+		DirtyAll();
+#endif
+
+}
+
 /* ShowPhysicalMemoryMap() displays the physical memory map. */
 void ShowPhysicalMemoryMap(Byte physicalBank)
 {
@@ -421,4 +919,4 @@ void ShowLogicalMemoryMap(Byte logicalBank)
 /**********************************************************************/
 #pragma mark *** DMA ***
 
-WordBytes gDMA;
+MACHINE WordBytes gDMA;
@@ -1 +1 @@
-/* uSim memory.h * Copyright (C) 2000, Tsurishaddai Williamson, tsuri@earthlink.net *  * This program is free software; you can redistribute it and/or * modify it under the terms of the GNU General Public License * as published by the Free Software Foundation; either version 2 * of the License, or (at your option) any later version. *  * This program is distributed in the hope that it will be useful, * but WITHOUT ANY WARRANTY; without even the implied warranty of * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the * GNU General Public License for more details. *  * You should have received a copy of the GNU General Public License * along with this program; if not, write to the Free Software * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA. *//**********************************************************************/typedef unsigned char Byte;typedef unsigned short Word;typedef union {	struct {#ifdef BIG_ENDIAN		Byte high, low;#else		Byte low, high;#endif	} byte;	Word word;} WordBytes;#define	kMaxBank 4#define	kBankSize 16384extern Byte *gRdBank[kMaxBank];extern Byte *gWrBank[kMaxBank];extern unsigned long RomSize(void);extern Byte RdRom(Word address);extern void WrRom(Word address, Byte value);extern void ZeroRom(void);extern unsigned long RamSize(void);extern Byte RdRam(Word address);extern void WrRam(Word address, Byte value);extern void ZeroRam(void);extern unsigned MinRomBank(void);extern unsigned MaxRomBank(void);extern unsigned MinRamBank(void);extern unsigned MaxRamBank(void);extern unsigned RdBank(unsigned logical);extern unsigned WrBank(unsigned logical, unsigned physical);static inline Byte RdByte(Word address){	Word index = (Word)(address >> 14);	Word offset = (Word)(address & 0x3FFF);	return gRdBank[index][offset];}static inline void WrByte(Word address, Byte value){	Word index = (Word)(address >> 14);	Word offset = (Word)(address & 0x3FFF);	gWrBank[index][offset] = value;}static inline Byte *RwByte(Word address){	Word index = (Word)(address >> 14);	Word offset = (Word)(address & 0x3FFF);	Byte *valuePtr;	valuePtr = &gWrBank[index][offset];	*valuePtr = gRdBank[index][offset];	return valuePtr;}extern void	RdBytes(Byte *destination, Word sourceAddress, Word size);extern void	WrBytes(Word destinationAddress, Byte *source, Word size);extern void MemoryZero(void *memory, unsigned long size);extern int MemoryReset(void);extern void MemoryClose(void);extern int	MemoryOpen(Byte *rom,	           unsigned long maxRom,	           Byte *ram,	           unsigned long maxRam,	           Byte *bitBucket);extern void ShowPhysicalMemoryMap(Byte physicalBank);extern void ShowLogicalMemoryMap(Byte logicalBank);extern WordBytes gDMA;
\ No newline at end of file
+/* uSim memory.h * Copyright (C) 2000, Tsurishaddai Williamson, tsuri@earthlink.net *  * This program is free software; you can redistribute it and/or * modify it under the terms of the GNU General Public License * as published by the Free Software Foundation; either version 2 * of the License, or (at your option) any later version. *  * This program is distributed in the hope that it will be useful, * but WITHOUT ANY WARRANTY; without even the implied warranty of * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the * GNU General Public License for more details. *  * You should have received a copy of the GNU General Public License * along with this program; if not, write to the Free Software * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA. *//**********************************************************************//* With MACHINES defined, the state of the simulated machine is kept * per host thread: every global that belongs to the machine (CPU, * memory, ports, disks, character devices, clock and monitor) is * declared MACHINE, so each thread that opens the memory, sets up the * ports and runs Cpu() runs its own machine. Each has a console of * its own too, but only one thread at a time may open the terminal, * the others use batch consoles (see console.c). The JIT keeps one * code buffer for the whole process, so it cannot be used with * MACHINES. */#ifdef MACHINES#define MACHINE __thread#else#define MACHINE#endiftypedef unsigned char Byte;typedef unsigned short Word;typedef union {	struct {#if defined(BIG_ENDIAN) && (!defined(BYTE_ORDER) || BYTE_ORDER == BIG_ENDIAN)		Byte high, low;#else		Byte low, high;#endif	} byte;	Word word;} WordBytes;#define	kMaxBank 4#define	kBankSize 16384extern MACHINE Byte *gRdBank[kMaxBank];extern MACHINE Byte *gWrBank[kMaxBank];/* gFlat is the host address of logical address 0000 while the four * logical banks map 64K of contiguous, writable, unwatched RAM (as * they do once CP/M is up), so that an access is a single index; it * is zero otherwise, and WrBank() and ArmWatch() keep it up to date. */extern MACHINE Byte *gFlat;extern unsigned long RomSize(void);extern Byte RdRom(Word address);extern void WrRom(Word address, Byte value);extern void ZeroRom(void);extern unsigned long RamSize(void);extern Byte RdRam(Word address);extern void WrRam(Word address, Byte value);extern void ZeroRam(void);extern unsigned MinRomBank(void);extern unsigned MaxRomBank(void);extern unsigned MinRamBank(void);extern unsigned MaxRamBank(void);extern unsigned RdBank(unsigned logical);extern unsigned WrBank(unsigned logical, unsigned physical);/* The JIT (see cpu.c) is built on the block cache. */#if defined(JIT) && !defined(BLOCK_CACHE)#define BLOCK_CACHE#endif#ifdef BLOCK_CACHE/* cpu.c caches translated code. gCodeMap[] is non-zero for every * logical address holding a byte of cached code, and gCodePage[] is * non-zero for each 256 byte code page that has any. Writing a byte * of cached code marks its code page stale, so that cpu.c invalidates * the blocks of that page before executing them again. */#define kCodePageSize 256#define kMaxCodePage 256extern MACHINE Byte gCodeMap[65536];extern MACHINE Byte gCodePage[kMaxCodePage];extern MACHINE Byte gCodeStale[kMaxCodePage];extern MACHINE Byte gCodeChanged;extern void MarkCode(Word address, Word size);extern void CodeWritten(Word address);extern void CodeWrittenBytes(Word address, Word size);extern void FlushCodePages(void);#endif#ifdef DIRTY_PAGES/* memory.c stamps each 256 byte page of physical memory with the * epoch in which it was last written. gWrDirty[] points at the stamps * of the pages each logical bank writes to, as gWrBank[] points at * their bytes, so a write costs one more store. NewDirtyEpoch() starts * a new epoch, and PagesWritten() finds the pages written since any * earlier one, so that only those pages need to be looked at. */#define kDirtyPageSize 256#define kBankDirtyPages (kBankSize / kDirtyPageSize)extern MACHINE unsigned long *gWrDirty[kMaxBank];extern MACHINE unsigned long gDirtyEpoch;extern unsigned long NewDirtyEpoch(void);extern unsigned MaxDirtyPage(void);extern unsigned PagesWritten(unsigned long epoch, Byte *bitmap);#endif#ifdef WATCHPOINTS/* With WATCHPOINTS defined, the monitor watches reads and writes of * address ranges. While the watchpoints are armed, gRdBank[] or * gWrBank[] is zero for each logical bank that holds a watched range, * so that RdByte(), WrByte() and RwByte() take the trap path, * WatchRead() or WatchWrite(), in those banks alone. While they are * armed the memory is never flat, so every access costs a test, and * the traps are cold, so that GNU C keeps their calls out of the way * of the accesses that do not take them. A hit sets kSystemBreak, so * that the monitor sees gWatchHitKind once the instruction (or, with * BLOCK_CACHE, the block) is done. */#define kMaxWatch 8enum {	kWatchRead  = 0x01,	kWatchWrite = 0x02};typedef struct Watch Watch;typedef Watch *WatchPtr;struct Watch {	Word first;	Word last;	Byte kind;};extern MACHINE Watch gWatch[kMaxWatch];extern MACHINE unsigned gMaxWatch;extern MACHINE Word gWatchHitAddress;extern MACHINE Byte gWatchHitKind;extern MACHINE int gWatchArmed;extern void ArmWatch(int arm);#ifdef __GNUC__#define WATCH_COLD __attribute__((cold))#else#define WATCH_COLD#endifextern Byte *WatchRead(Word address) WATCH_COLD;extern Byte *WatchWrite(Word address) WATCH_COLD;#endif#ifdef REVERSE/* With REVERSE defined, memory.c can log the old value of every byte * written, so that cpu.c can rewind memory along with the CPU. While * the log is armed, gUndo is non-zero, and WrByte() and RwByte() add * the host address and old value of each byte to its ring of * gUndoMask + 1 entries; gUndoCount counts every entry ever added. * WrSpan() returns zero then, so block moves write a byte at a time. * Host addresses stay right while the banks are switched. */typedef struct Undo Undo;typedef Undo *UndoPtr;struct Undo {	Byte *where;	Byte value;};extern MACHINE UndoPtr gUndo;extern MACHINE unsigned long gUndoMask;extern MACHINE unsigned long long gUndoCount;extern int OpenUndo(unsigned long size);extern void ArmUndo(int arm);extern int UndoWrites(unsigned long long count);static inline void LogUndo(Byte *where){	UndoPtr undo = &gUndo[gUndoCount++ & gUndoMask];	undo->where = where;	undo->value = *where;}#endif/* RdBankByte(), WrBankByte() and RwBankByte() access memory through * a copy of gFlat, gRdBank[] and gWrBank[], which the interpreter may * keep (see CACHED_REGISTERS in cpu.c); RdByte(), WrByte() and * RwByte() use the globals themselves. */static inline Byte RdBankByte(Byte *flat, Byte *const *rdBanks, Word address){	Word index = (Word)(address >> 14);	Word offset = (Word)(address & 0x3FFF);	Byte *bank;	if (flat != 0)		return flat[address];	bank = rdBanks[index];#ifdef WATCHPOINTS	if (bank == 0)		bank = WatchRead(address);#endif	return bank[offset];}static inline void WrBankByte(Byte *flat,                              Byte *const *wrBanks,                              Word address,                              Byte value){	Word index = (Word)(address >> 14);	Word offset = (Word)(address & 0x3FFF);	Byte *valuePtr;	Byte *bank;	if (flat != 0)		valuePtr = &flat[address];	else {		bank = wrBanks[index];#ifdef WATCHPOINTS		if (bank == 0)			bank = WatchWrite(address);#endif		valuePtr = &bank[offset];	}#ifdef REVERSE	if (gUndo != 0)		LogUndo(valuePtr);#endif	*valuePtr = value;#ifdef DIRTY_PAGES	gWrDirty[index][offset / kDirtyPageSize] = gDirtyEpoch;#endif#ifdef BLOCK_CACHE	if (gCodeMap[address])		CodeWritten(address);#endif}static inline Byte *RwBankByte(Byte *flat,                               Byte *const *rdBanks,                               Byte *const *wrBanks,                               Word address){	Word index = (Word)(address >> 14);	Word offset = (Word)(address & 0x3FFF);	Byte *rdBank;	Byte *wrBank;	Byte *readPtr;	Byte *valuePtr;	if (flat != 0)		readPtr = valuePtr = &flat[address];	else {		rdBank = rdBanks[index];		wrBank = wrBanks[index];#ifdef WATCHPOINTS		if (rdBank == 0)			rdBank = WatchRead(address);		if (wrBank == 0)			wrBank = WatchWrite(address);#endif		readPtr = &rdBank[offset];		valuePtr = &wrBank[offset];	}#ifdef REVERSE	if (gUndo != 0)		LogUndo(valuePtr);#endif	*valuePtr = *readPtr;#ifdef DIRTY_PAGES	gWrDirty[index][offset / kDirtyPageSize] = gDirtyEpoch;#endif#ifdef BLOCK_CACHE	if (gCodeMap[address])		CodeWritten(address);#endif	return valuePtr;}/* RdBankFetch() reads an instruction for the decoder in cpu.c, its * first byte in the low byte of the result and each of the next three * above the one before. While the memory is flat, that is a single * load, whatever the length of the instruction. Otherwise it calls * RdFetchBytes(), which reads the four bytes at once too where they * are in one bank that can be read directly, and else reads as many * bytes as lengths[] gives by the first one (the rest are zero), so * that a watched bank sees the bytes of the instruction alone. The * decoder has a copy at every instruction, so it is kept small, and * GNU C is told to inline it even in a function as big as the * threaded interpreter. */#ifdef __GNUC__#define FETCH_INLINE inline __attribute__((always_inline))#else#define FETCH_INLINE inline#endifextern unsigned long RdFetchBytes(Word address, const Byte *lengths);static FETCH_INLINE unsigned long FetchBytes(const Byte *bytes){	return (unsigned long)bytes[0] |	       ((unsigned long)bytes[1] << 8) |	       ((unsigned long)bytes[2] << 16) |	       ((unsigned long)bytes[3] << 24);}static FETCH_INLINE unsigned long RdBankFetch(Byte *flat,                                              Word address,                                              const Byte *lengths){	if ((flat == 0) || (address > 0xFFFC))		return RdFetchBytes(address, lengths);	return FetchBytes(&flat[address]);}static inline Byte RdByte(Word address){	return RdBankByte(gFlat, gRdBank, address);}static inline unsigned long RdFetch(Word address, const Byte *lengths){	return RdBankFetch(gFlat, address, lengths);}static inline void WrByte(Word address, Byte value){	WrBankByte(gFlat, gWrBank, address, value);}static inline Byte *RwByte(Word address){	return RwBankByte(gFlat, gRdBank, gWrBank, address);}/* RdSpan() and WrSpan() return the host address of a byte, for * moving or searching many bytes at once. The bytes of the same bank * are contiguous: BankTail() counts them from address to the end of * the bank, BankHead() from the start of the bank to address. Bytes * written through WrSpan() must be passed on to WrittenSpan(). With * WATCHPOINTS, a watched bank has no spans, they return zero for it; * with REVERSE, WrSpan() returns zero while the undo log is armed. */static inline Byte *RdSpan(Word address){	Byte *bank = gRdBank[address >> 14];#ifdef WATCHPOINTS	if (bank == 0)		return 0;#endif	return &bank[address & 0x3FFF];}static inline Byte *WrSpan(Word address){	Byte *bank = gWrBank[address >> 14];#ifdef WATCHPOINTS	if (bank == 0)		return 0;#endif#ifdef REVERSE	if (gUndo != 0)		return 0;#endif	return &bank[address & 0x3FFF];}static inline Word BankTail(Word address){	return (Word)(kBankSize - (address & 0x3FFF));}static inline Word BankHead(Word address){	return (Word)((address & 0x3FFF) + 1);}static inline void WrittenSpan(Word address, Word size){#ifdef DIRTY_PAGES	unsigned long *dirty = gWrDirty[address >> 14];	unsigned first = (address & 0x3FFF) / kDirtyPageSize;	unsigned last = ((address & 0x3FFF) + size - 1) / kDirtyPageSize;#endif#ifdef BLOCK_CACHE	Word page;	Word end;#endif#ifdef DIRTY_PAGES	/* The bytes are all in one bank. */	if (size > 0)		while (first <= last)			dirty[first++] = gDirtyEpoch;#endif#ifdef BLOCK_CACHE	/* Only code pages holding cached code need to be looked at. */	while (size > 0) {		page = address / kCodePageSize;		end = (Word)(kCodePageSize - (address % kCodePageSize));		if (end > size)			end = size;		if (gCodePage[page])			CodeWrittenBytes(address, end);		address += end;		size -= end;	}#else#pragma unused(address, size)#endif}extern void	RdBytes(Byte *destination, Word sourceAddress, Word size);extern void	WrBytes(Word destinationAddress, Byte *source, Word size);extern void MemoryZero(void *memory, unsigned long size);extern int MemoryReset(void);extern void MemoryClose(void);extern int	MemoryOpen(Byte *rom,	           unsigned long maxRom,	           Byte *ram,	           unsigned long maxRam,	           Byte *bitBucket);extern void ShowPhysicalMemoryMap(Byte physicalBank);extern void ShowLogicalMemoryMap(Byte logicalBank);extern MACHINE WordBytes gDMA;
\ No newline at end of file
@@ -54,6 +54,8 @@
 #include "file.h"
 #include <ctype.h>
 #include <stdarg.h>
+#include <time.h>
+#include <stdlib.h>
 
 #include "memory.h"
 #include "system.h"
@@ -65,6 +67,9 @@
 #include "bdev.h"
 #include "cdev.h"
 #include "clock.h"
+#include "snapshot.h"
+#include "trace.h"
+#include "profile.h"
 
 /**********************************************************************/
 #pragma mark *** SYSTEM ROM ***
@@ -81,7 +86,7 @@ static const Byte gRomCode[] = {
 /**********************************************************************/
 #pragma mark *** SYSTEM MESSAGE ***
 
-int gMonitorActive;
+MACHINE int gMonitorActive;
 
 /* SystemMessage() displays system messages. */
 int SystemMessage(const char *format, ...)
@@ -112,30 +117,48 @@ int SystemMessage(const char *format, ...)
 /**********************************************************************/
 #pragma mark *** MONITOR STATE ***
 
-static CpuStatePtr gCpuStatePtr;
+static MACHINE CpuStatePtr gCpuStatePtr;
 
-static int gPageCount;
+static MACHINE int gPageCount;
 
-static Word gAddress;
+static MACHINE Word gAddress;
 
-static unsigned gTraceCount;
-static unsigned gTraceDisplay;
+static MACHINE unsigned long gTraceCount;
+static MACHINE unsigned gTraceDisplay;
+/* gHistory[] is a ring, gHistoryNext is the slot for the next state. */
 #define kMaxHistory 8
-static unsigned gHistoryEnable;
-static CpuState gHistory[kMaxHistory];
-
-#define kMaxBreak 4
-static unsigned gMaxBreak;
-static Word gBreakAddress[kMaxBreak];
+static MACHINE unsigned gHistoryEnable;
+static MACHINE unsigned gHistoryNext;
+static MACHINE CpuState gHistory[kMaxHistory];
+/* gProfileEnable is set while PROFILE -E counts every instruction, */
+/* otherwise the profiler samples (see profile.h). */
+static MACHINE unsigned gProfileEnable;
+
+/* gBreakSet[] has a bit for each breakpoint set by BREAK. The CPU */
+/* breaks at these and at the temporary breakpoints, see CpuBreak(). */
+static MACHINE unsigned gMaxBreak;
+static MACHINE Byte gBreakSet[65536 / 8];
 
 #define kMaxTBreak 2
-static unsigned gMaxTBreak;
-static Word gTBreakAddress[kMaxTBreak];
+static MACHINE unsigned gMaxTBreak;
+static MACHINE Word gTBreakAddress[kMaxTBreak];
+
+/* STATS measures the speed from these. */
+static MACHINE unsigned long long gStatsCycles;
+static MACHINE clock_t gStatsClock;
+
+#ifdef DIRTY_PAGES
+/* PAGES shows the pages written since this epoch. */
+static MACHINE unsigned long gPagesEpoch;
+#endif
 
 static void MonitorHelp(char *command);
 
-static FILE *gTraceFile;
-static char gTraceFileName[256];
+/* The trace file is either text (gTraceFile) or binary */
+/* (gTraceBinary, see trace.h). */
+static MACHINE FILE *gTraceFile;
+static MACHINE TracePtr gTraceBinary;
+static MACHINE char gTraceFileName[256];
 
 /* CloseTraceFile() closes the trace file. */
 static void CloseTraceFile(void)
@@ -147,47 +170,48 @@ static void CloseTraceFile(void)
 		printf("CLOSED [%s]\n", gTraceFileName);
 	}
 
+	if (gTraceBinary != 0)  {
+		if (!TraceClose(gTraceBinary))
+			printf("?ERROR\n");
+		gTraceBinary = 0;
+		printf("CLOSED [%s]\n", gTraceFileName);
+	}
+
 }
 
-/* OpenTraceFile() opens the trace file. */
-static int OpenTraceFile(char *traceFileName)
+/* OpenTraceFile() opens the trace file. A binary trace is */
+/* delta compressed if delta is non-zero. */
+static int OpenTraceFile(char *traceFileName, int binary, int delta)
 {
+	FILE *file;
+	int append = 0;
 
 	CloseTraceFile();
 
 	strcpy(gTraceFileName, traceFileName);
 
 	if (gTraceFileName[0] == '+') {
-		strcpy(gTraceFileName, &gTraceFileName[1]);
-		gTraceFile = fopen(gTraceFileName, "a");
-		if (gTraceFile == 0) {
-			printf("?ERROR\n");
-			goto error;
-		}
-	}
-	else if (gTraceFileName[0] == '-') {
-		strcpy(gTraceFileName, &gTraceFileName[1]);
-		gTraceFile = fopen(gTraceFileName, "w");
-		if (gTraceFile == 0) {
-			printf("?ERROR\n");
-			goto error;
-		}
+		memmove(gTraceFileName, &gTraceFileName[1], strlen(gTraceFileName));
+		append = 1;
 	}
-	else if ((gTraceFile = fopen(gTraceFileName, "r")) != 0) {
-		fclose(gTraceFile);
-		gTraceFile = 0;
+	else if (gTraceFileName[0] == '-')
+		memmove(gTraceFileName, &gTraceFileName[1], strlen(gTraceFileName));
+	else if ((file = fopen(gTraceFileName, "r")) != 0) {
+		fclose(file);
 		printf("?EXISTS\n");
+		return 1;
 	}
-	else {
-		gTraceFile = fopen(gTraceFileName, "w");
-		if (gTraceFile == 0) {
-			printf("?ERROR\n");
-			goto error;
-		}
+
+	if (binary)
+		gTraceBinary = TraceOpen(gTraceFileName, append, delta);
+	else
+		gTraceFile = fopen(gTraceFileName, append ? "a" : "w");
+	if ((gTraceFile == 0) && (gTraceBinary == 0)) {
+		printf("?ERROR\n");
+		goto error;
 	}
 
-	if (gTraceFile != 0)
-		printf("OPENED [%s]\n", gTraceFileName);
+	printf("OPENED [%s]\n", gTraceFileName);
 
 	return 1;
 
@@ -196,7 +220,61 @@ error:
 
 }
 
-static FILE *gCommandFile;
+/* IsBreakSet() returns non-zero if BREAK set a breakpoint at address. */
+static int IsBreakSet(Word address)
+{
+
+	return gBreakSet[address >> 3] & (1 << (address & 7));
+
+}
+
+/* SetBreak() sets or removes the breakpoint at address. */
+static void SetBreak(Word address, int set)
+{
+	unsigned i;
+
+	if (!set == !IsBreakSet(address))
+		return;
+
+	gBreakSet[address >> 3] ^= 1 << (address & 7);
+	if (set)
+		gMaxBreak++;
+	else
+		gMaxBreak--;
+
+	/* A temporary breakpoint at the same address stays. */
+	for (i = 0; i < gMaxTBreak; i++)
+		if (gTBreakAddress[i] == address)
+			set = 1;
+
+	CpuBreak(address, set);
+
+}
+
+/* SetTBreaks() sets the temporary breakpoints, removing the old ones. */
+static void SetTBreaks(short *address, unsigned n)
+{
+	unsigned i;
+
+	for (i = 0; i < gMaxTBreak; i++)
+		CpuBreak(gTBreakAddress[i], IsBreakSet(gTBreakAddress[i]));
+
+	for (gMaxTBreak = 0; gMaxTBreak < n; gMaxTBreak++) {
+		gTBreakAddress[gMaxTBreak] = address[gMaxTBreak];
+		CpuBreak(gTBreakAddress[gMaxTBreak], 1);
+	}
+
+}
+
+/* HistoryState() returns the nth most recent history state. */
+static CpuStatePtr HistoryState(unsigned n)
+{
+
+	return &gHistory[(gHistoryNext + kMaxHistory - 1 - n) % kMaxHistory];
+
+}
+
+static MACHINE FILE *gCommandFile;
 
 /* CloseCommandFile() closes the command file. */
 static void CloseCommandFile(void)
@@ -467,6 +545,67 @@ error:
 
 }
 
+#ifdef REVERSE
+
+/* ShowBackstep() displays the CPU State after rewinding. */
+static void ShowBackstep(void)
+{
+	char buffer[256];
+
+	gAddress = gCpuStatePtr->pc.word;
+	DissasembleCpuState(buffer, gCpuStatePtr);
+	puts(buffer);
+
+}
+
+/* BACKSTEP() implements the BACKSTEP command. */
+static int BACKSTEP(int argc, char **argv)
+{
+	long count = 1;
+	int i;
+
+	/* Parse the command line switches. */
+	for (i = 1; (i < argc) && (*(argv[i]) == '-'); i++) {
+		char *token = argv[i];
+		switch (token[1]) {
+		default:
+			goto usage;
+		}
+	}
+	/* <COUNT> is optional. */
+	if (i < argc)
+		if (!StringToLong(argv[i++], &count) || (count <= 0))
+			goto usage;
+	/* No more arguments are allowed. */
+	if (i < argc)
+		goto usage;
+
+	if (CpuHistorySize() == 0) {
+		printf("?NOHISTORY\n");
+		goto error;
+	}
+	if (!CpuBackstep(count)) {
+		printf("?DEPTH %lu\n", CpuHistoryDepth());
+		goto error;
+	}
+	ShowBackstep();
+
+	/* All done, no error, return zero exit status. */
+	return 0;
+
+	/* Command syntax error. */
+usage:
+	MonitorHelp(argv[0]);
+	goto error;
+
+	/* Return non-zero exit status if there was an error. */
+error:
+	return 1;
+
+}
+
+#endif
+
 /* BOOT() implements the BOOT command. */
 static int BOOT(int argc, char **argv)
 {
@@ -522,20 +661,23 @@ static int BREAK(int argc, char **argv)
 	int removeBreak = 0;
 	Word address;
 	int n;
-	int i;
+	long i;
 
 	/* Display all breakpoints. */
 	if (argc == 1) {
 		if (gMaxBreak == 0)
 			printf("?NOBREAK\n");
-		else for (i = 0; i < gMaxBreak; i++)
-			printf("%04X\n", gBreakAddress[i] & 0xFFFF);
+		else for (i = 0; i < 65536; i++)
+			if (IsBreakSet(i))
+				printf("%04X\n", (unsigned)i);
 	}
 	/* Clear all breakpoints. */
 	else if ((argc == 2) && !strcmp(argv[1], ".")) {
-		for (i = 0; i < gMaxBreak; i++)
-			printf("-%04X\n", gBreakAddress[i] & 0xFFFF);
-		gMaxBreak = 0;
+		for (i = 0; (i < 65536) && (gMaxBreak > 0); i++)
+			if (IsBreakSet(i)) {
+				SetBreak(i, 0);
+				printf("-%04X\n", (unsigned)i);
+			}
 	}
 	/* Add or remove breakpoints. */
 	else {
@@ -560,40 +702,9 @@ static int BREAK(int argc, char **argv)
 				*addressStr++;
 			if (!StringToShort(addressStr, (short *)&address))
 				goto usage;
-			/* See if the address is already in the list... */
-			for (i = 0; i < gMaxBreak; i++)
-				if (gBreakAddress[i] == address)
-					break;
-			/* The address is not already in the list. */
-			if (i == gMaxBreak) {
-				if (removeBreak)
-					/* Remove: already not there. */
-					printf("-%04X\n", address & 0xFFFF);
-				else {
-					/* Add: add at the end of the list. */
-					if (gMaxBreak == kMaxBreak) {
-						printf("?NOSPACE\n");
-						goto error;
-					}
-					else {
-						gBreakAddress[gMaxBreak++] = address;
-						printf("+%04X\n", address & 0xFFFF);
-					}
-				}
-			}
-			/* The address is already in the list. */
-			else {
-				if (removeBreak) {
-					/* Remove: remove from the list. */
-					gMaxBreak--;
-					while (i++ < gMaxBreak)
-						gBreakAddress[i - 1] = gBreakAddress[i];
-					printf("-%04X\n", address & 0xFFFF);
-				}
-				else
-					/* Add: already in the list. */
-					printf("+%04X\n", address & 0xFFFF);
-			}
+			/* Set or remove, there is no limit. */
+			SetBreak(address, !removeBreak);
+			printf("%c%04X\n", removeBreak ? '-' : '+', address & 0xFFFF);
 		}
 	}
 
@@ -906,6 +1017,27 @@ error:
 
 }
 
+/* CyclesToString() formats a T-state count in decimal, since
+ * ConsolePrintf() has no long long conversion.
+ */
+static char *CyclesToString(char *buffer, unsigned long long cycles)
+{
+	char digits[24];
+	char *s = buffer;
+	int i = 0;
+
+	do
+		digits[i++] = (char)('0' + (cycles % 10));
+	while ((cycles /= 10) != 0);
+
+	while (i > 0)
+		*s++ = digits[--i];
+	*s = 0;
+
+	return buffer;
+
+}
+
 /* EXAMINE() implements the EXAMINE command. */
 static int EXAMINE(int argc, char **argv)
 {
@@ -928,16 +1060,17 @@ static int EXAMINE(int argc, char **argv)
 	/* Display the Cpu State if no register name is specified. */
 	if (name == 0) {
 		for (i = gHistoryEnable - 1; i > 0; i--) {
-			DissasembleCpuState(buffer, &gHistory[i - 1]);
+			DissasembleCpuState(buffer, HistoryState(i - 1));
 			puts(buffer);
 		}
 		DissasembleCpuState(buffer, gCpuStatePtr);
 		puts(buffer);
+		printf("T-STATES %s\n", CyclesToString(buffer, gCpuStatePtr->cycles));
 	}
 	/* Enable trace history if "+". */
 	else if (!strcmp(name, "+")) {
-		for (i = 0; i < kMaxHistory; i++)
-			MemoryZero(&gHistory[i], sizeof(CpuState));
+		MemoryZero(gHistory, sizeof(gHistory));
+		gHistoryNext = 0;
 		gHistoryEnable = 1;
 	}
 	/* Disable trace history if "-". */
@@ -1232,10 +1365,9 @@ static int GO(int argc, char **argv)
 		gCpuStatePtr->pc.word = address;
 
 	/* Set the temporary breakpoints if any were specified. */
-	for (gMaxTBreak = 0; gMaxTBreak < maxTBreak; gMaxTBreak++) {
-		printf("+%04X\n", tBreakAddress[gMaxTBreak] & 0xFFFF);
-		gTBreakAddress[gMaxTBreak] = tBreakAddress[gMaxTBreak];
-	}
+	for (i = 0; i < maxTBreak; i++)
+		printf("+%04X\n", tBreakAddress[i] & 0xFFFF);
+	SetTBreaks(tBreakAddress, maxTBreak);
 
 	printf("%04X\n", gCpuStatePtr->pc.word & 0xFFFF);
 
@@ -1294,6 +1426,63 @@ error:
 
 }
 
+#ifdef REVERSE
+
+/* HISTORY() implements the HISTORY command. */
+static int HISTORY(int argc, char **argv)
+{
+	char *sizeStr = 0;
+	long size = 0;
+	int i;
+
+	/* Parse the command line switches. */
+	for (i = 1; (i < argc) && (*(argv[i]) == '-'); i++) {
+		char *token = argv[i];
+		switch (token[1]) {
+		default:
+			goto usage;
+		}
+	}
+	/* <SIZE> is optional, "." is no history. */
+	if (i < argc) {
+		sizeStr = argv[i++];
+		if (strcmp(sizeStr, ".") &&
+		    (!StringToLong(sizeStr, &size) || (size <= 0)))
+			goto usage;
+	}
+	/* No more arguments are allowed. */
+	if (i < argc)
+		goto usage;
+
+	/* A new size starts the history over. */
+	if ((sizeStr != 0) && !CpuHistory(size)) {
+		printf("?MALLOC\n");
+		goto error;
+	}
+
+	if (CpuHistorySize() == 0)
+		printf("?NOHISTORY\n");
+	else
+		printf("SIZE %lu, DEPTH %lu\n",
+		       CpuHistorySize(),
+		       CpuHistoryDepth());
+
+	/* All done, no error, return zero exit status. */
+	return 0;
+
+	/* Command syntax error. */
+usage:
+	MonitorHelp(argv[0]);
+	goto error;
+
+	/* Return non-zero exit status if there was an error. */
+error:
+	return 1;
+
+}
+
+#endif
+
 /* IMPORT() implements the IMPORT command. */
 static int IMPORT(int argc, char **argv)
 {
@@ -2102,6 +2291,122 @@ error:
 
 }
 
+/* NMI() implements the NMI command. */
+static int NMI(int argc, char **argv)
+{
+	int i;
+
+	/* Parse the command line switches. */
+	for (i = 1; (i < argc) && (*(argv[i]) == '-'); i++) {
+		char *token = argv[i];
+		switch (token[1]) {
+		default:
+			goto usage;
+		}
+	}
+	/* No more arguments are allowed. */
+	if (i < argc)
+		goto usage;
+
+	/* The NMI is taken before the next instruction. */
+	CpuNMI();
+
+	/* All done, no error, return zero exit status. */
+	return 0;
+
+	/* Command syntax error. */
+usage:
+	MonitorHelp(argv[0]);
+	goto error;
+
+	/* Return non-zero exit status if there was an error. */
+error:
+	return 1;
+
+}
+
+#ifdef DIRTY_PAGES
+
+/* PAGES() implements the PAGES command. */
+static int PAGES(int argc, char **argv)
+{
+	unsigned long pageSize = kDirtyPageSize;
+	unsigned long romPages = MaxRomBank() * kBankDirtyPages;
+	unsigned maxPage = MaxDirtyPage();
+	Byte *bitmap = 0;
+	unsigned count;
+	unsigned first;
+	unsigned page;
+	int newEpoch = 0;
+	int i;
+
+	/* Parse the command line switches. */
+	for (i = 1; (i < argc) && (*(argv[i]) == '-'); i++) {
+		char *token = argv[i];
+		switch (token[1]) {
+		case 'N':
+			newEpoch = 1;
+			break;
+		default:
+			goto usage;
+		}
+	}
+	/* No more arguments are allowed. */
+	if (i < argc)
+		goto usage;
+
+	/* Start a new epoch if -N. */
+	if (newEpoch || (gPagesEpoch == 0)) {
+		gPagesEpoch = NewDirtyEpoch();
+		if (newEpoch)
+			goto done;
+	}
+
+	if ((bitmap = malloc((maxPage + 7) / 8)) == 0) {
+		printf("?MALLOC\n");
+		goto error;
+	}
+	count = PagesWritten(gPagesEpoch, bitmap);
+	printf("EPOCH %lu: %u PAGES WRITTEN\n", gPagesEpoch, count);
+
+	/* Show each run of written pages, in ROM or in RAM. */
+	for (page = 0; page < maxPage; page++) {
+		if (!(bitmap[page / 8] & (1 << (page % 8))))
+			continue;
+		first = page;
+		while ((page + 1 < maxPage) &&
+		       (page + 1 != romPages) &&
+		       (bitmap[(page + 1) / 8] & (1 << ((page + 1) % 8))))
+			page++;
+		if (first < romPages)
+			printf("ROM %08X - %08X\n",
+			       first * pageSize,
+			       (page + 1) * pageSize - 1);
+		else
+			printf("RAM %08X - %08X\n",
+			       (first - romPages) * pageSize,
+			       (page + 1 - romPages) * pageSize - 1);
+	}
+
+	free(bitmap);
+
+	/* All done, no error, return zero exit status. */
+done:
+	return 0;
+
+	/* Command syntax error. */
+usage:
+	MonitorHelp(argv[0]);
+	goto error;
+
+	/* Return non-zero exit status if there was an error. */
+error:
+	return 1;
+
+}
+
+#endif
+
 /* PRINT() implements the PRINT command. */
 static int PRINT(int argc, char **argv)
 {
@@ -2209,25 +2514,62 @@ error:
 
 }
 
-/* QUIT() implements the QUIT command. */
-static int QUIT(int argc, char **argv)
+/* PROFILE() implements the PROFILE command. */
+static int PROFILE(int argc, char **argv)
 {
+	char *what = 0;
+	long count = 16;
+	int exact = 0;
 	int i;
 
 	/* Parse the command line switches. */
-	for (i = 1; (i < argc) && (*(argv[i]) == '-'); i++) {
+	for (i = 1; (i < argc) && (*(argv[i]) == '-') && (argv[i][1] != 0); i++) {
 		char *token = argv[i];
 		switch (token[1]) {
+		case 'E':
+			exact = 1;
+			break;
 		default:
 			goto usage;
 		}
 	}
+	/* +, - or REPORT is optional. */
+	if (i < argc)
+		what = argv[i++];
+	/* <COUNT> is optional after REPORT. */
+	if ((what != 0) && !strcmp(what, "REPORT") && (i < argc))
+		if (!StringToLong(argv[i++], &count) || (count <= 0))
+			goto usage;
 	/* No more arguments are allowed. */
 	if (i < argc)
 		goto usage;
+	/* -E is only allowed with "+". */
+	if (exact && ((what == 0) || strcmp(what, "+")))
+		goto usage;
 
-	/* Set the kSystemHalt, clear all other flags. */
-	SetSystemFlags(kSystemHalt, ~kSystemHalt);
+	/* Show the samples or the instructions counted. */
+	if (what == 0)
+		printf("%lu %s%s\n",
+		       ProfileCount(),
+		       ProfileSampled() ? "SAMPLES" : "INSTRUCTIONS",
+		       (gProfileEnable || gProfilePeriod) ? ", PROFILING" : "");
+	/* Start a new profile if "+", counting every instruction if -E. */
+	else if (!strcmp(what, "+")) {
+		if (!ProfileOpen(exact ? 0 : kProfilePeriod)) {
+			printf("?MALLOC\n");
+			goto error;
+		}
+		gProfileEnable = exact;
+	}
+	/* Stop profiling if "-", the counts are kept for REPORT. */
+	else if (!strcmp(what, "-")) {
+		gProfileEnable = 0;
+		ProfileStop();
+	}
+	else if (!strcmp(what, "REPORT"))
+		ProfileReport((unsigned)count);
+	else
+		goto usage;
 
 	/* All done, no error, return zero exit status. */
 	return 0;
@@ -2243,8 +2585,8 @@ error:
 
 }
 
-/* RESET() implements the RESET command. */
-static int RESET(int argc, char **argv)
+/* QUIT() implements the QUIT command. */
+static int QUIT(int argc, char **argv)
 {
 	int i;
 
@@ -2260,11 +2602,97 @@ static int RESET(int argc, char **argv)
 	if (i < argc)
 		goto usage;
 
-	/* Clear the Cpu State. */
-	MemoryZero(gCpuStatePtr, sizeof(CpuState));
-	gAddress = 0;
+	/* Set the kSystemHalt, clear all other flags. */
+	SetSystemFlags(kSystemHalt, ~kSystemHalt);
 
-	/* Zero RAM, reset the MAP. */
+	/* All done, no error, return zero exit status. */
+	return 0;
+
+	/* Command syntax error. */
+usage:
+	MonitorHelp(argv[0]);
+	goto error;
+
+	/* Return non-zero exit status if there was an error. */
+error:
+	return 1;
+
+}
+
+#ifdef REVERSE
+
+/* REVERSEGO() implements the REVERSE-GO command. */
+static int REVERSEGO(int argc, char **argv)
+{
+	unsigned long depth;
+	unsigned long n;
+	int i;
+
+	/* Parse the command line switches. */
+	for (i = 1; (i < argc) && (*(argv[i]) == '-'); i++) {
+		char *token = argv[i];
+		switch (token[1]) {
+		default:
+			goto usage;
+		}
+	}
+	/* No more arguments are allowed. */
+	if (i < argc)
+		goto usage;
+
+	if ((depth = CpuHistoryDepth()) == 0) {
+		printf("?NOHISTORY\n");
+		goto error;
+	}
+
+	/* Rewind to the latest breakpoint, or as far as possible. */
+	for (n = 1; n < depth; n++)
+		if (IsBreak(CpuHistoryState(n)->pc.word))
+			break;
+	if (!CpuBackstep(n))
+		goto error;
+	if (IsBreak(gCpuStatePtr->pc.word))
+		printf("*%04X\n", gCpuStatePtr->pc.word & 0xFFFF);
+	ShowBackstep();
+
+	/* All done, no error, return zero exit status. */
+	return 0;
+
+	/* Command syntax error. */
+usage:
+	MonitorHelp(argv[0]);
+	goto error;
+
+	/* Return non-zero exit status if there was an error. */
+error:
+	return 1;
+
+}
+
+#endif
+
+/* RESET() implements the RESET command. */
+static int RESET(int argc, char **argv)
+{
+	int i;
+
+	/* Parse the command line switches. */
+	for (i = 1; (i < argc) && (*(argv[i]) == '-'); i++) {
+		char *token = argv[i];
+		switch (token[1]) {
+		default:
+			goto usage;
+		}
+	}
+	/* No more arguments are allowed. */
+	if (i < argc)
+		goto usage;
+
+	/* Clear the Cpu State. */
+	MemoryZero(gCpuStatePtr, sizeof(CpuState));
+	gAddress = 0;
+
+	/* Zero RAM, reset the MAP. */
 	MemoryReset();
 
 	/* Unmount all block devices. */
@@ -2282,6 +2710,9 @@ static int RESET(int argc, char **argv)
 	/* Reset the Clock. */
 	ResetClock(0);
 
+	/* Mask and clear all interrupts. */
+	ResetSystemInterrupts();
+
 	/* Clear the kSystemReset and kSystemHalt flags. */
 	SetSystemFlags(0, kSystemReset | kSystemHalt);
 
@@ -2385,6 +2816,152 @@ error:
 
 }
 
+/* SNAPSHOT() implements the SNAPSHOT command. */
+static int SNAPSHOT(int argc, char **argv)
+{
+	const char *operation = 0;
+	const char *file = 0;
+	int i;
+
+	/* Parse the command line switches. */
+	for (i = 1; (i < argc) && (*(argv[i]) == '-'); i++) {
+		char *token = argv[i];
+		switch (token[1]) {
+		default:
+			goto usage;
+		}
+	}
+	/* SAVE or LOAD, and the <FILE> are required. */
+	if (i >= argc)
+		goto usage;
+	operation = argv[i++];
+	if (i >= argc)
+		goto usage;
+	file = argv[i++];
+	/* No more arguments are allowed. */
+	if (i < argc)
+		goto usage;
+
+	/* Save the machine state. */
+	if (!strcmp(operation, "SAVE")) {
+		if (!SnapshotSave(file)) {
+			printf("?SAVE [%s]\n", file);
+			goto error;
+		}
+	}
+	/* Load the machine state. */
+	else if (!strcmp(operation, "LOAD")) {
+		if (!SnapshotLoad(file)) {
+			printf("?LOAD [%s]\n", file);
+			goto error;
+		}
+		gAddress = gCpuStatePtr->pc.word;
+	}
+	else
+		goto usage;
+
+	/* All done, no error, return zero exit status. */
+	return 0;
+
+	/* Command syntax error. */
+usage:
+	MonitorHelp(argv[0]);
+	goto error;
+
+	/* Return non-zero exit status if there was an error. */
+error:
+	return 1;
+
+}
+
+/* STATS() implements the STATS command. */
+static int STATS(int argc, char **argv)
+{
+	char buffer[24];
+	unsigned long long cycles;
+	unsigned long hundredths;
+	unsigned long mhz;
+	char *logFile = 0;
+	long seconds = 60;
+	int restart = 0;
+	int i;
+
+	/* Parse the command line switches. */
+	for (i = 1; (i < argc) && (*(argv[i]) == '-'); i++) {
+		char *token = argv[i];
+		switch (token[1]) {
+		case 'L':
+			if (logFile != 0)
+				goto usage;
+			if (strlen(token) > 2)
+				token = &token[2];
+			else if (++i >= argc)
+				goto usage;
+			else
+				token = argv[i];
+			logFile = token;
+			break;
+		case 'R':
+			restart = 1;
+			break;
+		default:
+			goto usage;
+		}
+	}
+	/* <SECONDS> is optional after -L <FILE>. */
+	if ((logFile != 0) && (i < argc))
+		if (!StringToLong(argv[i++], &seconds) || (seconds <= 0))
+			goto usage;
+	/* No more arguments are allowed. */
+	if (i < argc)
+		goto usage;
+
+	/* Start or stop the log if -L. */
+	if (logFile != 0) {
+		if (!LogSystemStats(strcmp(logFile, ".") ? logFile : 0, seconds)) {
+			printf("?ERROR\n");
+			goto error;
+		}
+		return 0;
+	}
+
+	/* Restart the measurement if the Cpu has been reset. */
+	if (gCpuStatePtr->cycles < gStatsCycles) {
+		gStatsCycles = gCpuStatePtr->cycles;
+		gStatsClock = clock();
+	}
+
+	/* Show the T-states, and the emulated MHz in process time. */
+	cycles = gCpuStatePtr->cycles - gStatsCycles;
+	hundredths = (unsigned long)(((clock() - gStatsClock) * 100) / CLOCKS_PER_SEC);
+	mhz = (hundredths != 0) ? (unsigned long)(cycles / (hundredths * 100)) : 0;
+	printf("T-STATES     %s\n", CyclesToString(buffer, cycles));
+	printf("MHZ          %lu.%02lu\n", mhz / 100, mhz % 100);
+
+	/* Show the host time, instructions and device activity. */
+	ShowSystemStats();
+
+	/* Restart the measurement after showing it if -R. */
+	if (restart) {
+		gStatsCycles = gCpuStatePtr->cycles;
+		gStatsClock = clock();
+		ResetSystemStats();
+	}
+
+	/* All done, no error, return zero exit status. */
+	return 0;
+
+	/* Command syntax error. */
+usage:
+	MonitorHelp(argv[0]);
+	goto error;
+
+	/* Return non-zero exit status if there was an error. */
+error:
+	return 1;
+
+}
+
 /* SYSID() implements the SYSID command. */
 static int SYSID(int argc, char **argv)
 {
@@ -2438,12 +3015,22 @@ static int TRACE(int argc, char **argv)
 	char *countStr = 0;
 	long count;
 	int disable = 0;
+	int binary = 0;
+	int delta = 0;
 	int i;
 
 	/* Parse the command line switches. */
 	for (i = 1; (i < argc) && (*(argv[i]) == '-'); i++) {
 		char *token = argv[i];
 		switch (token[1]) {
+		case 'D':
+			delta = 1;
+			/* fall through */
+		case 'B':
+			if (binary)
+				goto usage;
+			binary = 1;
+			break;
 		default:
 			goto usage;
 		}
@@ -2467,6 +3054,9 @@ static int TRACE(int argc, char **argv)
 	/* No more arguments are allowed. */
 	if (i < argc)
 		goto usage;
+	/* A binary trace needs a file. */
+	if (binary && (traceFileName == 0))
+		goto usage;
 
 	/* Disable? */
 	if (disable) {
@@ -2480,7 +3070,7 @@ static int TRACE(int argc, char **argv)
 		gTraceDisplay = 1;
 		/* Open Trace File? */
 		if (traceFileName != 0)
-			if (!OpenTraceFile(traceFileName))
+			if (!OpenTraceFile(traceFileName, binary, delta))
 				gTraceCount = 0;
 	}
 
@@ -2640,12 +3230,22 @@ static int UNTRACE(int argc, char **argv)
 	char *countStr = 0;
 	long count;
 	int disable = 0;
+	int binary = 0;
+	int delta = 0;
 	int i;
 
 	/* Parse the command line switches. */
 	for (i = 1; (i < argc) && (*(argv[i]) == '-'); i++) {
 		char *token = argv[i];
 		switch (token[1]) {
+		case 'D':
+			delta = 1;
+			/* fall through */
+		case 'B':
+			if (binary)
+				goto usage;
+			binary = 1;
+			break;
 		default:
 			goto usage;
 		}
@@ -2669,6 +3269,9 @@ static int UNTRACE(int argc, char **argv)
 	/* No more arguments are allowed. */
 	if (i < argc)
 		goto usage;
+	/* A binary trace needs a file. */
+	if (binary && (traceFileName == 0))
+		goto usage;
 
 	/* Disable? */
 	if (disable) {
@@ -2682,7 +3285,7 @@ static int UNTRACE(int argc, char **argv)
 		gTraceDisplay = 0;
 		/* Open Trace File? */
 		if (traceFileName != 0)
-			if (!OpenTraceFile(traceFileName))
+			if (!OpenTraceFile(traceFileName, binary, delta))
 				gTraceCount = 0;
 	}
 
@@ -2700,6 +3303,148 @@ error:
 
 }
 
+#ifdef WATCHPOINTS
+
+/* ParseWatch() parses [+|-]<FIRST>[-<LAST>] into a watchpoint. */
+/* Returns -1 to remove it, 1 to set it, or 0 if it is not valid. */
+static int ParseWatch(const char *rangeStr, WatchPtr watch)
+{
+	char buffer[32];
+	char *lastStr;
+	int result = 1;
+
+	if ((*rangeStr == '-') || (*rangeStr == '+')) {
+		if (*rangeStr == '-')
+			result = -1;
+		rangeStr++;
+	}
+	if (strlen(rangeStr) >= sizeof(buffer))
+		goto error;
+	strcpy(buffer, rangeStr);
+
+	/* <LAST> is optional. */
+	if ((lastStr = strchr(buffer, '-')) != 0)
+		*lastStr++ = 0;
+	if (!StringToShort(buffer, (short *)&watch->first))
+		goto error;
+	watch->last = watch->first;
+	if ((lastStr != 0) && !StringToShort(lastStr, (short *)&watch->last))
+		goto error;
+	if (watch->last < watch->first)
+		goto error;
+
+	/* All done, no error, return -1 or 1. */
+	return result;
+
+	/* Return zero if there was an error. */
+error:
+	return 0;
+
+}
+
+/* ShowWatch() displays a watchpoint. */
+static void ShowWatch(const char *prefix, WatchPtr watch)
+{
+	char kind = "?RWA"[watch->kind & (kWatchRead | kWatchWrite)];
+
+	if (watch->first == watch->last)
+		printf("%s%c %04X\n", prefix, kind, watch->first & 0xFFFF);
+	else
+		printf("%s%c %04X-%04X\n",
+		       prefix,
+		       kind,
+		       watch->first & 0xFFFF,
+		       watch->last & 0xFFFF);
+
+}
+
+/* WATCH() implements the WATCH command. */
+static int WATCH(int argc, char **argv)
+{
+	Watch watch;
+	Byte kind = kWatchRead | kWatchWrite;
+	int first = 2;
+	int n;
+	int i;
+
+	/* Display all watchpoints. */
+	if (argc == 1) {
+		if (gMaxWatch == 0)
+			printf("?NOWATCH\n");
+		else for (i = 0; i < gMaxWatch; i++)
+			ShowWatch("", &gWatch[i]);
+	}
+	/* Remove all watchpoints. */
+	else if ((argc == 2) && !strcmp(argv[1], ".")) {
+		for (i = 0; i < gMaxWatch; i++)
+			ShowWatch("-", &gWatch[i]);
+		gMaxWatch = 0;
+	}
+	/* Set or remove watchpoints. */
+	else {
+		/* R, W or A is optional, A is the default. */
+		if (!strcmp(argv[1], "R"))
+			kind = kWatchRead;
+		else if (!strcmp(argv[1], "W"))
+			kind = kWatchWrite;
+		else if (strcmp(argv[1], "A"))
+			first = 1;
+		if (first >= argc)
+			goto usage;
+		/* Verify all of the ranges. */
+		for (n = first; n < argc; n++)
+			if (!ParseWatch(argv[n], &watch))
+				goto usage;
+		/* Process the ranges. */
+		for (n = first; n < argc; n++) {
+			int result = ParseWatch(argv[n], &watch);
+			watch.kind = kind;
+			/* See if the range is already in the list... */
+			for (i = 0; i < gMaxWatch; i++)
+				if ((gWatch[i].first == watch.first) &&
+				    (gWatch[i].last == watch.last))
+					break;
+			/* Remove: remove from the list, if it is there. */
+			if (result < 0) {
+				if (i < gMaxWatch) {
+					watch = gWatch[i];
+					gMaxWatch--;
+					while (i++ < gMaxWatch)
+						gWatch[i - 1] = gWatch[i];
+				}
+				ShowWatch("-", &watch);
+			}
+			/* Set: add at the end of the list, or change the kind. */
+			else {
+				if (i == gMaxWatch) {
+					if (gMaxWatch == kMaxWatch) {
+						printf("?NOSPACE\n");
+						goto error;
+					}
+					gMaxWatch++;
+				}
+				gWatch[i] = watch;
+				ShowWatch("+", &watch);
+			}
+		}
+	}
+
+	/* All done, no error, return zero exit status. */
+	return 0;
+
+	/* Command syntax error. */
+usage:
+	MonitorHelp(argv[0]);
+	goto error;
+
+	/* Return non-zero exit status if there was an error. */
+error:
+	return 1;
+
+}
+
+#endif
+
 /**********************************************************************/
 #pragma mark *** MONITOR ***
 
@@ -2757,6 +3502,13 @@ struct {
   ";        PTP: <PHYSDEV> are TTY:, PTP:, UP1:, UP2:"
 },
 
+#ifdef REVERSE
+{ "BACKSTEP", BACKSTEP, "Rewind " CPU " execution.",
+  "BACKSTEP [<COUNT>]      ; rewinds <COUNT> instructions, default 1\n"
+  ";Note: Use HISTORY to keep the instructions to rewind."
+},
+#endif
+
 { "BOOT", BOOT, "Boot the " CPU " " kProgram ".",
   "BOOT        ; run monitor commands from the " kBOOTBAT " file"
 },
@@ -2867,6 +3619,15 @@ struct {
   "HELP <COMMAND>         ; displays information about <COMMAND>"
 },
 
+#ifdef REVERSE
+{ "HISTORY", HISTORY, "Keep an execution history.",
+  "HISTORY                 ; displays the history size and depth\n"
+  "HISTORY .               ; keeps no history\n"
+  "HISTORY <SIZE>          ; keeps the last <SIZE> instructions\n"
+  ";Note: BACKSTEP rewinds the CPU State and memory, not the devices."
+},
+#endif
+
 { "IMPORT", IMPORT, "Import programs and files.",
   "IMPORT <COMFILE> [ <CODEFILE> ] ; import a program\n"
   "IMPORT <TEXTFILE>               ; import a text file\n"
@@ -2928,11 +3689,35 @@ struct {
   ";Note: Use -R to access the ROM directly."
 },
 
+{ "NMI", NMI, "Signal a non-maskable interrupt.",
+  "NMI                    ; interrupts the Z80 at 0066H\n"
+  ";Note: The i8080 has no NMI, it is ignored."
+},
+
+#ifdef DIRTY_PAGES
+{ "PAGES", PAGES, "Show the memory pages written.",
+  "PAGES                  ; shows the pages written since the epoch\n"
+  "PAGES -N               ; starts a new epoch"
+},
+#endif
+
 { "PRINT", PRINT, "Evaluate an expression.",
   "PRINT <EXPRESSION>     ; prints the expression result\n"
   ";Note: This uses the assembler expression syntax."
 },
 
+{ "PROFILE", PROFILE, "Profile " CPU " execution.",
+  "PROFILE                  ; shows the samples or instructions counted\n"
+  "PROFILE +                ; starts a new profile, sampling\n"
+  "PROFILE -E +             ; starts a new profile, counting every instruction\n"
+  "PROFILE -                ; stops profiling\n"
+  "PROFILE REPORT [<COUNT>] ; reports the <COUNT> hottest ranges of code\n"
+  ";Note: A sampled profile costs next to nothing, -E runs the monitor\n"
+  ";      before every instruction, as TRACE does. The report names\n"
+  ";      addresses by the labels of the last program assembled from\n"
+  ";      source, and also counts opcodes and ports."
+},
+
 { "QUIT", QUIT, "Terminate the " CPU " " kProgram ".",
   "QUIT                   ; terminates the " CPU " " kProgram ""
 },
@@ -2946,6 +3731,13 @@ struct {
   ";           attaches TTY to CONSOLE"
 },
 
+#ifdef REVERSE
+{ "REVERSE-GO", REVERSEGO, "Rewind to the last breakpoint.",
+  "REVERSE-GO              ; rewinds to the last breakpoint passed\n"
+  ";Note: Without one, rewinds as far as the history goes."
+},
+#endif
+
 { "SET", SET, "Set memory values.",
   "SET [-R] <ADDRESS> [<HEXVALUE>] ; sets memory values\n"
   ";Note: Use -R to access the ROM directly.\n"
@@ -2953,6 +3745,23 @@ struct {
   ";      If <HEXVALUE> is three or more digits, a word is written."
 },
 
+{ "SNAPSHOT", SNAPSHOT, "Save or load the machine state.",
+  "SNAPSHOT SAVE <FILE>  ; saves the whole machine state to the <FILE>\n"
+  "SNAPSHOT LOAD <FILE>  ; loads the machine state from the <FILE>\n"
+  ";Note: Use GO to continue where the snapshot was saved.\n"
+  ";Note: Only the " kProgram " that saved a snapshot can load it.\n"
+  ";      A failed LOAD leaves the machine in an unknown state, RESET."
+},
+
+{ "STATS", STATS, "Display execution statistics.",
+  "STATS [-R]                 ; shows T-states, MHz, host time and devices\n"
+  "STATS -L <FILE> [<SECONDS>] ; also appends them to <FILE> every <SECONDS>\n"
+  "STATS -L .                  ; stops appending them\n"
+  ";Note: Use -R to restart the measurement after showing it.\n"
+  ";      The host time is split between the CPU, the monitor, the\n"
+  ";      device handlers and idling; the default <SECONDS> is 60."
+},
+
 { "SYSID", SYSID, "Access the system ID device.",
   "SYSID [ <NEW VALUE> ]  ; shows or sets the System ID"
 },
@@ -2960,7 +3769,10 @@ struct {
 { "TRACE", TRACE, "Trace instruction execution.",
   "TRACE [<COUNT>]                 ; trace instructions\n"
   "TRACE .                         ; disables tracing\n"
-  "TRACE [<COUNT>] [<OUTPUT FILE>] ; write trace output to a file"
+  "TRACE [<COUNT>] [<OUTPUT FILE>] ; write trace output to a file\n"
+  "TRACE -B|-D [<COUNT>] <FILE>    ; write a binary trace to a file\n"
+  ";Note: Use uSimTrace to decode a binary trace.\n"
+  ";      Use -D to delta compress the binary trace."
 },
 
 { "UNMOUNT", UNMOUNT, "Unmount a disk.",
@@ -2977,9 +3789,23 @@ struct {
 { "UNTRACE", UNTRACE, "Untrace instruction execution.",
   "UNTRACE [<COUNT>]                 ; untrace instructions\n"
   "UNTRACE .                         ; disables tracing\n"
-  "UNTRACE [<COUNT>] [<OUTPUT FILE>] ; write trace output to a file"
+  "UNTRACE [<COUNT>] [<OUTPUT FILE>] ; write trace output to a file\n"
+  "UNTRACE -B|-D [<COUNT>] <FILE>    ; write a binary trace to a file\n"
+  ";Note: Use uSimTrace to decode a binary trace.\n"
+  ";      Use -D to delta compress the binary trace."
 },
 
+#ifdef WATCHPOINTS
+{ "WATCH", WATCH, "Set or remove watchpoints.",
+  "WATCH                   ; displays current watchpoints\n"
+  "WATCH .                 ; removes all watchpoints\n"
+  "WATCH [R|W|A] <RANGE>...; sets and removes watchpoints\n"
+  ";    [+]<FIRST>[-<LAST>]  watches reads, writes or all accesses\n"
+  ";    -<FIRST>[-<LAST>]    removes a watchpoint\n"
+  ";Note: The " CPU " stops after the instruction that hit it."
+},
+#endif
+
 { 0, 0, 0, 0 }
 
 };
@@ -3050,6 +3876,16 @@ int MonitorCommand(const char *format, ...)
 	SetSystemFlags(kSystemMonitor, 0);
 	gMonitorActive = 1;
 
+#ifdef WATCHPOINTS
+	/* The monitor's own accesses are not watched. */
+	ArmWatch(0);
+#endif
+
+#ifdef REVERSE
+	/* The monitor's own writes are not undone. */
+	ArmUndo(0);
+#endif
+
 	/* Get the next command. */
 	printf(kConsoleCleanLine kConsoleColorSystem CPU ">");
 	if (format != 0) {
@@ -3122,14 +3958,25 @@ int MonitorCommand(const char *format, ...)
 	if (gHistoryEnable > 0)
 		SetSystemFlags(kSystemBreak, 0);
 
-	/* Set the kSystemBreak flag if tracing is enabled. */
-	if ((gTraceCount > 0) || (gTraceFile != 0))
+	/* Set the kSystemBreak flag if counting every instruction. */
+	if (gProfileEnable)
 		SetSystemFlags(kSystemBreak, 0);
 
-	/* Set the kSystemBreak flag if breakpoints are enabled. */
-	if ((gMaxBreak > 0) || (gMaxTBreak > 0))
+	/* Set the kSystemBreak flag if tracing is enabled. */
+	if ((gTraceCount > 0) || (gTraceFile != 0) || (gTraceBinary != 0))
 		SetSystemFlags(kSystemBreak, 0);
 
+#ifdef WATCHPOINTS
+	/* Arm the watchpoints, if any. */
+	gWatchHitKind = 0;
+	ArmWatch(1);
+#endif
+
+#ifdef REVERSE
+	/* Arm the undo log, if a history is kept. */
+	ArmUndo(1);
+#endif
+
 	/* Exit the monitor if the trace count is non-zero. */
 	if (gTraceCount > 0)
 		SetSystemFlags(0, kSystemMonitor);
@@ -3149,6 +3996,15 @@ void MonitorClose(void)
 		gTraceFile = 0;
 	}
 
+	if (gTraceBinary != 0) {
+		TraceClose(gTraceBinary);
+		gTraceBinary = 0;
+	}
+
+	ProfileClose();
+
+	LogSystemStats(0, 0);
+
 }
 
 /* MonitorFlags() performs system monitor activity. */
@@ -3160,49 +4016,71 @@ Byte MonitorFlags(CpuStatePtr s)
 	gCpuStatePtr = s;
 	gAddress = s->pc.word;
 
+#ifdef WATCHPOINTS
+	/* The monitor's own accesses are not watched. */
+	if (gWatchArmed)
+		ArmWatch(0);
+#endif
+
+#ifdef REVERSE
+	/* The monitor's own writes are not undone. */
+	ArmUndo(0);
+#endif
+
 	/* Reset? */
 	if (GetSystemFlags() & kSystemReset)
 		MonitorCommand("RESET");
 
-	/* Breakpoint? */
-	if (GetSystemFlags() & kSystemBreak) {
-		int i;
+	/* Breakpoint? The CPU calls here at a breakpoint without */
+	/* kSystemBreak, so the breakpoint map is always looked at. */
+	if ((GetSystemFlags() & kSystemBreak) || IsBreak(gAddress)) {
 		unsigned hit = 0;
-		/* Search for a Temporary BreakPoint match. */
-		for (i = 0; i < gMaxTBreak; i++)
-			if (gAddress == gTBreakAddress[i])
-				hit++;
-		/* Search for a BreakPoint match. */
-		for (i = 0; i < gMaxBreak; i++)
-			if (gAddress == gBreakAddress[i])
-				hit++;
+		/* A BreakPoint or Temporary BreakPoint match. */
+		if (IsBreak(gAddress))
+			hit++;
 		/* Break if this is the last instruction to trace. */
 		if ((gTraceCount > 0) && (--gTraceCount == 0))
 			hit++;
+#ifdef WATCHPOINTS
+		/* Break after the instruction that hit a WatchPoint. */
+		if (gWatchHitKind != 0) {
+			SystemMessage("%c %04X\n",
+			              (gWatchHitKind == kWatchRead) ? 'R' : 'W',
+			              gWatchHitAddress & 0xFFFF);
+			gWatchHitKind = 0;
+			hit++;
+		}
+#endif
 		/* Enter the Monitor if a BreakPoint is Hit. */
 		if (hit) {
 			SystemMessage("*%04X\n", gAddress & 0xFFFF);
 			SetSystemFlags(kSystemMonitor, 0);
-			gMaxTBreak = 0;
+			SetTBreaks(0, 0);
 		}
 	}
 
-	/* Monitor? */
-    while (GetSystemFlags() & kSystemMonitor)
-    	MonitorCommand(0);
+	/* Monitor? Its host time is counted apart from the CPU's. */
+	if (GetSystemFlags() & kSystemMonitor) {
+		gSystemStats.monitorSince = GetMicroseconds();
+		while (GetSystemFlags() & kSystemMonitor)
+			MonitorCommand(0);
+		gSystemStats.monitor += GetMicroseconds() - gSystemStats.monitorSince;
+		gSystemStats.monitorSince = 0;
+	}
 
 	/* Trace? */
 	if (GetSystemFlags() & kSystemBreak) {
 		char buffer[256];
-		int i;
 		/* Collect state history if enabled... */
 		if (gHistoryEnable > 0) {
-			for (i = kMaxHistory - 1; i > 0; i--)
-				gHistory[i] = gHistory[i - 1];
-			gHistory[0] = *gCpuStatePtr;
+			gHistory[gHistoryNext] = *gCpuStatePtr;
+			gHistoryNext = (gHistoryNext + 1) % kMaxHistory;
 			if (gHistoryEnable < kMaxHistory)
 				gHistoryEnable++;
 		}
+		/* Count the instruction if profiling with -E... */
+		if (gProfileEnable)
+			ProfileInstruction(gCpuStatePtr);
 		/* Display trace if enable... */
 		if (gTraceDisplay) {
 			DissasembleCpuState(buffer, gCpuStatePtr);
@@ -3213,8 +4091,24 @@ Byte MonitorFlags(CpuStatePtr s)
 			DissasembleCpuState(buffer, gCpuStatePtr);
 			fprintf(gTraceFile, "%s\n", buffer);
 		}
+		/* Output a binary trace if enabled... */
+		if ((gTraceBinary != 0) && !TraceWrite(gTraceBinary, gCpuStatePtr)) {
+			SystemMessage("?ERROR\n");
+			CloseTraceFile();
+		}
 	}
 
+#ifdef WATCHPOINTS
+	/* Arm the watchpoints again, if any. */
+	if (gMaxWatch > 0)
+		ArmWatch(1);
+#endif
+
+#ifdef REVERSE
+	/* Arm the undo log again, if a history is kept. */
+	ArmUndo(1);
+#endif
+
 	/* All done, return non-zero if halting. */
 	return GetSystemFlags() & kSystemHalt;
 
@@ -1 +1 @@
-/* uSim opcb.h * Copyright (C) 2000, Tsurishaddai Williamson, tsuri@earthlink.net *  * This program is free software; you can redistribute it and/or * modify it under the terms of the GNU General Public License * as published by the Free Software Foundation; either version 2 * of the License, or (at your option) any later version. *  * This program is distributed in the hope that it will be useful, * but WITHOUT ANY WARRANTY; without even the implied warranty of * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the * GNU General Public License for more details. *  * You should have received a copy of the GNU General Public License * along with this program; if not, write to the Free Software * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA. *//**********************************************************************/OPERATION(0x00, CB00, A, "", "RLC B", UOP2, RLC_B)OPERATION(0x01, CB01, A, "", "RLC C", UOP2, RLC_C)OPERATION(0x02, CB02, A, "", "RLC D", UOP2, RLC_D)OPERATION(0x03, CB03, A, "", "RLC E", UOP2, RLC_E)OPERATION(0x04, CB04, A, "", "RLC H", UOP2, RLC_H)OPERATION(0x05, CB05, A, "", "RLC L", UOP2, RLC_L)OPERATION(0x06, CB06, A, "", "RLC (HL)", UOP2, RLC_iHL)OPERATION(0x07, CB07, A, "", "RLC A", UOP2, RLC_A)OPERATION(0x08, CB08, A, "", "RRC B", UOP2, RRC_B)OPERATION(0x09, CB09, A, "", "RRC C", UOP2, RRC_C)OPERATION(0x0A, CB0A, A, "", "RRC D", UOP2, RRC_D)OPERATION(0x0B, CB0B, A, "", "RRC E", UOP2, RRC_E)OPERATION(0x0C, CB0C, A, "", "RRC H", UOP2, RRC_H)OPERATION(0x0D, CB0D, A, "", "RRC L", UOP2, RRC_L)OPERATION(0x0E, CB0E, A, "", "RRC (HL)", UOP2, RRC_iHL)OPERATION(0x0F, CB0F, A, "", "RRC A", UOP2, RRC_A)OPERATION(0x10, CB10, A, "", "RL B", UOP2, RL_B)OPERATION(0x11, CB11, A, "", "RL C", UOP2, RL_C)OPERATION(0x12, CB12, A, "", "RL D", UOP2, RL_D)OPERATION(0x13, CB13, A, "", "RL E", UOP2, RL_E)OPERATION(0x14, CB14, A, "", "RL H", UOP2, RL_H)OPERATION(0x15, CB15, A, "", "RL L", UOP2, RL_L)OPERATION(0x16, CB16, A, "", "RL (HL)", UOP2, RL_iHL)OPERATION(0x17, CB17, A, "", "RL A", UOP2, RL_A)OPERATION(0x18, CB18, A, "", "RR B", UOP2, RR_B)OPERATION(0x19, CB19, A, "", "RR C", UOP2, RR_C)OPERATION(0x1A, CB1A, A, "", "RR D", UOP2, RR_D)OPERATION(0x1B, CB1B, A, "", "RR E", UOP2, RR_E)OPERATION(0x1C, CB1C, A, "", "RR H", UOP2, RR_H)OPERATION(0x1D, CB1D, A, "", "RR L", UOP2, RR_L)OPERATION(0x1E, CB1E, A, "", "RR (HL)", UOP2, RR_iHL)OPERATION(0x1F, CB1F, A, "", "RR A", UOP2, RR_A)OPERATION(0x20, CB20, A, "", "SLA B", UOP2, SLA_B)OPERATION(0x21, CB21, A, "", "SLA C", UOP2, SLA_C)OPERATION(0x22, CB22, A, "", "SLA D", UOP2, SLA_D)OPERATION(0x23, CB23, A, "", "SLA E", UOP2, SLA_E)OPERATION(0x24, CB24, A, "", "SLA H", UOP2, SLA_H)OPERATION(0x25, CB25, A, "", "SLA L", UOP2, SLA_L)OPERATION(0x26, CB26, A, "", "SLA (HL)", UOP2, SLA_iHL)OPERATION(0x27, CB27, A, "", "SLA A", UOP2, SLA_A)OPERATION(0x28, CB28, A, "", "SRA B", UOP2, SRA_B)OPERATION(0x29, CB29, A, "", "SRA C", UOP2, SRA_C)OPERATION(0x2A, CB2A, A, "", "SRA D", UOP2, SRA_D)OPERATION(0x2B, CB2B, A, "", "SRA E", UOP2, SRA_E)OPERATION(0x2C, CB2C, A, "", "SRA H", UOP2, SRA_H)OPERATION(0x2D, CB2D, A, "", "SRA L", UOP2, SRA_L)OPERATION(0x2E, CB2E, A, "", "SRA (HL)", UOP2, SRA_iHL)OPERATION(0x2F, CB2F, A, "", "SRA A", UOP2, SRA_A)OPERATION(0x30, CB30, A, "", "SLIA B", UOP2, SLIA_B)OPERATION(0x31, CB31, A, "", "SLIA C", UOP2, SLIA_C)OPERATION(0x32, CB32, A, "", "SLIA D", UOP2, SLIA_D)OPERATION(0x33, CB33, A, "", "SLIA E", UOP2, SLIA_E)OPERATION(0x34, CB34, A, "", "SLIA H", UOP2, SLIA_H)OPERATION(0x35, CB35, A, "", "SLIA L", UOP2, SLIA_L)OPERATION(0x36, CB36, A, "", "SLIA (HL)", UOP2, SLIA_iHL)OPERATION(0x37, CB37, A, "", "SLIA A", UOP2, SLIA_A)OPERATION(0x38, CB38, A, "", "SRL B", UOP2, SRL_B)OPERATION(0x39, CB39, A, "", "SRL C", UOP2, SRL_C)OPERATION(0x3A, CB3A, A, "", "SRL D", UOP2, SRL_D)OPERATION(0x3B, CB3B, A, "", "SRL E", UOP2, SRL_E)OPERATION(0x3C, CB3C, A, "", "SRL H", UOP2, SRL_H)OPERATION(0x3D, CB3D, A, "", "SRL L", UOP2, SRL_L)OPERATION(0x3E, CB3E, A, "", "SRL (HL)", UOP2, SRL_iHL)OPERATION(0x3F, CB3F, A, "", "SRL A", UOP2, SRL_A)OPERATION(0x40, CB40, A, "", "BIT 0,B", UOP2, BIT_0_B)OPERATION(0x41, CB41, A, "", "BIT 0,C", UOP2, BIT_0_C)OPERATION(0x42, CB42, A, "", "BIT 0,D", UOP2, BIT_0_D)OPERATION(0x43, CB43, A, "", "BIT 0,E", UOP2, BIT_0_E)OPERATION(0x44, CB44, A, "", "BIT 0,H", UOP2, BIT_0_H)OPERATION(0x45, CB45, A, "", "BIT 0,L", UOP2, BIT_0_L)OPERATION(0x46, CB46, A, "", "BIT 0,(HL)", UOP2, BIT_0_iHL)OPERATION(0x47, CB47, A, "", "BIT 0,A", UOP2, BIT_0_A)OPERATION(0x48, CB48, A, "", "BIT 1,B", UOP2, BIT_1_B)OPERATION(0x49, CB49, A, "", "BIT 1,C", UOP2, BIT_1_C)OPERATION(0x4A, CB4A, A, "", "BIT 1,D", UOP2, BIT_1_D)OPERATION(0x4B, CB4B, A, "", "BIT 1,E", UOP2, BIT_1_E)OPERATION(0x4C, CB4C, A, "", "BIT 1,H", UOP2, BIT_1_H)OPERATION(0x4D, CB4D, A, "", "BIT 1,L", UOP2, BIT_1_L)OPERATION(0x4E, CB4E, A, "", "BIT 1,(HL)", UOP2, BIT_1_iHL)OPERATION(0x4F, CB4F, A, "", "BIT 1,A", UOP2, BIT_1_A)OPERATION(0x50, CB50, A, "", "BIT 2,B", UOP2, BIT_2_B)OPERATION(0x51, CB51, A, "", "BIT 2,C", UOP2, BIT_2_C)OPERATION(0x52, CB52, A, "", "BIT 2,D", UOP2, BIT_2_D)OPERATION(0x53, CB53, A, "", "BIT 2,E", UOP2, BIT_2_E)OPERATION(0x54, CB54, A, "", "BIT 2,H", UOP2, BIT_2_H)OPERATION(0x55, CB55, A, "", "BIT 2,L", UOP2, BIT_2_L)OPERATION(0x56, CB56, A, "", "BIT 2,(HL)", UOP2, BIT_2_iHL)OPERATION(0x57, CB57, A, "", "BIT 2,A", UOP2, BIT_2_A)OPERATION(0x58, CB58, A, "", "BIT 3,B", UOP2, BIT_3_B)OPERATION(0x59, CB59, A, "", "BIT 3,C", UOP2, BIT_3_C)OPERATION(0x5A, CB5A, A, "", "BIT 3,D", UOP2, BIT_3_D)OPERATION(0x5B, CB5B, A, "", "BIT 3,E", UOP2, BIT_3_E)OPERATION(0x5C, CB5C, A, "", "BIT 3,H", UOP2, BIT_3_H)OPERATION(0x5D, CB5D, A, "", "BIT 3,L", UOP2, BIT_3_L)OPERATION(0x5E, CB5E, A, "", "BIT 3,(HL)", UOP2, BIT_3_iHL)OPERATION(0x5F, CB5F, A, "", "BIT 3,A", UOP2, BIT_3_A)OPERATION(0x60, CB60, A, "", "BIT 4,B", UOP2, BIT_4_B)OPERATION(0x61, CB61, A, "", "BIT 4,C", UOP2, BIT_4_C)OPERATION(0x62, CB62, A, "", "BIT 4,D", UOP2, BIT_4_D)OPERATION(0x63, CB63, A, "", "BIT 4,E", UOP2, BIT_4_E)OPERATION(0x64, CB64, A, "", "BIT 4,H", UOP2, BIT_4_H)OPERATION(0x65, CB65, A, "", "BIT 4,L", UOP2, BIT_4_L)OPERATION(0x66, CB66, A, "", "BIT 4,(HL)", UOP2, BIT_4_iHL)OPERATION(0x67, CB67, A, "", "BIT 4,A", UOP2, BIT_4_A)OPERATION(0x68, CB68, A, "", "BIT 5,B", UOP2, BIT_5_B)OPERATION(0x69, CB69, A, "", "BIT 5,C", UOP2, BIT_5_C)OPERATION(0x6A, CB6A, A, "", "BIT 5,D", UOP2, BIT_5_D)OPERATION(0x6B, CB6B, A, "", "BIT 5,E", UOP2, BIT_5_E)OPERATION(0x6C, CB6C, A, "", "BIT 5,H", UOP2, BIT_5_H)OPERATION(0x6D, CB6D, A, "", "BIT 5,L", UOP2, BIT_5_L)OPERATION(0x6E, CB6E, A, "", "BIT 5,(HL)", UOP2, BIT_5_iHL)OPERATION(0x6F, CB6F, A, "", "BIT 5,A", UOP2, BIT_5_A)OPERATION(0x70, CB70, A, "", "BIT 6,B", UOP2, BIT_6_B)OPERATION(0x71, CB71, A, "", "BIT 6,C", UOP2, BIT_6_C)OPERATION(0x72, CB72, A, "", "BIT 6,D", UOP2, BIT_6_D)OPERATION(0x73, CB73, A, "", "BIT 6,E", UOP2, BIT_6_E)OPERATION(0x74, CB74, A, "", "BIT 6,H", UOP2, BIT_6_H)OPERATION(0x75, CB75, A, "", "BIT 6,L", UOP2, BIT_6_L)OPERATION(0x76, CB76, A, "", "BIT 6,(HL)", UOP2, BIT_6_iHL)OPERATION(0x77, CB77, A, "", "BIT 6,A", UOP2, BIT_6_A)OPERATION(0x78, CB78, A, "", "BIT 7,B", UOP2, BIT_7_B)OPERATION(0x79, CB79, A, "", "BIT 7,C", UOP2, BIT_7_C)OPERATION(0x7A, CB7A, A, "", "BIT 7,D", UOP2, BIT_7_D)OPERATION(0x7B, CB7B, A, "", "BIT 7,E", UOP2, BIT_7_E)OPERATION(0x7C, CB7C, A, "", "BIT 7,H", UOP2, BIT_7_H)OPERATION(0x7D, CB7D, A, "", "BIT 7,L", UOP2, BIT_7_L)OPERATION(0x7E, CB7E, A, "", "BIT 7,(HL)", UOP2, BIT_7_iHL)OPERATION(0x7F, CB7F, A, "", "BIT 7,A", UOP2, BIT_7_A)OPERATION(0x80, CB80, A, "", "RES 0,B", UOP2, RES_0_B)OPERATION(0x81, CB81, A, "", "RES 0,C", UOP2, RES_0_C)OPERATION(0x82, CB82, A, "", "RES 0,D", UOP2, RES_0_D)OPERATION(0x83, CB83, A, "", "RES 0,E", UOP2, RES_0_E)OPERATION(0x84, CB84, A, "", "RES 0,H", UOP2, RES_0_H)OPERATION(0x85, CB85, A, "", "RES 0,L", UOP2, RES_0_L)OPERATION(0x86, CB86, A, "", "RES 0,(HL)", UOP2, RES_0_iHL)OPERATION(0x87, CB87, A, "", "RES 0,A", UOP2, RES_0_A)OPERATION(0x88, CB88, A, "", "RES 1,B", UOP2, RES_1_B)OPERATION(0x89, CB89, A, "", "RES 1,C", UOP2, RES_1_C)OPERATION(0x8A, CB8A, A, "", "RES 1,D", UOP2, RES_1_D)OPERATION(0x8B, CB8B, A, "", "RES 1,E", UOP2, RES_1_E)OPERATION(0x8C, CB8C, A, "", "RES 1,H", UOP2, RES_1_H)OPERATION(0x8D, CB8D, A, "", "RES 1,L", UOP2, RES_1_L)OPERATION(0x8E, CB8E, A, "", "RES 1,(HL)", UOP2, RES_1_iHL)OPERATION(0x8F, CB8F, A, "", "RES 1,A", UOP2, RES_1_A)OPERATION(0x90, CB90, A, "", "RES 2,B", UOP2, RES_2_B)OPERATION(0x91, CB91, A, "", "RES 2,C", UOP2, RES_2_C)OPERATION(0x92, CB92, A, "", "RES 2,D", UOP2, RES_2_D)OPERATION(0x93, CB93, A, "", "RES 2,E", UOP2, RES_2_E)OPERATION(0x94, CB94, A, "", "RES 2,H", UOP2, RES_2_H)OPERATION(0x95, CB95, A, "", "RES 2,L", UOP2, RES_2_L)OPERATION(0x96, CB96, A, "", "RES 2,(HL)", UOP2, RES_2_iHL)OPERATION(0x97, CB97, A, "", "RES 2,A", UOP2, RES_2_A)OPERATION(0x98, CB98, A, "", "RES 3,B", UOP2, RES_3_B)OPERATION(0x99, CB99, A, "", "RES 3,C", UOP2, RES_3_C)OPERATION(0x9A, CB9A, A, "", "RES 3,D", UOP2, RES_3_D)OPERATION(0x9B, CB9B, A, "", "RES 3,E", UOP2, RES_3_E)OPERATION(0x9C, CB9C, A, "", "RES 3,H", UOP2, RES_3_H)OPERATION(0x9D, CB9D, A, "", "RES 3,L", UOP2, RES_3_L)OPERATION(0x9E, CB9E, A, "", "RES 3,(HL)", UOP2, RES_3_iHL)OPERATION(0x9F, CB9F, A, "", "RES 3,A", UOP2, RES_3_A)OPERATION(0xA0, CBA0, A, "", "RES 4,B", UOP2, RES_4_B)OPERATION(0xA1, CBA1, A, "", "RES 4,C", UOP2, RES_4_C)OPERATION(0xA2, CBA2, A, "", "RES 4,D", UOP2, RES_4_D)OPERATION(0xA3, CBA3, A, "", "RES 4,E", UOP2, RES_4_E)OPERATION(0xA4, CBA4, A, "", "RES 4,H", UOP2, RES_4_H)OPERATION(0xA5, CBA5, A, "", "RES 4,L", UOP2, RES_4_L)OPERATION(0xA6, CBA6, A, "", "RES 4,(HL)", UOP2, RES_4_iHL)OPERATION(0xA7, CBA7, A, "", "RES 4,A", UOP2, RES_4_A)OPERATION(0xA8, CBA8, A, "", "RES 5,B", UOP2, RES_5_B)OPERATION(0xA9, CBA9, A, "", "RES 5,C", UOP2, RES_5_C)OPERATION(0xAA, CBAA, A, "", "RES 5,D", UOP2, RES_5_D)OPERATION(0xAB, CBAB, A, "", "RES 5,E", UOP2, RES_5_E)OPERATION(0xAC, CBAC, A, "", "RES 5,H", UOP2, RES_5_H)OPERATION(0xAD, CBAD, A, "", "RES 5,L", UOP2, RES_5_L)OPERATION(0xAE, CBAE, A, "", "RES 5,(HL)", UOP2, RES_5_iHL)OPERATION(0xAF, CBAF, A, "", "RES 5,A", UOP2, RES_5_A)OPERATION(0xB0, CBB0, A, "", "RES 6,B", UOP2, RES_6_B)OPERATION(0xB1, CBB1, A, "", "RES 6,C", UOP2, RES_6_C)OPERATION(0xB2, CBB2, A, "", "RES 6,D", UOP2, RES_6_D)OPERATION(0xB3, CBB3, A, "", "RES 6,E", UOP2, RES_6_E)OPERATION(0xB4, CBB4, A, "", "RES 6,H", UOP2, RES_6_H)OPERATION(0xB5, CBB5, A, "", "RES 6,L", UOP2, RES_6_L)OPERATION(0xB6, CBB6, A, "", "RES 6,(HL)", UOP2, RES_6_iHL)OPERATION(0xB7, CBB7, A, "", "RES 6,A", UOP2, RES_6_A)OPERATION(0xB8, CBB8, A, "", "RES 7,B", UOP2, RES_7_B)OPERATION(0xB9, CBB9, A, "", "RES 7,C", UOP2, RES_7_C)OPERATION(0xBA, CBBA, A, "", "RES 7,D", UOP2, RES_7_D)OPERATION(0xBB, CBBB, A, "", "RES 7,E", UOP2, RES_7_E)OPERATION(0xBC, CBBC, A, "", "RES 7,H", UOP2, RES_7_H)OPERATION(0xBD, CBBD, A, "", "RES 7,L", UOP2, RES_7_L)OPERATION(0xBE, CBBE, A, "", "RES 7,(HL)", UOP2, RES_7_iHL)OPERATION(0xBF, CBBF, A, "", "RES 7,A", UOP2, RES_7_A)OPERATION(0xC0, CBC0, A, "", "SET 0,B", UOP2, SET_0_B)OPERATION(0xC1, CBC1, A, "", "SET 0,C", UOP2, SET_0_C)OPERATION(0xC2, CBC2, A, "", "SET 0,D", UOP2, SET_0_D)OPERATION(0xC3, CBC3, A, "", "SET 0,E", UOP2, SET_0_E)OPERATION(0xC4, CBC4, A, "", "SET 0,H", UOP2, SET_0_H)OPERATION(0xC5, CBC5, A, "", "SET 0,L", UOP2, SET_0_L)OPERATION(0xC6, CBC6, A, "", "SET 0,(HL)", UOP2, SET_0_iHL)OPERATION(0xC7, CBC7, A, "", "SET 0,A", UOP2, SET_0_A)OPERATION(0xC8, CBC8, A, "", "SET 1,B", UOP2, SET_1_B)OPERATION(0xC9, CBC9, A, "", "SET 1,C", UOP2, SET_1_C)OPERATION(0xCA, CBCA, A, "", "SET 1,D", UOP2, SET_1_D)OPERATION(0xCB, CBCB, A, "", "SET 1,E", UOP2, SET_1_E)OPERATION(0xCC, CBCC, A, "", "SET 1,H", UOP2, SET_1_H)OPERATION(0xCD, CBCD, A, "", "SET 1,L", UOP2, SET_1_L)OPERATION(0xCE, CBCE, A, "", "SET 1,(HL)", UOP2, SET_1_iHL)OPERATION(0xCF, CBCF, A, "", "SET 1,A", UOP2, SET_1_A)OPERATION(0xD0, CBD0, A, "", "SET 2,B", UOP2, SET_2_B)OPERATION(0xD1, CBD1, A, "", "SET 2,C", UOP2, SET_2_C)OPERATION(0xD2, CBD2, A, "", "SET 2,D", UOP2, SET_2_D)OPERATION(0xD3, CBD3, A, "", "SET 2,E", UOP2, SET_2_E)OPERATION(0xD4, CBD4, A, "", "SET 2,H", UOP2, SET_2_H)OPERATION(0xD5, CBD5, A, "", "SET 2,L", UOP2, SET_2_L)OPERATION(0xD6, CBD6, A, "", "SET 2,(HL)", UOP2, SET_2_iHL)OPERATION(0xD7, CBD7, A, "", "SET 2,A", UOP2, SET_2_A)OPERATION(0xD8, CBD8, A, "", "SET 3,B", UOP2, SET_3_B)OPERATION(0xD9, CBD9, A, "", "SET 3,C", UOP2, SET_3_C)OPERATION(0xDA, CBDA, A, "", "SET 3,D", UOP2, SET_3_D)OPERATION(0xDB, CBDB, A, "", "SET 3,E", UOP2, SET_3_E)OPERATION(0xDC, CBDC, A, "", "SET 3,H", UOP2, SET_3_H)OPERATION(0xDD, CBDD, A, "", "SET 3,L", UOP2, SET_3_L)OPERATION(0xDE, CBDE, A, "", "SET 3,(HL)", UOP2, SET_3_iHL)OPERATION(0xDF, CBDF, A, "", "SET 3,A", UOP2, SET_3_A)OPERATION(0xE0, CBE0, A, "", "SET 4,B", UOP2, SET_4_B)OPERATION(0xE1, CBE1, A, "", "SET 4,C", UOP2, SET_4_C)OPERATION(0xE2, CBE2, A, "", "SET 4,D", UOP2, SET_4_D)OPERATION(0xE3, CBE3, A, "", "SET 4,E", UOP2, SET_4_E)OPERATION(0xE4, CBE4, A, "", "SET 4,H", UOP2, SET_4_H)OPERATION(0xE5, CBE5, A, "", "SET 4,L", UOP2, SET_4_L)OPERATION(0xE6, CBE6, A, "", "SET 4,(HL)", UOP2, SET_4_iHL)OPERATION(0xE7, CBE7, A, "", "SET 4,A", UOP2, SET_4_A)OPERATION(0xE8, CBE8, A, "", "SET 5,B", UOP2, SET_5_B)OPERATION(0xE9, CBE9, A, "", "SET 5,C", UOP2, SET_5_C)OPERATION(0xEA, CBEA, A, "", "SET 5,D", UOP2, SET_5_D)OPERATION(0xEB, CBEB, A, "", "SET 5,E", UOP2, SET_5_E)OPERATION(0xEC, CBEC, A, "", "SET 5,H", UOP2, SET_5_H)OPERATION(0xED, CBED, A, "", "SET 5,L", UOP2, SET_5_L)OPERATION(0xEE, CBEE, A, "", "SET 5,(HL)", UOP2, SET_5_iHL)OPERATION(0xEF, CBEF, A, "", "SET 5,A", UOP2, SET_5_A)OPERATION(0xF0, CBF0, A, "", "SET 6,B", UOP2, SET_6_B)OPERATION(0xF1, CBF1, A, "", "SET 6,C", UOP2, SET_6_C)OPERATION(0xF2, CBF2, A, "", "SET 6,D", UOP2, SET_6_D)OPERATION(0xF3, CBF3, A, "", "SET 6,E", UOP2, SET_6_E)OPERATION(0xF4, CBF4, A, "", "SET 6,H", UOP2, SET_6_H)OPERATION(0xF5, CBF5, A, "", "SET 6,L", UOP2, SET_6_L)OPERATION(0xF6, CBF6, A, "", "SET 6,(HL)", UOP2, SET_6_iHL)OPERATION(0xF7, CBF7, A, "", "SET 6,A", UOP2, SET_6_A)OPERATION(0xF8, CBF8, A, "", "SET 7,B", UOP2, SET_7_B)OPERATION(0xF9, CBF9, A, "", "SET 7,C", UOP2, SET_7_C)OPERATION(0xFA, CBFA, A, "", "SET 7,D", UOP2, SET_7_D)OPERATION(0xFB, CBFB, A, "", "SET 7,E", UOP2, SET_7_E)OPERATION(0xFC, CBFC, A, "", "SET 7,H", UOP2, SET_7_H)OPERATION(0xFD, CBFD, A, "", "SET 7,L", UOP2, SET_7_L)OPERATION(0xFE, CBFE, A, "", "SET 7,(HL)", UOP2, SET_7_iHL)OPERATION(0xFF, CBFF, A, "", "SET 7,A", UOP2, SET_7_A)
\ No newline at end of file
+/* uSim opcb.h * Copyright (C) 2000, Tsurishaddai Williamson, tsuri@earthlink.net *  * This program is free software; you can redistribute it and/or * modify it under the terms of the GNU General Public License * as published by the Free Software Foundation; either version 2 * of the License, or (at your option) any later version. *  * This program is distributed in the hope that it will be useful, * but WITHOUT ANY WARRANTY; without even the implied warranty of * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the * GNU General Public License for more details. *  * You should have received a copy of the GNU General Public License * along with this program; if not, write to the Free Software * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA. *//**********************************************************************/OPERATION(0x00, CB00, A, "", "RLC B", UOP2, RLC_B, 0, 8)OPERATION(0x01, CB01, A, "", "RLC C", UOP2, RLC_C, 0, 8)OPERATION(0x02, CB02, A, "", "RLC D", UOP2, RLC_D, 0, 8)OPERATION(0x03, CB03, A, "", "RLC E", UOP2, RLC_E, 0, 8)OPERATION(0x04, CB04, A, "", "RLC H", UOP2, RLC_H, 0, 8)OPERATION(0x05, CB05, A, "", "RLC L", UOP2, RLC_L, 0, 8)OPERATION(0x06, CB06, A, "", "RLC (HL)", UOP2, RLC_iHL, 0, 15)OPERATION(0x07, CB07, A, "", "RLC A", UOP2, RLC_A, 0, 8)OPERATION(0x08, CB08, A, "", "RRC B", UOP2, RRC_B, 0, 8)OPERATION(0x09, CB09, A, "", "RRC C", UOP2, RRC_C, 0, 8)OPERATION(0x0A, CB0A, A, "", "RRC D", UOP2, RRC_D, 0, 8)OPERATION(0x0B, CB0B, A, "", "RRC E", UOP2, RRC_E, 0, 8)OPERATION(0x0C, CB0C, A, "", "RRC H", UOP2, RRC_H, 0, 8)OPERATION(0x0D, CB0D, A, "", "RRC L", UOP2, RRC_L, 0, 8)OPERATION(0x0E, CB0E, A, "", "RRC (HL)", UOP2, RRC_iHL, 0, 15)OPERATION(0x0F, CB0F, A, "", "RRC A", UOP2, RRC_A, 0, 8)OPERATION(0x10, CB10, A, "", "RL B", UOP2, RL_B, 0, 8)OPERATION(0x11, CB11, A, "", "RL C", UOP2, RL_C, 0, 8)OPERATION(0x12, CB12, A, "", "RL D", UOP2, RL_D, 0, 8)OPERATION(0x13, CB13, A, "", "RL E", UOP2, RL_E, 0, 8)OPERATION(0x14, CB14, A, "", "RL H", UOP2, RL_H, 0, 8)OPERATION(0x15, CB15, A, "", "RL L", UOP2, RL_L, 0, 8)OPERATION(0x16, CB16, A, "", "RL (HL)", UOP2, RL_iHL, 0, 15)OPERATION(0x17, CB17, A, "", "RL A", UOP2, RL_A, 0, 8)OPERATION(0x18, CB18, A, "", "RR B", UOP2, RR_B, 0, 8)OPERATION(0x19, CB19, A, "", "RR C", UOP2, RR_C, 0, 8)OPERATION(0x1A, CB1A, A, "", "RR D", UOP2, RR_D, 0, 8)OPERATION(0x1B, CB1B, A, "", "RR E", UOP2, RR_E, 0, 8)OPERATION(0x1C, CB1C, A, "", "RR H", UOP2, RR_H, 0, 8)OPERATION(0x1D, CB1D, A, "", "RR L", UOP2, RR_L, 0, 8)OPERATION(0x1E, CB1E, A, "", "RR (HL)", UOP2, RR_iHL, 0, 15)OPERATION(0x1F, CB1F, A, "", "RR A", UOP2, RR_A, 0, 8)OPERATION(0x20, CB20, A, "", "SLA B", UOP2, SLA_B, 0, 8)OPERATION(0x21, CB21, A, "", "SLA C", UOP2, SLA_C, 0, 8)OPERATION(0x22, CB22, A, "", "SLA D", UOP2, SLA_D, 0, 8)OPERATION(0x23, CB23, A, "", "SLA E", UOP2, SLA_E, 0, 8)OPERATION(0x24, CB24, A, "", "SLA H", UOP2, SLA_H, 0, 8)OPERATION(0x25, CB25, A, "", "SLA L", UOP2, SLA_L, 0, 8)OPERATION(0x26, CB26, A, "", "SLA (HL)", UOP2, SLA_iHL, 0, 15)OPERATION(0x27, CB27, A, "", "SLA A", UOP2, SLA_A, 0, 8)OPERATION(0x28, CB28, A, "", "SRA B", UOP2, SRA_B, 0, 8)OPERATION(0x29, CB29, A, "", "SRA C", UOP2, SRA_C, 0, 8)OPERATION(0x2A, CB2A, A, "", "SRA D", UOP2, SRA_D, 0, 8)OPERATION(0x2B, CB2B, A, "", "SRA E", UOP2, SRA_E, 0, 8)OPERATION(0x2C, CB2C, A, "", "SRA H", UOP2, SRA_H, 0, 8)OPERATION(0x2D, CB2D, A, "", "SRA L", UOP2, SRA_L, 0, 8)OPERATION(0x2E, CB2E, A, "", "SRA (HL)", UOP2, SRA_iHL, 0, 15)OPERATION(0x2F, CB2F, A, "", "SRA A", UOP2, SRA_A, 0, 8)OPERATION(0x30, CB30, A, "", "SLIA B", UOP2, SLIA_B, 0, 8)OPERATION(0x31, CB31, A, "", "SLIA C", UOP2, SLIA_C, 0, 8)OPERATION(0x32, CB32, A, "", "SLIA D", UOP2, SLIA_D, 0, 8)OPERATION(0x33, CB33, A, "", "SLIA E", UOP2, SLIA_E, 0, 8)OPERATION(0x34, CB34, A, "", "SLIA H", UOP2, SLIA_H, 0, 8)OPERATION(0x35, CB35, A, "", "SLIA L", UOP2, SLIA_L, 0, 8)OPERATION(0x36, CB36, A, "", "SLIA (HL)", UOP2, SLIA_iHL, 0, 15)OPERATION(0x37, CB37, A, "", "SLIA A", UOP2, SLIA_A, 0, 8)OPERATION(0x38, CB38, A, "", "SRL B", UOP2, SRL_B, 0, 8)OPERATION(0x39, CB39, A, "", "SRL C", UOP2, SRL_C, 0, 8)OPERATION(0x3A, CB3A, A, "", "SRL D", UOP2, SRL_D, 0, 8)OPERATION(0x3B, CB3B, A, "", "SRL E", UOP2, SRL_E, 0, 8)OPERATION(0x3C, CB3C, A, "", "SRL H", UOP2, SRL_H, 0, 8)OPERATION(0x3D, CB3D, A, "", "SRL L", UOP2, SRL_L, 0, 8)OPERATION(0x3E, CB3E, A, "", "SRL (HL)", UOP2, SRL_iHL, 0, 15)OPERATION(0x3F, CB3F, A, "", "SRL A", UOP2, SRL_A, 0, 8)OPERATION(0x40, CB40, A, "", "BIT 0,B", UOP2, BIT_0_B, 0, 8)OPERATION(0x41, CB41, A, "", "BIT 0,C", UOP2, BIT_0_C, 0, 8)OPERATION(0x42, CB42, A, "", "BIT 0,D", UOP2, BIT_0_D, 0, 8)OPERATION(0x43, CB43, A, "", "BIT 0,E", UOP2, BIT_0_E, 0, 8)OPERATION(0x44, CB44, A, "", "BIT 0,H", UOP2, BIT_0_H, 0, 8)OPERATION(0x45, CB45, A, "", "BIT 0,L", UOP2, BIT_0_L, 0, 8)OPERATION(0x46, CB46, A, "", "BIT 0,(HL)", UOP2, BIT_0_iHL, 0, 12)OPERATION(0x47, CB47, A, "", "BIT 0,A", UOP2, BIT_0_A, 0, 8)OPERATION(0x48, CB48, A, "", "BIT 1,B", UOP2, BIT_1_B, 0, 8)OPERATION(0x49, CB49, A, "", "BIT 1,C", UOP2, BIT_1_C, 0, 8)OPERATION(0x4A, CB4A, A, "", "BIT 1,D", UOP2, BIT_1_D, 0, 8)OPERATION(0x4B, CB4B, A, "", "BIT 1,E", UOP2, BIT_1_E, 0, 8)OPERATION(0x4C, CB4C, A, "", "BIT 1,H", UOP2, BIT_1_H, 0, 8)OPERATION(0x4D, CB4D, A, "", "BIT 1,L", UOP2, BIT_1_L, 0, 8)OPERATION(0x4E, CB4E, A, "", "BIT 1,(HL)", UOP2, BIT_1_iHL, 0, 12)OPERATION(0x4F, CB4F, A, "", "BIT 1,A", UOP2, BIT_1_A, 0, 8)OPERATION(0x50, CB50, A, "", "BIT 2,B", UOP2, BIT_2_B, 0, 8)OPERATION(0x51, CB51, A, "", "BIT 2,C", UOP2, BIT_2_C, 0, 8)OPERATION(0x52, CB52, A, "", "BIT 2,D", UOP2, BIT_2_D, 0, 8)OPERATION(0x53, CB53, A, "", "BIT 2,E", UOP2, BIT_2_E, 0, 8)OPERATION(0x54, CB54, A, "", "BIT 2,H", UOP2, BIT_2_H, 0, 8)OPERATION(0x55, CB55, A, "", "BIT 2,L", UOP2, BIT_2_L, 0, 8)OPERATION(0x56, CB56, A, "", "BIT 2,(HL)", UOP2, BIT_2_iHL, 0, 12)OPERATION(0x57, CB57, A, "", "BIT 2,A", UOP2, BIT_2_A, 0, 8)OPERATION(0x58, CB58, A, "", "BIT 3,B", UOP2, BIT_3_B, 0, 8)OPERATION(0x59, CB59, A, "", "BIT 3,C", UOP2, BIT_3_C, 0, 8)OPERATION(0x5A, CB5A, A, "", "BIT 3,D", UOP2, BIT_3_D, 0, 8)OPERATION(0x5B, CB5B, A, "", "BIT 3,E", UOP2, BIT_3_E, 0, 8)OPERATION(0x5C, CB5C, A, "", "BIT 3,H", UOP2, BIT_3_H, 0, 8)OPERATION(0x5D, CB5D, A, "", "BIT 3,L", UOP2, BIT_3_L, 0, 8)OPERATION(0x5E, CB5E, A, "", "BIT 3,(HL)", UOP2, BIT_3_iHL, 0, 12)OPERATION(0x5F, CB5F, A, "", "BIT 3,A", UOP2, BIT_3_A, 0, 8)OPERATION(0x60, CB60, A, "", "BIT 4,B", UOP2, BIT_4_B, 0, 8)OPERATION(0x61, CB61, A, "", "BIT 4,C", UOP2, BIT_4_C, 0, 8)OPERATION(0x62, CB62, A, "", "BIT 4,D", UOP2, BIT_4_D, 0, 8)OPERATION(0x63, CB63, A, "", "BIT 4,E", UOP2, BIT_4_E, 0, 8)OPERATION(0x64, CB64, A, "", "BIT 4,H", UOP2, BIT_4_H, 0, 8)OPERATION(0x65, CB65, A, "", "BIT 4,L", UOP2, BIT_4_L, 0, 8)OPERATION(0x66, CB66, A, "", "BIT 4,(HL)", UOP2, BIT_4_iHL, 0, 12)OPERATION(0x67, CB67, A, "", "BIT 4,A", UOP2, BIT_4_A, 0, 8)OPERATION(0x68, CB68, A, "", "BIT 5,B", UOP2, BIT_5_B, 0, 8)OPERATION(0x69, CB69, A, "", "BIT 5,C", UOP2, BIT_5_C, 0, 8)OPERATION(0x6A, CB6A, A, "", "BIT 5,D", UOP2, BIT_5_D, 0, 8)OPERATION(0x6B, CB6B, A, "", "BIT 5,E", UOP2, BIT_5_E, 0, 8)OPERATION(0x6C, CB6C, A, "", "BIT 5,H", UOP2, BIT_5_H, 0, 8)OPERATION(0x6D, CB6D, A, "", "BIT 5,L", UOP2, BIT_5_L, 0, 8)OPERATION(0x6E, CB6E, A, "", "BIT 5,(HL)", UOP2, BIT_5_iHL, 0, 12)OPERATION(0x6F, CB6F, A, "", "BIT 5,A", UOP2, BIT_5_A, 0, 8)OPERATION(0x70, CB70, A, "", "BIT 6,B", UOP2, BIT_6_B, 0, 8)OPERATION(0x71, CB71, A, "", "BIT 6,C", UOP2, BIT_6_C, 0, 8)OPERATION(0x72, CB72, A, "", "BIT 6,D", UOP2, BIT_6_D, 0, 8)OPERATION(0x73, CB73, A, "", "BIT 6,E", UOP2, BIT_6_E, 0, 8)OPERATION(0x74, CB74, A, "", "BIT 6,H", UOP2, BIT_6_H, 0, 8)OPERATION(0x75, CB75, A, "", "BIT 6,L", UOP2, BIT_6_L, 0, 8)OPERATION(0x76, CB76, A, "", "BIT 6,(HL)", UOP2, BIT_6_iHL, 0, 12)OPERATION(0x77, CB77, A, "", "BIT 6,A", UOP2, BIT_6_A, 0, 8)OPERATION(0x78, CB78, A, "", "BIT 7,B", UOP2, BIT_7_B, 0, 8)OPERATION(0x79, CB79, A, "", "BIT 7,C", UOP2, BIT_7_C, 0, 8)OPERATION(0x7A, CB7A, A, "", "BIT 7,D", UOP2, BIT_7_D, 0, 8)OPERATION(0x7B, CB7B, A, "", "BIT 7,E", UOP2, BIT_7_E, 0, 8)OPERATION(0x7C, CB7C, A, "", "BIT 7,H", UOP2, BIT_7_H, 0, 8)OPERATION(0x7D, CB7D, A, "", "BIT 7,L", UOP2, BIT_7_L, 0, 8)OPERATION(0x7E, CB7E, A, "", "BIT 7,(HL)", UOP2, BIT_7_iHL, 0, 12)OPERATION(0x7F, CB7F, A, "", "BIT 7,A", UOP2, BIT_7_A, 0, 8)OPERATION(0x80, CB80, A, "", "RES 0,B", UOP2, RES_0_B, 0, 8)OPERATION(0x81, CB81, A, "", "RES 0,C", UOP2, RES_0_C, 0, 8)OPERATION(0x82, CB82, A, "", "RES 0,D", UOP2, RES_0_D, 0, 8)OPERATION(0x83, CB83, A, "", "RES 0,E", UOP2, RES_0_E, 0, 8)OPERATION(0x84, CB84, A, "", "RES 0,H", UOP2, RES_0_H, 0, 8)OPERATION(0x85, CB85, A, "", "RES 0,L", UOP2, RES_0_L, 0, 8)OPERATION(0x86, CB86, A, "", "RES 0,(HL)", UOP2, RES_0_iHL, 0, 15)OPERATION(0x87, CB87, A, "", "RES 0,A", UOP2, RES_0_A, 0, 8)OPERATION(0x88, CB88, A, "", "RES 1,B", UOP2, RES_1_B, 0, 8)OPERATION(0x89, CB89, A, "", "RES 1,C", UOP2, RES_1_C, 0, 8)OPERATION(0x8A, CB8A, A, "", "RES 1,D", UOP2, RES_1_D, 0, 8)OPERATION(0x8B, CB8B, A, "", "RES 1,E", UOP2, RES_1_E, 0, 8)OPERATION(0x8C, CB8C, A, "", "RES 1,H", UOP2, RES_1_H, 0, 8)OPERATION(0x8D, CB8D, A, "", "RES 1,L", UOP2, RES_1_L, 0, 8)OPERATION(0x8E, CB8E, A, "", "RES 1,(HL)", UOP2, RES_1_iHL, 0, 15)OPERATION(0x8F, CB8F, A, "", "RES 1,A", UOP2, RES_1_A, 0, 8)OPERATION(0x90, CB90, A, "", "RES 2,B", UOP2, RES_2_B, 0, 8)OPERATION(0x91, CB91, A, "", "RES 2,C", UOP2, RES_2_C, 0, 8)OPERATION(0x92, CB92, A, "", "RES 2,D", UOP2, RES_2_D, 0, 8)OPERATION(0x93, CB93, A, "", "RES 2,E", UOP2, RES_2_E, 0, 8)OPERATION(0x94, CB94, A, "", "RES 2,H", UOP2, RES_2_H, 0, 8)OPERATION(0x95, CB95, A, "", "RES 2,L", UOP2, RES_2_L, 0, 8)OPERATION(0x96, CB96, A, "", "RES 2,(HL)", UOP2, RES_2_iHL, 0, 15)OPERATION(0x97, CB97, A, "", "RES 2,A", UOP2, RES_2_A, 0, 8)OPERATION(0x98, CB98, A, "", "RES 3,B", UOP2, RES_3_B, 0, 8)OPERATION(0x99, CB99, A, "", "RES 3,C", UOP2, RES_3_C, 0, 8)OPERATION(0x9A, CB9A, A, "", "RES 3,D", UOP2, RES_3_D, 0, 8)OPERATION(0x9B, CB9B, A, "", "RES 3,E", UOP2, RES_3_E, 0, 8)OPERATION(0x9C, CB9C, A, "", "RES 3,H", UOP2, RES_3_H, 0, 8)OPERATION(0x9D, CB9D, A, "", "RES 3,L", UOP2, RES_3_L, 0, 8)OPERATION(0x9E, CB9E, A, "", "RES 3,(HL)", UOP2, RES_3_iHL, 0, 15)OPERATION(0x9F, CB9F, A, "", "RES 3,A", UOP2, RES_3_A, 0, 8)OPERATION(0xA0, CBA0, A, "", "RES 4,B", UOP2, RES_4_B, 0, 8)OPERATION(0xA1, CBA1, A, "", "RES 4,C", UOP2, RES_4_C, 0, 8)OPERATION(0xA2, CBA2, A, "", "RES 4,D", UOP2, RES_4_D, 0, 8)OPERATION(0xA3, CBA3, A, "", "RES 4,E", UOP2, RES_4_E, 0, 8)OPERATION(0xA4, CBA4, A, "", "RES 4,H", UOP2, RES_4_H, 0, 8)OPERATION(0xA5, CBA5, A, "", "RES 4,L", UOP2, RES_4_L, 0, 8)OPERATION(0xA6, CBA6, A, "", "RES 4,(HL)", UOP2, RES_4_iHL, 0, 15)OPERATION(0xA7, CBA7, A, "", "RES 4,A", UOP2, RES_4_A, 0, 8)OPERATION(0xA8, CBA8, A, "", "RES 5,B", UOP2, RES_5_B, 0, 8)OPERATION(0xA9, CBA9, A, "", "RES 5,C", UOP2, RES_5_C, 0, 8)OPERATION(0xAA, CBAA, A, "", "RES 5,D", UOP2, RES_5_D, 0, 8)OPERATION(0xAB, CBAB, A, "", "RES 5,E", UOP2, RES_5_E, 0, 8)OPERATION(0xAC, CBAC, A, "", "RES 5,H", UOP2, RES_5_H, 0, 8)OPERATION(0xAD, CBAD, A, "", "RES 5,L", UOP2, RES_5_L, 0, 8)OPERATION(0xAE, CBAE, A, "", "RES 5,(HL)", UOP2, RES_5_iHL, 0, 15)OPERATION(0xAF, CBAF, A, "", "RES 5,A", UOP2, RES_5_A, 0, 8)OPERATION(0xB0, CBB0, A, "", "RES 6,B", UOP2, RES_6_B, 0, 8)OPERATION(0xB1, CBB1, A, "", "RES 6,C", UOP2, RES_6_C, 0, 8)OPERATION(0xB2, CBB2, A, "", "RES 6,D", UOP2, RES_6_D, 0, 8)OPERATION(0xB3, CBB3, A, "", "RES 6,E", UOP2, RES_6_E, 0, 8)OPERATION(0xB4, CBB4, A, "", "RES 6,H", UOP2, RES_6_H, 0, 8)OPERATION(0xB5, CBB5, A, "", "RES 6,L", UOP2, RES_6_L, 0, 8)OPERATION(0xB6, CBB6, A, "", "RES 6,(HL)", UOP2, RES_6_iHL, 0, 15)OPERATION(0xB7, CBB7, A, "", "RES 6,A", UOP2, RES_6_A, 0, 8)OPERATION(0xB8, CBB8, A, "", "RES 7,B", UOP2, RES_7_B, 0, 8)OPERATION(0xB9, CBB9, A, "", "RES 7,C", UOP2, RES_7_C, 0, 8)OPERATION(0xBA, CBBA, A, "", "RES 7,D", UOP2, RES_7_D, 0, 8)OPERATION(0xBB, CBBB, A, "", "RES 7,E", UOP2, RES_7_E, 0, 8)OPERATION(0xBC, CBBC, A, "", "RES 7,H", UOP2, RES_7_H, 0, 8)OPERATION(0xBD, CBBD, A, "", "RES 7,L", UOP2, RES_7_L, 0, 8)OPERATION(0xBE, CBBE, A, "", "RES 7,(HL)", UOP2, RES_7_iHL, 0, 15)OPERATION(0xBF, CBBF, A, "", "RES 7,A", UOP2, RES_7_A, 0, 8)OPERATION(0xC0, CBC0, A, "", "SET 0,B", UOP2, SET_0_B, 0, 8)OPERATION(0xC1, CBC1, A, "", "SET 0,C", UOP2, SET_0_C, 0, 8)OPERATION(0xC2, CBC2, A, "", "SET 0,D", UOP2, SET_0_D, 0, 8)OPERATION(0xC3, CBC3, A, "", "SET 0,E", UOP2, SET_0_E, 0, 8)OPERATION(0xC4, CBC4, A, "", "SET 0,H", UOP2, SET_0_H, 0, 8)OPERATION(0xC5, CBC5, A, "", "SET 0,L", UOP2, SET_0_L, 0, 8)OPERATION(0xC6, CBC6, A, "", "SET 0,(HL)", UOP2, SET_0_iHL, 0, 15)OPERATION(0xC7, CBC7, A, "", "SET 0,A", UOP2, SET_0_A, 0, 8)OPERATION(0xC8, CBC8, A, "", "SET 1,B", UOP2, SET_1_B, 0, 8)OPERATION(0xC9, CBC9, A, "", "SET 1,C", UOP2, SET_1_C, 0, 8)OPERATION(0xCA, CBCA, A, "", "SET 1,D", UOP2, SET_1_D, 0, 8)OPERATION(0xCB, CBCB, A, "", "SET 1,E", UOP2, SET_1_E, 0, 8)OPERATION(0xCC, CBCC, A, "", "SET 1,H", UOP2, SET_1_H, 0, 8)OPERATION(0xCD, CBCD, A, "", "SET 1,L", UOP2, SET_1_L, 0, 8)OPERATION(0xCE, CBCE, A, "", "SET 1,(HL)", UOP2, SET_1_iHL, 0, 15)OPERATION(0xCF, CBCF, A, "", "SET 1,A", UOP2, SET_1_A, 0, 8)OPERATION(0xD0, CBD0, A, "", "SET 2,B", UOP2, SET_2_B, 0, 8)OPERATION(0xD1, CBD1, A, "", "SET 2,C", UOP2, SET_2_C, 0, 8)OPERATION(0xD2, CBD2, A, "", "SET 2,D", UOP2, SET_2_D, 0, 8)OPERATION(0xD3, CBD3, A, "", "SET 2,E", UOP2, SET_2_E, 0, 8)OPERATION(0xD4, CBD4, A, "", "SET 2,H", UOP2, SET_2_H, 0, 8)OPERATION(0xD5, CBD5, A, "", "SET 2,L", UOP2, SET_2_L, 0, 8)OPERATION(0xD6, CBD6, A, "", "SET 2,(HL)", UOP2, SET_2_iHL, 0, 15)OPERATION(0xD7, CBD7, A, "", "SET 2,A", UOP2, SET_2_A, 0, 8)OPERATION(0xD8, CBD8, A, "", "SET 3,B", UOP2, SET_3_B, 0, 8)OPERATION(0xD9, CBD9, A, "", "SET 3,C", UOP2, SET_3_C, 0, 8)OPERATION(0xDA, CBDA, A, "", "SET 3,D", UOP2, SET_3_D, 0, 8)OPERATION(0xDB, CBDB, A, "", "SET 3,E", UOP2, SET_3_E, 0, 8)OPERATION(0xDC, CBDC, A, "", "SET 3,H", UOP2, SET_3_H, 0, 8)OPERATION(0xDD, CBDD, A, "", "SET 3,L", UOP2, SET_3_L, 0, 8)OPERATION(0xDE, CBDE, A, "", "SET 3,(HL)", UOP2, SET_3_iHL, 0, 15)OPERATION(0xDF, CBDF, A, "", "SET 3,A", UOP2, SET_3_A, 0, 8)OPERATION(0xE0, CBE0, A, "", "SET 4,B", UOP2, SET_4_B, 0, 8)OPERATION(0xE1, CBE1, A, "", "SET 4,C", UOP2, SET_4_C, 0, 8)OPERATION(0xE2, CBE2, A, "", "SET 4,D", UOP2, SET_4_D, 0, 8)OPERATION(0xE3, CBE3, A, "", "SET 4,E", UOP2, SET_4_E, 0, 8)OPERATION(0xE4, CBE4, A, "", "SET 4,H", UOP2, SET_4_H, 0, 8)OPERATION(0xE5, CBE5, A, "", "SET 4,L", UOP2, SET_4_L, 0, 8)OPERATION(0xE6, CBE6, A, "", "SET 4,(HL)", UOP2, SET_4_iHL, 0, 15)OPERATION(0xE7, CBE7, A, "", "SET 4,A", UOP2, SET_4_A, 0, 8)OPERATION(0xE8, CBE8, A, "", "SET 5,B", UOP2, SET_5_B, 0, 8)OPERATION(0xE9, CBE9, A, "", "SET 5,C", UOP2, SET_5_C, 0, 8)OPERATION(0xEA, CBEA, A, "", "SET 5,D", UOP2, SET_5_D, 0, 8)OPERATION(0xEB, CBEB, A, "", "SET 5,E", UOP2, SET_5_E, 0, 8)OPERATION(0xEC, CBEC, A, "", "SET 5,H", UOP2, SET_5_H, 0, 8)OPERATION(0xED, CBED, A, "", "SET 5,L", UOP2, SET_5_L, 0, 8)OPERATION(0xEE, CBEE, A, "", "SET 5,(HL)", UOP2, SET_5_iHL, 0, 15)OPERATION(0xEF, CBEF, A, "", "SET 5,A", UOP2, SET_5_A, 0, 8)OPERATION(0xF0, CBF0, A, "", "SET 6,B", UOP2, SET_6_B, 0, 8)OPERATION(0xF1, CBF1, A, "", "SET 6,C", UOP2, SET_6_C, 0, 8)OPERATION(0xF2, CBF2, A, "", "SET 6,D", UOP2, SET_6_D, 0, 8)OPERATION(0xF3, CBF3, A, "", "SET 6,E", UOP2, SET_6_E, 0, 8)OPERATION(0xF4, CBF4, A, "", "SET 6,H", UOP2, SET_6_H, 0, 8)OPERATION(0xF5, CBF5, A, "", "SET 6,L", UOP2, SET_6_L, 0, 8)OPERATION(0xF6, CBF6, A, "", "SET 6,(HL)", UOP2, SET_6_iHL, 0, 15)OPERATION(0xF7, CBF7, A, "", "SET 6,A", UOP2, SET_6_A, 0, 8)OPERATION(0xF8, CBF8, A, "", "SET 7,B", UOP2, SET_7_B, 0, 8)OPERATION(0xF9, CBF9, A, "", "SET 7,C", UOP2, SET_7_C, 0, 8)OPERATION(0xFA, CBFA, A, "", "SET 7,D", UOP2, SET_7_D, 0, 8)OPERATION(0xFB, CBFB, A, "", "SET 7,E", UOP2, SET_7_E, 0, 8)OPERATION(0xFC, CBFC, A, "", "SET 7,H", UOP2, SET_7_H, 0, 8)OPERATION(0xFD, CBFD, A, "", "SET 7,L", UOP2, SET_7_L, 0, 8)OPERATION(0xFE, CBFE, A, "", "SET 7,(HL)", UOP2, SET_7_iHL, 0, 15)OPERATION(0xFF, CBFF, A, "", "SET 7,A", UOP2, SET_7_A, 0, 8)
\ No newline at end of file
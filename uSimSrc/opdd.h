@@ -1 +1 @@
-/* uSim opdd.h * Copyright (C) 2000, Tsurishaddai Williamson, tsuri@earthlink.net *  * This program is free software; you can redistribute it and/or * modify it under the terms of the GNU General Public License * as published by the Free Software Foundation; either version 2 * of the License, or (at your option) any later version. *  * This program is distributed in the hope that it will be useful, * but WITHOUT ANY WARRANTY; without even the implied warranty of * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the * GNU General Public License for more details. *  * You should have received a copy of the GNU General Public License * along with this program; if not, write to the Free Software * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA. *//**********************************************************************/OPERATION(0x00, DD00, A, "", "", UOP2, UOP2)OPERATION(0x01, DD01, A, "", "", UOP2, UOP2)OPERATION(0x02, DD02, A, "", "", UOP2, UOP2)OPERATION(0x03, DD03, A, "", "", UOP2, UOP2)OPERATION(0x04, DD04, A, "", "", UOP2, UOP2)OPERATION(0x05, DD05, A, "", "", UOP2, UOP2)OPERATION(0x06, DD06, A, "", "", UOP2, UOP2)OPERATION(0x07, DD07, A, "", "", UOP2, UOP2)OPERATION(0x08, DD08, A, "", "", UOP2, UOP2)OPERATION(0x09, DD09, A, "", "ADD IX,BC", UOP2, ADD_IX_BC)OPERATION(0x0A, DD0A, A, "", "", UOP2, UOP2)OPERATION(0x0B, DD0B, A, "", "", UOP2, UOP2)OPERATION(0x0C, DD0C, A, "", "", UOP2, UOP2)OPERATION(0x0D, DD0D, A, "", "", UOP2, UOP2)OPERATION(0x0E, DD0E, A, "", "", UOP2, UOP2)OPERATION(0x0F, DD0F, A, "", "", UOP2, UOP2)OPERATION(0x10, DD10, A, "", "", UOP2, UOP2)OPERATION(0x11, DD11, A, "", "", UOP2, UOP2)OPERATION(0x12, DD12, A, "", "", UOP2, UOP2)OPERATION(0x13, DD13, A, "", "", UOP2, UOP2)OPERATION(0x14, DD14, A, "", "", UOP2, UOP2)OPERATION(0x15, DD15, A, "", "", UOP2, UOP2)OPERATION(0x16, DD16, A, "", "", UOP2, UOP2)OPERATION(0x17, DD17, A, "", "", UOP2, UOP2)OPERATION(0x18, DD18, A, "", "", UOP2, UOP2)OPERATION(0x19, DD19, A, "", "ADD IX,DE", UOP2, ADD_IX_DE)OPERATION(0x1A, DD1A, A, "", "", UOP2, UOP2)OPERATION(0x1B, DD1B, A, "", "", UOP2, UOP2)OPERATION(0x1C, DD1C, A, "", "", UOP2, UOP2)OPERATION(0x1D, DD1D, A, "", "", UOP2, UOP2)OPERATION(0x1E, DD1E, A, "", "", UOP2, UOP2)OPERATION(0x1F, DD1F, A, "", "", UOP2, UOP2)OPERATION(0x20, DD20, A, "", "", UOP2, UOP2)OPERATION(0x21, DD21NNNN, F, "", "LD IX,%4", UOP2, LD_IX_NNNN)OPERATION(0x22, DD22NNNN, F, "", "LD (%4),IX", UOP2, LD_iNNNN_IX)OPERATION(0x23, DD23, A, "", "INC IX", UOP2, INC_IX)OPERATION(0x24, DD24, A, "", "INC IXH", UOP2, INC_IXH)OPERATION(0x25, DD25, A, "", "DEC IXH", UOP2, DEC_IXH)OPERATION(0x26, DD26NN, A, "", "LD IXH,%6", UOP2, LD_IXH_NN)OPERATION(0x27, DD27, A, "", "", UOP2, UOP2)OPERATION(0x28, DD28, A, "", "", UOP2, UOP2)OPERATION(0x29, DD29, A, "", "ADD IX,IX", UOP2, ADD_IX_IX)OPERATION(0x2A, DD2ANNNN, F, "", "LD IX,(%4)", UOP2, LD_IX_iNNNN)OPERATION(0x2B, DD2B, A, "", "DEC IX", UOP2, DEC_IX)OPERATION(0x2C, DD2C, A, "", "INC IXL", UOP2, INC_IXL)OPERATION(0x2D, DD2D, A, "", "DEC IXL", UOP2, DEC_IXL)OPERATION(0x2E, DD2ENN, A, "", "LD IXL,%6", UOP2, LD_IXL_NN)OPERATION(0x2F, DD2F, A, "", "", UOP2, UOP2)OPERATION(0x30, DD30, A, "", "", UOP2, UOP2)OPERATION(0x31, DD31, A, "", "", UOP2, UOP2)OPERATION(0x32, DD32, A, "", "", UOP2, UOP2)OPERATION(0x33, DD33, A, "", "", UOP2, UOP2)OPERATION(0x34, DD34NN, A, "", "INC (IX+%6)", UOP2, INC_iIX_NN)OPERATION(0x35, DD35NN, A, "", "DEC (IX+%6)", UOP2, DEC_iIX_NN)OPERATION(0x36, DD36NNNN, A, "", "LD (IX+%6),%7", UOP2, LD_iIX_NN_NN)OPERATION(0x37, DD37, A, "", "", UOP2, UOP2)OPERATION(0x38, DD38, A, "", "", UOP2, UOP2)OPERATION(0x39, DD39, A, "", "ADD IX,SP", UOP2, ADD_IX_SP)OPERATION(0x3A, DD3A, A, "", "", UOP2, UOP2)OPERATION(0x3B, DD3B, A, "", "", UOP2, UOP2)OPERATION(0x3C, DD3C, A, "", "", UOP2, UOP2)OPERATION(0x3D, DD3D, A, "", "", UOP2, UOP2)OPERATION(0x3E, DD3E, A, "", "", UOP2, UOP2)OPERATION(0x3F, DD3F, A, "", "", UOP2, UOP2)OPERATION(0x40, DD40, A, "", "", UOP2, UOP2)OPERATION(0x41, DD41, A, "", "", UOP2, UOP2)OPERATION(0x42, DD42, A, "", "", UOP2, UOP2)OPERATION(0x43, DD43, A, "", "", UOP2, UOP2)OPERATION(0x44, DD44, A, "", "LD B,IXH", UOP2, LD_B_IXH)OPERATION(0x45, DD45, A, "", "LD B,IXL", UOP2, LD_B_IXL)OPERATION(0x46, DD46NN, A, "", "LD B,(IX+%6)", UOP2, LD_B_iIX_NN)OPERATION(0x47, DD47, A, "", "", UOP2, UOP2)OPERATION(0x48, DD48, A, "", "", UOP2, UOP2)OPERATION(0x49, DD49, A, "", "", UOP2, UOP2)OPERATION(0x4A, DD4A, A, "", "", UOP2, UOP2)OPERATION(0x4B, DD4B, A, "", "", UOP2, UOP2)OPERATION(0x4C, DD4C, A, "", "LD C,IXH", UOP2, LD_C_IXH)OPERATION(0x4D, DD4D, A, "", "LD C,IXL", UOP2, LD_C_IXL)OPERATION(0x4E, DD4ENN, A, "", "LD C,(IX+%6)", UOP2, LD_C_iIX_NN)OPERATION(0x4F, DD4F, A, "", "", UOP2, UOP2)OPERATION(0x50, DD50, A, "", "", UOP2, UOP2)OPERATION(0x51, DD51, A, "", "", UOP2, UOP2)OPERATION(0x52, DD52, A, "", "", UOP2, UOP2)OPERATION(0x53, DD53, A, "", "", UOP2, UOP2)OPERATION(0x54, DD54, A, "", "LD D,IXH", UOP2, LD_D_IXH)OPERATION(0x55, DD55, A, "", "LD D,IXL", UOP2, LD_D_IXL)OPERATION(0x56, DD56NN, A, "", "LD D,(IX+%6)", UOP2, LD_D_iIX_NN)OPERATION(0x57, DD57, A, "", "", UOP2, UOP2)OPERATION(0x58, DD58, A, "", "", UOP2, UOP2)OPERATION(0x59, DD59, A, "", "", UOP2, UOP2)OPERATION(0x5A, DD5A, A, "", "", UOP2, UOP2)OPERATION(0x5B, DD5B, A, "", "", UOP2, UOP2)OPERATION(0x5C, DD5C, A, "", "LD E,IXH", UOP2, LD_E_IXH)OPERATION(0x5D, DD5D, A, "", "LD E,IXL", UOP2, LD_E_IXL)OPERATION(0x5E, DD5ENN, A, "", "LD E,(IX+%6)", UOP2, LD_E_iIX_NN)OPERATION(0x5F, DD5F, A, "", "", UOP2, UOP2)OPERATION(0x60, DD60, A, "", "LD IXH,B", UOP2, LD_IXH_B)OPERATION(0x61, DD61, A, "", "LD IXH,C", UOP2, LD_IXH_C)OPERATION(0x62, DD62, A, "", "LD IXH,D", UOP2, LD_IXH_D)OPERATION(0x63, DD63, A, "", "LD IXH,E", UOP2, LD_IXH_E)OPERATION(0x64, DD64, A, "", "LD IXH,IXH", UOP2, LD_IXH_IXH)OPERATION(0x65, DD65, A, "", "LD IXH,IXL", UOP2, LD_IXH_IXL)OPERATION(0x66, DD66NN, A, "", "LD H,(IX+%6)", UOP2, LD_H_iIX_NN)OPERATION(0x67, DD67, A, "", "LD IXH,A", UOP2, LD_IXH_A)OPERATION(0x68, DD68, A, "", "LD IXL,B", UOP2, LD_IXL_B)OPERATION(0x69, DD69, A, "", "LD IXL,C", UOP2, LD_IXL_C)OPERATION(0x6A, DD6A, A, "", "LD IXL,D", UOP2, LD_IXL_D)OPERATION(0x6B, DD6B, A, "", "LD IXL,E", UOP2, LD_IXL_E)OPERATION(0x6C, DD6C, A, "", "LD IXL,IXH", UOP2, LD_IXL_IXH)OPERATION(0x6D, DD6D, A, "", "LD IXL,IXL", UOP2, LD_IXL_IXL)OPERATION(0x6E, DD6ENN, A, "", "LD L,(IX+%6)", UOP2, LD_L_iIX_NN)OPERATION(0x6F, DD6F, A, "", "LD IXL,A", UOP2, LD_IXL_A)OPERATION(0x70, DD70NN, A, "", "LD (IX+%6),B", UOP2, LD_iIX_NN_B)OPERATION(0x71, DD71NN, A, "", "LD (IX+%6),C", UOP2, LD_iIX_NN_C)OPERATION(0x72, DD72NN, A, "", "LD (IX+%6),D", UOP2, LD_iIX_NN_D)OPERATION(0x73, DD73NN, A, "", "LD (IX+%6),E", UOP2, LD_iIX_NN_E)OPERATION(0x74, DD74NN, A, "", "LD (IX+%6),H", UOP2, LD_iIX_NN_H)OPERATION(0x75, DD75NN, A, "", "LD (IX+%6),L", UOP2, LD_iIX_NN_L)OPERATION(0x76, DD76, A, "", "", UOP2, UOP2)OPERATION(0x77, DD77NN, A, "", "LD (IX+%6),A", UOP2, LD_iIX_NN_A)OPERATION(0x78, DD78, A, "", "", UOP2, UOP2)OPERATION(0x79, DD79, A, "", "", UOP2, UOP2)OPERATION(0x7A, DD7A, A, "", "", UOP2, UOP2)OPERATION(0x7B, DD7B, A, "", "", UOP2, UOP2)OPERATION(0x7C, DD7C, A, "", "LD A,IXH", UOP2, LD_A_IXH)OPERATION(0x7D, DD7D, A, "", "LD A,IXL", UOP2, LD_A_IXL)OPERATION(0x7E, DD7ENN, A, "", "LD A,(IX+%6)", UOP2, LD_A_iIX_NN)OPERATION(0x7F, DD7F, A, "", "", UOP2, UOP2)OPERATION(0x80, DD80, A, "", "", UOP2, UOP2)OPERATION(0x81, DD81, A, "", "", UOP2, UOP2)OPERATION(0x82, DD82, A, "", "", UOP2, UOP2)OPERATION(0x83, DD83, A, "", "", UOP2, UOP2)OPERATION(0x84, DD84, A, "", "ADD A,IXH", UOP2, ADD_IXH)OPERATION(0x85, DD85, A, "", "ADD A,IXL", UOP2, ADD_IXL)OPERATION(0x86, DD86NN, A, "", "ADD A,(IX+%6)", UOP2, ADD_iIX_NN)OPERATION(0x87, DD87, A, "", "", UOP2, UOP2)OPERATION(0x88, DD88, A, "", "", UOP2, UOP2)OPERATION(0x89, DD89, A, "", "", UOP2, UOP2)OPERATION(0x8A, DD8A, A, "", "", UOP2, UOP2)OPERATION(0x8B, DD8B, A, "", "", UOP2, UOP2)OPERATION(0x8C, DD8C, A, "", "ADC A,IXH", UOP2, ADC_IXH)OPERATION(0x8D, DD8D, A, "", "ADC A,IXL", UOP2, ADC_IXL)OPERATION(0x8E, DD8ENN, A, "", "ADC A,(IX+%6)", UOP2, ADC_iIX_NN)OPERATION(0x8F, DD8F, A, "", "", UOP2, UOP2)OPERATION(0x90, DD90, A, "", "", UOP2, UOP2)OPERATION(0x91, DD91, A, "", "", UOP2, UOP2)OPERATION(0x92, DD92, A, "", "", UOP2, UOP2)OPERATION(0x93, DD93, A, "", "", UOP2, UOP2)OPERATION(0x94, DD94, A, "", "SUB IXH", UOP2, SUB_IXH)OPERATION(0x95, DD95, A, "", "SUB IXL", UOP2, SUB_IXL)OPERATION(0x96, DD96NN, A, "", "SUB A,(IX+%6)", UOP2, SUB_iIX_NN)OPERATION(0x97, DD97, A, "", "", UOP2, UOP2)OPERATION(0x98, DD98, A, "", "", UOP2, UOP2)OPERATION(0x99, DD99, A, "", "", UOP2, UOP2)OPERATION(0x9A, DD9A, A, "", "", UOP2, UOP2)OPERATION(0x9B, DD9B, A, "", "", UOP2, UOP2)OPERATION(0x9C, DD9C, A, "", "SBC IXH", UOP2, SBC_IXH)OPERATION(0x9D, DD9D, A, "", "SBC IXL", UOP2, SBC_IXL)OPERATION(0x9E, DD9ENN, A, "", "SBC A,(IX+%6)", UOP2, SBC_iIX_NN)OPERATION(0x9F, DD9F, A, "", "", UOP2, UOP2)OPERATION(0xA0, DDA0, A, "", "", UOP2, UOP2)OPERATION(0xA1, DDA1, A, "", "", UOP2, UOP2)OPERATION(0xA2, DDA2, A, "", "", UOP2, UOP2)OPERATION(0xA3, DDA3, A, "", "", UOP2, UOP2)OPERATION(0xA4, DDA4, A, "", "AND IXH", UOP2, AND_IXH)OPERATION(0xA5, DDA5, A, "", "AND IXL", UOP2, AND_IXL)OPERATION(0xA6, DDA6NN, A, "", "AND (IX+%6)", UOP2, AND_iIX_NN)OPERATION(0xA7, DDA7, A, "", "", UOP2, UOP2)OPERATION(0xA8, DDA8, A, "", "", UOP2, UOP2)OPERATION(0xA9, DDA9, A, "", "", UOP2, UOP2)OPERATION(0xAA, DDAA, A, "", "", UOP2, UOP2)OPERATION(0xAB, DDAB, A, "", "", UOP2, UOP2)OPERATION(0xAC, DDAC, A, "", "XOR IXH", UOP2, XOR_IXH)OPERATION(0xAD, DDAD, A, "", "XOR IXL", UOP2, XOR_IXL)OPERATION(0xAE, DDAENN, A, "", "XOR (IX+%6)", UOP2, XOR_iIX_NN)OPERATION(0xAF, DDAF, A, "", "", UOP2, UOP2)OPERATION(0xB0, DDB0, A, "", "", UOP2, UOP2)OPERATION(0xB1, DDB1, A, "", "", UOP2, UOP2)OPERATION(0xB2, DDB2, A, "", "", UOP2, UOP2)OPERATION(0xB3, DDB3, A, "", "", UOP2, UOP2)OPERATION(0xB4, DDB4, A, "", "OR IXH", UOP2, OR_IXH)OPERATION(0xB5, DDB5, A, "", "OR IXL", UOP2, OR_IXL)OPERATION(0xB6, DDB6NN, A, "", "OR (IX+%6)", UOP2, OR_iIX_NN)OPERATION(0xB7, DDB7, A, "", "", UOP2, UOP2)OPERATION(0xB8, DDB8, A, "", "", UOP2, UOP2)OPERATION(0xB9, DDB9, A, "", "", UOP2, UOP2)OPERATION(0xBA, DDBA, A, "", "", UOP2, UOP2)OPERATION(0xBB, DDBB, A, "", "", UOP2, UOP2)OPERATION(0xBC, DDBC, A, "", "CP IXH", UOP2, CP_IXH)OPERATION(0xBD, DDBD, A, "", "CP IXL", UOP2, CP_IXL)OPERATION(0xBE, DDBENN, A, "", "CP (IX+%6)", UOP2, CP_iIX_NN)OPERATION(0xBF, DDBF, A, "", "", UOP2, UOP2)OPERATION(0xC0, DDC0, A, "", "", UOP2, UOP2)OPERATION(0xC1, DDC1, A, "", "", UOP2, UOP2)OPERATION(0xC2, DDC2, A, "", "", UOP2, UOP2)OPERATION(0xC3, DDC3, A, "", "", UOP2, UOP2)OPERATION(0xC4, DDC4, A, "", "", UOP2, UOP2)OPERATION(0xC5, DDC5, A, "", "", UOP2, UOP2)OPERATION(0xC6, DDC6, A, "", "", UOP2, UOP2)OPERATION(0xC7, DDC7, A, "", "", UOP2, UOP2)OPERATION(0xC8, DDC8, A, "", "", UOP2, UOP2)OPERATION(0xC9, DDC9, A, "", "", UOP2, UOP2)OPERATION(0xCA, DDCA, A, "", "", UOP2, UOP2)OPERATION(0xCB, DDCB, A, "", "", 0, DDCB_OP)OPERATION(0xCC, DDCC, A, "", "", UOP2, UOP2)OPERATION(0xCD, DDCD, A, "", "", UOP2, UOP2)OPERATION(0xCE, DDCE, A, "", "", UOP2, UOP2)OPERATION(0xCF, DDCF, A, "", "", UOP2, UOP2)OPERATION(0xD0, DDD0, A, "", "", UOP2, UOP2)OPERATION(0xD1, DDD1, A, "", "", UOP2, UOP2)OPERATION(0xD2, DDD2, A, "", "", UOP2, UOP2)OPERATION(0xD3, DDD3, A, "", "", UOP2, UOP2)OPERATION(0xD4, DDD4, A, "", "", UOP2, UOP2)OPERATION(0xD5, DDD5, A, "", "", UOP2, UOP2)OPERATION(0xD6, DDD6, A, "", "", UOP2, UOP2)OPERATION(0xD7, DDD7, A, "", "", UOP2, UOP2)OPERATION(0xD8, DDD8, A, "", "", UOP2, UOP2)OPERATION(0xD9, DDD9, A, "", "", UOP2, UOP2)OPERATION(0xDA, DDDA, A, "", "", UOP2, UOP2)OPERATION(0xDB, DDDB, A, "", "", UOP2, UOP2)OPERATION(0xDC, DDDC, A, "", "", UOP2, UOP2)OPERATION(0xDD, DDDD, A, "", "", UOP2, UOP2)OPERATION(0xDE, DDDE, A, "", "", UOP2, UOP2)OPERATION(0xDF, DDDF, A, "", "", UOP2, UOP2)OPERATION(0xE0, DDE0, A, "", "", UOP2, UOP2)OPERATION(0xE1, DDE1, A, "", "POP IX", UOP2, POP_IX)OPERATION(0xE2, DDE2, A, "", "", UOP2, UOP2)OPERATION(0xE3, DDE3, A, "", "EX (SP),IX", UOP2, EX_iSP_IX)OPERATION(0xE4, DDE4, A, "", "", UOP2, UOP2)OPERATION(0xE5, DDE5, A, "", "PUSH IX", UOP2, PUSH_IX)OPERATION(0xE6, DDE6, A, "", "", UOP2, UOP2)OPERATION(0xE7, DDE7, A, "", "", UOP2, UOP2)OPERATION(0xE8, DDE8, A, "", "", UOP2, UOP2)OPERATION(0xE9, DDE9, B, "", "JP (IX)", UOP2, JP_iIX)OPERATION(0xEA, DDEA, A, "", "", UOP2, UOP2)OPERATION(0xEB, DDEB, A, "", "", UOP2, UOP2)OPERATION(0xEC, DDEC, A, "", "", UOP2, UOP2)OPERATION(0xED, DDED, A, "", "", UOP2, UOP2)OPERATION(0xEE, DDEE, A, "", "", UOP2, UOP2)OPERATION(0xEF, DDEF, A, "", "", UOP2, UOP2)OPERATION(0xF0, DDF0, A, "", "", UOP2, UOP2)OPERATION(0xF1, DDF1, A, "", "", UOP2, UOP2)OPERATION(0xF2, DDF2, A, "", "", UOP2, UOP2)OPERATION(0xF3, DDF3, A, "", "", UOP2, UOP2)OPERATION(0xF4, DDF4, A, "", "", UOP2, UOP2)OPERATION(0xF5, DDF5, A, "", "", UOP2, UOP2)OPERATION(0xF6, DDF6, A, "", "", UOP2, UOP2)OPERATION(0xF7, DDF7, A, "", "", UOP2, UOP2)OPERATION(0xF8, DDF8, A, "", "", UOP2, UOP2)OPERATION(0xF9, DDF9, A, "", "LD SP,IX", UOP2, LD_SP_IX)OPERATION(0xFA, DDFA, A, "", "", UOP2, UOP2)OPERATION(0xFB, DDFB, A, "", "", UOP2, UOP2)OPERATION(0xFC, DDFC, A, "", "", UOP2, UOP2)OPERATION(0xFD, DDFD, A, "", "", UOP2, UOP2)OPERATION(0xFE, DDFE, A, "", "", UOP2, UOP2)OPERATION(0xFF, DDFF, A, "", "", UOP2, UOP2)
\ No newline at end of file
+/* uSim opdd.h * Copyright (C) 2000, Tsurishaddai Williamson, tsuri@earthlink.net *  * This program is free software; you can redistribute it and/or * modify it under the terms of the GNU General Public License * as published by the Free Software Foundation; either version 2 * of the License, or (at your option) any later version. *  * This program is distributed in the hope that it will be useful, * but WITHOUT ANY WARRANTY; without even the implied warranty of * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the * GNU General Public License for more details. *  * You should have received a copy of the GNU General Public License * along with this program; if not, write to the Free Software * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA. *//**********************************************************************/OPERATION(0x00, DD00, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x01, DD01, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x02, DD02, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x03, DD03, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x04, DD04, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x05, DD05, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x06, DD06, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x07, DD07, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x08, DD08, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x09, DD09, A, "", "ADD IX,BC", UOP2, ADD_XY_BC, 0, 15)OPERATION(0x0A, DD0A, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x0B, DD0B, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x0C, DD0C, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x0D, DD0D, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x0E, DD0E, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x0F, DD0F, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x10, DD10, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x11, DD11, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x12, DD12, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x13, DD13, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x14, DD14, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x15, DD15, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x16, DD16, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x17, DD17, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x18, DD18, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x19, DD19, A, "", "ADD IX,DE", UOP2, ADD_XY_DE, 0, 15)OPERATION(0x1A, DD1A, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x1B, DD1B, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x1C, DD1C, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x1D, DD1D, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x1E, DD1E, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x1F, DD1F, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x20, DD20, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x21, DD21NNNN, F, "", "LD IX,%4", UOP2, LD_XY_NNNN, 0, 14)OPERATION(0x22, DD22NNNN, F, "", "LD (%4),IX", UOP2, LD_iNNNN_XY, 0, 20)OPERATION(0x23, DD23, A, "", "INC IX", UOP2, INC_XY, 0, 10)OPERATION(0x24, DD24, A, "", "INC IXH", UOP2, INC_XYH, 0, 8)OPERATION(0x25, DD25, A, "", "DEC IXH", UOP2, DEC_XYH, 0, 8)OPERATION(0x26, DD26NN, A, "", "LD IXH,%6", UOP2, LD_XYH_NN, 0, 11)OPERATION(0x27, DD27, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x28, DD28, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x29, DD29, A, "", "ADD IX,IX", UOP2, ADD_XY_XY, 0, 15)OPERATION(0x2A, DD2ANNNN, F, "", "LD IX,(%4)", UOP2, LD_XY_iNNNN, 0, 20)OPERATION(0x2B, DD2B, A, "", "DEC IX", UOP2, DEC_XY, 0, 10)OPERATION(0x2C, DD2C, A, "", "INC IXL", UOP2, INC_XYL, 0, 8)OPERATION(0x2D, DD2D, A, "", "DEC IXL", UOP2, DEC_XYL, 0, 8)OPERATION(0x2E, DD2ENN, A, "", "LD IXL,%6", UOP2, LD_XYL_NN, 0, 11)OPERATION(0x2F, DD2F, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x30, DD30, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x31, DD31, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x32, DD32, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x33, DD33, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x34, DD34NN, A, "", "INC (IX+%6)", UOP2, INC_iXY_NN, 0, 23)OPERATION(0x35, DD35NN, A, "", "DEC (IX+%6)", UOP2, DEC_iXY_NN, 0, 23)OPERATION(0x36, DD36NNNN, A, "", "LD (IX+%6),%7", UOP2, LD_iXY_NN_NN, 0, 19)OPERATION(0x37, DD37, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x38, DD38, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x39, DD39, A, "", "ADD IX,SP", UOP2, ADD_XY_SP, 0, 15)OPERATION(0x3A, DD3A, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x3B, DD3B, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x3C, DD3C, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x3D, DD3D, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x3E, DD3E, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x3F, DD3F, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x40, DD40, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x41, DD41, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x42, DD42, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x43, DD43, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x44, DD44, A, "", "LD B,IXH", UOP2, LD_B_XYH, 0, 8)OPERATION(0x45, DD45, A, "", "LD B,IXL", UOP2, LD_B_XYL, 0, 8)OPERATION(0x46, DD46NN, A, "", "LD B,(IX+%6)", UOP2, LD_B_iXY_NN, 0, 19)OPERATION(0x47, DD47, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x48, DD48, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x49, DD49, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x4A, DD4A, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x4B, DD4B, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x4C, DD4C, A, "", "LD C,IXH", UOP2, LD_C_XYH, 0, 8)OPERATION(0x4D, DD4D, A, "", "LD C,IXL", UOP2, LD_C_XYL, 0, 8)OPERATION(0x4E, DD4ENN, A, "", "LD C,(IX+%6)", UOP2, LD_C_iXY_NN, 0, 19)OPERATION(0x4F, DD4F, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x50, DD50, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x51, DD51, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x52, DD52, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x53, DD53, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x54, DD54, A, "", "LD D,IXH", UOP2, LD_D_XYH, 0, 8)OPERATION(0x55, DD55, A, "", "LD D,IXL", UOP2, LD_D_XYL, 0, 8)OPERATION(0x56, DD56NN, A, "", "LD D,(IX+%6)", UOP2, LD_D_iXY_NN, 0, 19)OPERATION(0x57, DD57, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x58, DD58, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x59, DD59, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x5A, DD5A, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x5B, DD5B, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x5C, DD5C, A, "", "LD E,IXH", UOP2, LD_E_XYH, 0, 8)OPERATION(0x5D, DD5D, A, "", "LD E,IXL", UOP2, LD_E_XYL, 0, 8)OPERATION(0x5E, DD5ENN, A, "", "LD E,(IX+%6)", UOP2, LD_E_iXY_NN, 0, 19)OPERATION(0x5F, DD5F, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x60, DD60, A, "", "LD IXH,B", UOP2, LD_XYH_B, 0, 8)OPERATION(0x61, DD61, A, "", "LD IXH,C", UOP2, LD_XYH_C, 0, 8)OPERATION(0x62, DD62, A, "", "LD IXH,D", UOP2, LD_XYH_D, 0, 8)OPERATION(0x63, DD63, A, "", "LD IXH,E", UOP2, LD_XYH_E, 0, 8)OPERATION(0x64, DD64, A, "", "LD IXH,IXH", UOP2, LD_XYH_XYH, 0, 8)OPERATION(0x65, DD65, A, "", "LD IXH,IXL", UOP2, LD_XYH_XYL, 0, 8)OPERATION(0x66, DD66NN, A, "", "LD H,(IX+%6)", UOP2, LD_H_iXY_NN, 0, 19)OPERATION(0x67, DD67, A, "", "LD IXH,A", UOP2, LD_XYH_A, 0, 8)OPERATION(0x68, DD68, A, "", "LD IXL,B", UOP2, LD_XYL_B, 0, 8)OPERATION(0x69, DD69, A, "", "LD IXL,C", UOP2, LD_XYL_C, 0, 8)OPERATION(0x6A, DD6A, A, "", "LD IXL,D", UOP2, LD_XYL_D, 0, 8)OPERATION(0x6B, DD6B, A, "", "LD IXL,E", UOP2, LD_XYL_E, 0, 8)OPERATION(0x6C, DD6C, A, "", "LD IXL,IXH", UOP2, LD_XYL_XYH, 0, 8)OPERATION(0x6D, DD6D, A, "", "LD IXL,IXL", UOP2, LD_XYL_XYL, 0, 8)OPERATION(0x6E, DD6ENN, A, "", "LD L,(IX+%6)", UOP2, LD_L_iXY_NN, 0, 19)OPERATION(0x6F, DD6F, A, "", "LD IXL,A", UOP2, LD_XYL_A, 0, 8)OPERATION(0x70, DD70NN, A, "", "LD (IX+%6),B", UOP2, LD_iXY_NN_B, 0, 19)OPERATION(0x71, DD71NN, A, "", "LD (IX+%6),C", UOP2, LD_iXY_NN_C, 0, 19)OPERATION(0x72, DD72NN, A, "", "LD (IX+%6),D", UOP2, LD_iXY_NN_D, 0, 19)OPERATION(0x73, DD73NN, A, "", "LD (IX+%6),E", UOP2, LD_iXY_NN_E, 0, 19)OPERATION(0x74, DD74NN, A, "", "LD (IX+%6),H", UOP2, LD_iXY_NN_H, 0, 19)OPERATION(0x75, DD75NN, A, "", "LD (IX+%6),L", UOP2, LD_iXY_NN_L, 0, 19)OPERATION(0x76, DD76, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x77, DD77NN, A, "", "LD (IX+%6),A", UOP2, LD_iXY_NN_A, 0, 19)OPERATION(0x78, DD78, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x79, DD79, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x7A, DD7A, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x7B, DD7B, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x7C, DD7C, A, "", "LD A,IXH", UOP2, LD_A_XYH, 0, 8)OPERATION(0x7D, DD7D, A, "", "LD A,IXL", UOP2, LD_A_XYL, 0, 8)OPERATION(0x7E, DD7ENN, A, "", "LD A,(IX+%6)", UOP2, LD_A_iXY_NN, 0, 19)OPERATION(0x7F, DD7F, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x80, DD80, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x81, DD81, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x82, DD82, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x83, DD83, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x84, DD84, A, "", "ADD A,IXH", UOP2, ADD_XYH, 0, 8)OPERATION(0x85, DD85, A, "", "ADD A,IXL", UOP2, ADD_XYL, 0, 8)OPERATION(0x86, DD86NN, A, "", "ADD A,(IX+%6)", UOP2, ADD_iXY_NN, 0, 19)OPERATION(0x87, DD87, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x88, DD88, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x89, DD89, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x8A, DD8A, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x8B, DD8B, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x8C, DD8C, A, "", "ADC A,IXH", UOP2, ADC_XYH, 0, 8)OPERATION(0x8D, DD8D, A, "", "ADC A,IXL", UOP2, ADC_XYL, 0, 8)OPERATION(0x8E, DD8ENN, A, "", "ADC A,(IX+%6)", UOP2, ADC_iXY_NN, 0, 19)OPERATION(0x8F, DD8F, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x90, DD90, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x91, DD91, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x92, DD92, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x93, DD93, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x94, DD94, A, "", "SUB IXH", UOP2, SUB_XYH, 0, 8)OPERATION(0x95, DD95, A, "", "SUB IXL", UOP2, SUB_XYL, 0, 8)OPERATION(0x96, DD96NN, A, "", "SUB A,(IX+%6)", UOP2, SUB_iXY_NN, 0, 19)OPERATION(0x97, DD97, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x98, DD98, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x99, DD99, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x9A, DD9A, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x9B, DD9B, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x9C, DD9C, A, "", "SBC IXH", UOP2, SBC_XYH, 0, 8)OPERATION(0x9D, DD9D, A, "", "SBC IXL", UOP2, SBC_XYL, 0, 8)OPERATION(0x9E, DD9ENN, A, "", "SBC A,(IX+%6)", UOP2, SBC_iXY_NN, 0, 19)OPERATION(0x9F, DD9F, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xA0, DDA0, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xA1, DDA1, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xA2, DDA2, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xA3, DDA3, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xA4, DDA4, A, "", "AND IXH", UOP2, AND_XYH, 0, 8)OPERATION(0xA5, DDA5, A, "", "AND IXL", UOP2, AND_XYL, 0, 8)OPERATION(0xA6, DDA6NN, A, "", "AND (IX+%6)", UOP2, AND_iXY_NN, 0, 19)OPERATION(0xA7, DDA7, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xA8, DDA8, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xA9, DDA9, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xAA, DDAA, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xAB, DDAB, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xAC, DDAC, A, "", "XOR IXH", UOP2, XOR_XYH, 0, 8)OPERATION(0xAD, DDAD, A, "", "XOR IXL", UOP2, XOR_XYL, 0, 8)OPERATION(0xAE, DDAENN, A, "", "XOR (IX+%6)", UOP2, XOR_iXY_NN, 0, 19)OPERATION(0xAF, DDAF, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xB0, DDB0, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xB1, DDB1, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xB2, DDB2, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xB3, DDB3, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xB4, DDB4, A, "", "OR IXH", UOP2, OR_XYH, 0, 8)OPERATION(0xB5, DDB5, A, "", "OR IXL", UOP2, OR_XYL, 0, 8)OPERATION(0xB6, DDB6NN, A, "", "OR (IX+%6)", UOP2, OR_iXY_NN, 0, 19)OPERATION(0xB7, DDB7, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xB8, DDB8, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xB9, DDB9, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xBA, DDBA, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xBB, DDBB, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xBC, DDBC, A, "", "CP IXH", UOP2, CP_XYH, 0, 8)OPERATION(0xBD, DDBD, A, "", "CP IXL", UOP2, CP_XYL, 0, 8)OPERATION(0xBE, DDBENN, A, "", "CP (IX+%6)", UOP2, CP_iXY_NN, 0, 19)OPERATION(0xBF, DDBF, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xC0, DDC0, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xC1, DDC1, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xC2, DDC2, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xC3, DDC3, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xC4, DDC4, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xC5, DDC5, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xC6, DDC6, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xC7, DDC7, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xC8, DDC8, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xC9, DDC9, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xCA, DDCA, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xCB, DDCB, A, "", "", 0, XYCB_OP, 0, 0)OPERATION(0xCC, DDCC, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xCD, DDCD, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xCE, DDCE, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xCF, DDCF, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xD0, DDD0, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xD1, DDD1, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xD2, DDD2, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xD3, DDD3, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xD4, DDD4, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xD5, DDD5, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xD6, DDD6, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xD7, DDD7, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xD8, DDD8, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xD9, DDD9, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xDA, DDDA, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xDB, DDDB, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xDC, DDDC, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xDD, DDDD, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xDE, DDDE, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xDF, DDDF, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xE0, DDE0, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xE1, DDE1, A, "", "POP IX", UOP2, POP_XY, 0, 14)OPERATION(0xE2, DDE2, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xE3, DDE3, A, "", "EX (SP),IX", UOP2, EX_iSP_XY, 0, 23)OPERATION(0xE4, DDE4, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xE5, DDE5, A, "", "PUSH IX", UOP2, PUSH_XY, 0, 15)OPERATION(0xE6, DDE6, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xE7, DDE7, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xE8, DDE8, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xE9, DDE9, B, "", "JP (IX)", UOP2, JP_iXY, 0, 8)OPERATION(0xEA, DDEA, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xEB, DDEB, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xEC, DDEC, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xED, DDED, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xEE, DDEE, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xEF, DDEF, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xF0, DDF0, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xF1, DDF1, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xF2, DDF2, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xF3, DDF3, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xF4, DDF4, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xF5, DDF5, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xF6, DDF6, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xF7, DDF7, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xF8, DDF8, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xF9, DDF9, A, "", "LD SP,IX", UOP2, LD_SP_XY, 0, 10)OPERATION(0xFA, DDFA, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xFB, DDFB, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xFC, DDFC, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xFD, DDFD, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xFE, DDFE, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xFF, DDFF, A, "", "", UOP2, UOP2, 0, 4)
\ No newline at end of file
@@ -1 +1 @@
-/* uSim opddcb.h * Copyright (C) 2000, Tsurishaddai Williamson, tsuri@earthlink.net *  * This program is free software; you can redistribute it and/or * modify it under the terms of the GNU General Public License * as published by the Free Software Foundation; either version 2 * of the License, or (at your option) any later version. *  * This program is distributed in the hope that it will be useful, * but WITHOUT ANY WARRANTY; without even the implied warranty of * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the * GNU General Public License for more details. *  * You should have received a copy of the GNU General Public License * along with this program; if not, write to the Free Software * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA. *//**********************************************************************/OPERATION(0x00, DDCBNN00, A, "", "", UOP4, UOP4)OPERATION(0x01, DDCBNN01, A, "", "", UOP4, UOP4)OPERATION(0x02, DDCBNN02, A, "", "", UOP4, UOP4)OPERATION(0x03, DDCBNN03, A, "", "", UOP4, UOP4)OPERATION(0x04, DDCBNN04, A, "", "", UOP4, UOP4)OPERATION(0x05, DDCBNN05, A, "", "", UOP4, UOP4)OPERATION(0x06, DDCBNN06, A, "", "RLC (IX+%5)", UOP4, RLC_iIX_NN)OPERATION(0x07, DDCBNN07, A, "", "", UOP4, UOP4)OPERATION(0x08, DDCBNN08, A, "", "", UOP4, UOP4)OPERATION(0x09, DDCBNN09, A, "", "", UOP4, UOP4)OPERATION(0x0A, DDCBNN0A, A, "", "", UOP4, UOP4)OPERATION(0x0B, DDCBNN0B, A, "", "", UOP4, UOP4)OPERATION(0x0C, DDCBNN0C, A, "", "", UOP4, UOP4)OPERATION(0x0D, DDCBNN0D, A, "", "", UOP4, UOP4)OPERATION(0x0E, DDCBNN0E, A, "", "RRC (IX+%5)", UOP4, RRC_iIX_NN)OPERATION(0x0F, DDCBNN0F, A, "", "", UOP4, UOP4)OPERATION(0x10, DDCBNN10, A, "", "", UOP4, UOP4)OPERATION(0x11, DDCBNN11, A, "", "", UOP4, UOP4)OPERATION(0x12, DDCBNN12, A, "", "", UOP4, UOP4)OPERATION(0x13, DDCBNN13, A, "", "", UOP4, UOP4)OPERATION(0x14, DDCBNN14, A, "", "", UOP4, UOP4)OPERATION(0x15, DDCBNN15, A, "", "", UOP4, UOP4)OPERATION(0x16, DDCBNN16, A, "", "RL (IX+%5)", UOP4, RL_iIX_NN)OPERATION(0x17, DDCBNN17, A, "", "", UOP4, UOP4)OPERATION(0x18, DDCBNN18, A, "", "", UOP4, UOP4)OPERATION(0x19, DDCBNN19, A, "", "", UOP4, UOP4)OPERATION(0x1A, DDCBNN1A, A, "", "", UOP4, UOP4)OPERATION(0x1B, DDCBNN1B, A, "", "", UOP4, UOP4)OPERATION(0x1C, DDCBNN1C, A, "", "", UOP4, UOP4)OPERATION(0x1D, DDCBNN1D, A, "", "", UOP4, UOP4)OPERATION(0x1E, DDCBNN1E, A, "", "RR (IX+%5)", UOP4, RR_iIX_NN)OPERATION(0x1F, DDCBNN1F, A, "", "", UOP4, UOP4)OPERATION(0x20, DDCBNN20, A, "", "", UOP4, UOP4)OPERATION(0x21, DDCBNN21, A, "", "", UOP4, UOP4)OPERATION(0x22, DDCBNN22, A, "", "", UOP4, UOP4)OPERATION(0x23, DDCBNN23, A, "", "", UOP4, UOP4)OPERATION(0x24, DDCBNN24, A, "", "", UOP4, UOP4)OPERATION(0x25, DDCBNN25, A, "", "", UOP4, UOP4)OPERATION(0x26, DDCBNN26, A, "", "SLA (IX+%5)", UOP4, SLA_iIX_NN)OPERATION(0x27, DDCBNN27, A, "", "", UOP4, UOP4)OPERATION(0x28, DDCBNN28, A, "", "", UOP4, UOP4)OPERATION(0x29, DDCBNN29, A, "", "", UOP4, UOP4)OPERATION(0x2A, DDCBNN2A, A, "", "", UOP4, UOP4)OPERATION(0x2B, DDCBNN2B, A, "", "", UOP4, UOP4)OPERATION(0x2C, DDCBNN2C, A, "", "", UOP4, UOP4)OPERATION(0x2D, DDCBNN2D, A, "", "", UOP4, UOP4)OPERATION(0x2E, DDCBNN2E, A, "", "SRA (IX+%5)", UOP4, SRA_iIX_NN)OPERATION(0x2F, DDCBNN2F, A, "", "", UOP4, UOP4)OPERATION(0x30, DDCBNN30, A, "", "", UOP4, UOP4)OPERATION(0x31, DDCBNN31, A, "", "", UOP4, UOP4)OPERATION(0x32, DDCBNN32, A, "", "", UOP4, UOP4)OPERATION(0x33, DDCBNN33, A, "", "", UOP4, UOP4)OPERATION(0x34, DDCBNN34, A, "", "", UOP4, UOP4)OPERATION(0x35, DDCBNN35, A, "", "", UOP4, UOP4)OPERATION(0x36, DDCBNN36, A, "", "SLIA (IX+%5)", UOP4, SLIA_iIX_NN)OPERATION(0x37, DDCBNN37, A, "", "", UOP4, UOP4)OPERATION(0x38, DDCBNN38, A, "", "", UOP4, UOP4)OPERATION(0x39, DDCBNN39, A, "", "", UOP4, UOP4)OPERATION(0x3A, DDCBNN3A, A, "", "", UOP4, UOP4)OPERATION(0x3B, DDCBNN3B, A, "", "", UOP4, UOP4)OPERATION(0x3C, DDCBNN3C, A, "", "", UOP4, UOP4)OPERATION(0x3D, DDCBNN3D, A, "", "", UOP4, UOP4)OPERATION(0x3E, DDCBNN3E, A, "", "SRL (IX+%5)", UOP4, SRL_iIX_NN)OPERATION(0x3F, DDCBNN3F, A, "", "", UOP4, UOP4)OPERATION(0x40, DDCBNN40, A, "", "", UOP4, UOP4)OPERATION(0x41, DDCBNN41, A, "", "", UOP4, UOP4)OPERATION(0x42, DDCBNN42, A, "", "", UOP4, UOP4)OPERATION(0x43, DDCBNN43, A, "", "", UOP4, UOP4)OPERATION(0x44, DDCBNN44, A, "", "", UOP4, UOP4)OPERATION(0x45, DDCBNN45, A, "", "", UOP4, UOP4)OPERATION(0x46, DDCBNN46, A, "", "BIT 0,(IX+%5)", UOP4, BIT_0_iIX_NN)OPERATION(0x47, DDCBNN47, A, "", "", UOP4, UOP4)OPERATION(0x48, DDCBNN48, A, "", "", UOP4, UOP4)OPERATION(0x49, DDCBNN49, A, "", "", UOP4, UOP4)OPERATION(0x4A, DDCBNN4A, A, "", "", UOP4, UOP4)OPERATION(0x4B, DDCBNN4B, A, "", "", UOP4, UOP4)OPERATION(0x4C, DDCBNN4C, A, "", "", UOP4, UOP4)OPERATION(0x4D, DDCBNN4D, A, "", "", UOP4, UOP4)OPERATION(0x4E, DDCBNN4E, A, "", "BIT 1,(IX+%5)", UOP4, BIT_1_iIX_NN)OPERATION(0x4F, DDCBNN4F, A, "", "", UOP4, UOP4)OPERATION(0x50, DDCBNN50, A, "", "", UOP4, UOP4)OPERATION(0x51, DDCBNN51, A, "", "", UOP4, UOP4)OPERATION(0x52, DDCBNN52, A, "", "", UOP4, UOP4)OPERATION(0x53, DDCBNN53, A, "", "", UOP4, UOP4)OPERATION(0x54, DDCBNN54, A, "", "", UOP4, UOP4)OPERATION(0x55, DDCBNN55, A, "", "", UOP4, UOP4)OPERATION(0x56, DDCBNN56, A, "", "BIT 2,(IX+%5)", UOP4, BIT_2_iIX_NN)OPERATION(0x57, DDCBNN57, A, "", "", UOP4, UOP4)OPERATION(0x58, DDCBNN58, A, "", "", UOP4, UOP4)OPERATION(0x59, DDCBNN59, A, "", "", UOP4, UOP4)OPERATION(0x5A, DDCBNN5A, A, "", "", UOP4, UOP4)OPERATION(0x5B, DDCBNN5B, A, "", "", UOP4, UOP4)OPERATION(0x5C, DDCBNN5C, A, "", "", UOP4, UOP4)OPERATION(0x5D, DDCBNN5D, A, "", "", UOP4, UOP4)OPERATION(0x5E, DDCBNN5E, A, "", "BIT 3,(IX+%5)", UOP4, BIT_3_iIX_NN)OPERATION(0x5F, DDCBNN5F, A, "", "", UOP4, UOP4)OPERATION(0x60, DDCBNN60, A, "", "", UOP4, UOP4)OPERATION(0x61, DDCBNN61, A, "", "", UOP4, UOP4)OPERATION(0x62, DDCBNN62, A, "", "", UOP4, UOP4)OPERATION(0x63, DDCBNN63, A, "", "", UOP4, UOP4)OPERATION(0x64, DDCBNN64, A, "", "", UOP4, UOP4)OPERATION(0x65, DDCBNN65, A, "", "", UOP4, UOP4)OPERATION(0x66, DDCBNN66, A, "", "BIT 4,(IX+%5)", UOP4, BIT_4_iIX_NN)OPERATION(0x67, DDCBNN67, A, "", "", UOP4, UOP4)OPERATION(0x68, DDCBNN68, A, "", "", UOP4, UOP4)OPERATION(0x69, DDCBNN69, A, "", "", UOP4, UOP4)OPERATION(0x6A, DDCBNN6A, A, "", "", UOP4, UOP4)OPERATION(0x6B, DDCBNN6B, A, "", "", UOP4, UOP4)OPERATION(0x6C, DDCBNN6C, A, "", "", UOP4, UOP4)OPERATION(0x6D, DDCBNN6D, A, "", "", UOP4, UOP4)OPERATION(0x6E, DDCBNN6E, A, "", "BIT 5,(IX+%5)", UOP4, BIT_5_iIX_NN)OPERATION(0x6F, DDCBNN6F, A, "", "", UOP4, UOP4)OPERATION(0x70, DDCBNN70, A, "", "", UOP4, UOP4)OPERATION(0x71, DDCBNN71, A, "", "", UOP4, UOP4)OPERATION(0x72, DDCBNN72, A, "", "", UOP4, UOP4)OPERATION(0x73, DDCBNN73, A, "", "", UOP4, UOP4)OPERATION(0x74, DDCBNN74, A, "", "", UOP4, UOP4)OPERATION(0x75, DDCBNN75, A, "", "", UOP4, UOP4)OPERATION(0x76, DDCBNN76, A, "", "BIT 6,(IX+%5)", UOP4, BIT_6_iIX_NN)OPERATION(0x77, DDCBNN77, A, "", "", UOP4, UOP4)OPERATION(0x78, DDCBNN78, A, "", "", UOP4, UOP4)OPERATION(0x79, DDCBNN79, A, "", "", UOP4, UOP4)OPERATION(0x7A, DDCBNN7A, A, "", "", UOP4, UOP4)OPERATION(0x7B, DDCBNN7B, A, "", "", UOP4, UOP4)OPERATION(0x7C, DDCBNN7C, A, "", "", UOP4, UOP4)OPERATION(0x7D, DDCBNN7D, A, "", "", UOP4, UOP4)OPERATION(0x7E, DDCBNN7E, A, "", "BIT 7,(IX+%5)", UOP4, BIT_7_iIX_NN)OPERATION(0x7F, DDCBNN7F, A, "", "", UOP4, UOP4)OPERATION(0x80, DDCBNN80, A, "", "", UOP4, UOP4)OPERATION(0x81, DDCBNN81, A, "", "", UOP4, UOP4)OPERATION(0x82, DDCBNN82, A, "", "", UOP4, UOP4)OPERATION(0x83, DDCBNN83, A, "", "", UOP4, UOP4)OPERATION(0x84, DDCBNN84, A, "", "", UOP4, UOP4)OPERATION(0x85, DDCBNN85, A, "", "", UOP4, UOP4)OPERATION(0x86, DDCBNN86, A, "", "RES 0,(IX+%5)", UOP4, RES_0_iIX_NN)OPERATION(0x87, DDCBNN87, A, "", "", UOP4, UOP4)OPERATION(0x88, DDCBNN88, A, "", "", UOP4, UOP4)OPERATION(0x89, DDCBNN89, A, "", "", UOP4, UOP4)OPERATION(0x8A, DDCBNN8A, A, "", "", UOP4, UOP4)OPERATION(0x8B, DDCBNN8B, A, "", "", UOP4, UOP4)OPERATION(0x8C, DDCBNN8C, A, "", "", UOP4, UOP4)OPERATION(0x8D, DDCBNN8D, A, "", "", UOP4, UOP4)OPERATION(0x8E, DDCBNN8E, A, "", "RES 1,(IX+%5)", UOP4, RES_1_iIX_NN)OPERATION(0x8F, DDCBNN8F, A, "", "", UOP4, UOP4)OPERATION(0x90, DDCBNN90, A, "", "", UOP4, UOP4)OPERATION(0x91, DDCBNN91, A, "", "", UOP4, UOP4)OPERATION(0x92, DDCBNN92, A, "", "", UOP4, UOP4)OPERATION(0x93, DDCBNN93, A, "", "", UOP4, UOP4)OPERATION(0x94, DDCBNN94, A, "", "", UOP4, UOP4)OPERATION(0x95, DDCBNN95, A, "", "", UOP4, UOP4)OPERATION(0x96, DDCBNN96, A, "", "RES 2,(IX+%5)", UOP4, RES_2_iIX_NN)OPERATION(0x97, DDCBNN97, A, "", "", UOP4, UOP4)OPERATION(0x98, DDCBNN98, A, "", "", UOP4, UOP4)OPERATION(0x99, DDCBNN99, A, "", "", UOP4, UOP4)OPERATION(0x9A, DDCBNN9A, A, "", "", UOP4, UOP4)OPERATION(0x9B, DDCBNN9B, A, "", "", UOP4, UOP4)OPERATION(0x9C, DDCBNN9C, A, "", "", UOP4, UOP4)OPERATION(0x9D, DDCBNN9D, A, "", "", UOP4, UOP4)OPERATION(0x9E, DDCBNN9E, A, "", "RES 3,(IX+%5)", UOP4, RES_3_iIX_NN)OPERATION(0x9F, DDCBNN9F, A, "", "", UOP4, UOP4)OPERATION(0xA0, DDCBNNA0, A, "", "", UOP4, UOP4)OPERATION(0xA1, DDCBNNA1, A, "", "", UOP4, UOP4)OPERATION(0xA2, DDCBNNA2, A, "", "", UOP4, UOP4)OPERATION(0xA3, DDCBNNA3, A, "", "", UOP4, UOP4)OPERATION(0xA4, DDCBNNA4, A, "", "", UOP4, UOP4)OPERATION(0xA5, DDCBNNA5, A, "", "", UOP4, UOP4)OPERATION(0xA6, DDCBNNA6, A, "", "RES 4,(IX+%5)", UOP4, RES_4_iIX_NN)OPERATION(0xA7, DDCBNNA7, A, "", "", UOP4, UOP4)OPERATION(0xA8, DDCBNNA8, A, "", "", UOP4, UOP4)OPERATION(0xA9, DDCBNNA9, A, "", "", UOP4, UOP4)OPERATION(0xAA, DDCBNNAA, A, "", "", UOP4, UOP4)OPERATION(0xAB, DDCBNNAB, A, "", "", UOP4, UOP4)OPERATION(0xAC, DDCBNNAC, A, "", "", UOP4, UOP4)OPERATION(0xAD, DDCBNNAD, A, "", "", UOP4, UOP4)OPERATION(0xAE, DDCBNNAE, A, "", "RES 5,(IX+%5)", UOP4, RES_5_iIX_NN)OPERATION(0xAF, DDCBNNAF, A, "", "", UOP4, UOP4)OPERATION(0xB0, DDCBNNB0, A, "", "", UOP4, UOP4)OPERATION(0xB1, DDCBNNB1, A, "", "", UOP4, UOP4)OPERATION(0xB2, DDCBNNB2, A, "", "", UOP4, UOP4)OPERATION(0xB3, DDCBNNB3, A, "", "", UOP4, UOP4)OPERATION(0xB4, DDCBNNB4, A, "", "", UOP4, UOP4)OPERATION(0xB5, DDCBNNB5, A, "", "", UOP4, UOP4)OPERATION(0xB6, DDCBNNB6, A, "", "RES 6,(IX+%5)", UOP4, RES_6_iIX_NN)OPERATION(0xB7, DDCBNNB7, A, "", "", UOP4, UOP4)OPERATION(0xB8, DDCBNNB8, A, "", "", UOP4, UOP4)OPERATION(0xB9, DDCBNNB9, A, "", "", UOP4, UOP4)OPERATION(0xBA, DDCBNNBA, A, "", "", UOP4, UOP4)OPERATION(0xBB, DDCBNNBB, A, "", "", UOP4, UOP4)OPERATION(0xBC, DDCBNNBC, A, "", "", UOP4, UOP4)OPERATION(0xBD, DDCBNNBD, A, "", "", UOP4, UOP4)OPERATION(0xBE, DDCBNNBE, A, "", "RES 7,(IX+%5)", UOP4, RES_7_iIX_NN)OPERATION(0xBF, DDCBNNBF, A, "", "", UOP4, UOP4)OPERATION(0xC0, DDCBNNC0, A, "", "", UOP4, UOP4)OPERATION(0xC1, DDCBNNC1, A, "", "", UOP4, UOP4)OPERATION(0xC2, DDCBNNC2, A, "", "", UOP4, UOP4)OPERATION(0xC3, DDCBNNC3, A, "", "", UOP4, UOP4)OPERATION(0xC4, DDCBNNC4, A, "", "", UOP4, UOP4)OPERATION(0xC5, DDCBNNC5, A, "", "", UOP4, UOP4)OPERATION(0xC6, DDCBNNC6, A, "", "SET 0,(IX+%5)", UOP4, SET_0_iIX_NN)OPERATION(0xC7, DDCBNNC7, A, "", "", UOP4, UOP4)OPERATION(0xC8, DDCBNNC8, A, "", "", UOP4, UOP4)OPERATION(0xC9, DDCBNNC9, A, "", "", UOP4, UOP4)OPERATION(0xCA, DDCBNNCA, A, "", "", UOP4, UOP4)OPERATION(0xCB, DDCBNNCB, A, "", "", UOP4, UOP4)OPERATION(0xCC, DDCBNNCC, A, "", "", UOP4, UOP4)OPERATION(0xCD, DDCBNNCD, A, "", "", UOP4, UOP4)OPERATION(0xCE, DDCBNNCE, A, "", "SET 1,(IX+%5)", UOP4, SET_1_iIX_NN)OPERATION(0xCF, DDCBNNCF, A, "", "", UOP4, UOP4)OPERATION(0xD0, DDCBNND0, A, "", "", UOP4, UOP4)OPERATION(0xD1, DDCBNND1, A, "", "", UOP4, UOP4)OPERATION(0xD2, DDCBNND2, A, "", "", UOP4, UOP4)OPERATION(0xD3, DDCBNND3, A, "", "", UOP4, UOP4)OPERATION(0xD4, DDCBNND4, A, "", "", UOP4, UOP4)OPERATION(0xD5, DDCBNND5, A, "", "", UOP4, UOP4)OPERATION(0xD6, DDCBNND6, A, "", "SET 2,(IX+%5)", UOP4, SET_2_iIX_NN)OPERATION(0xD7, DDCBNND7, A, "", "", UOP4, UOP4)OPERATION(0xD8, DDCBNND8, A, "", "", UOP4, UOP4)OPERATION(0xD9, DDCBNND9, A, "", "", UOP4, UOP4)OPERATION(0xDA, DDCBNNDA, A, "", "", UOP4, UOP4)OPERATION(0xDB, DDCBNNDB, A, "", "", UOP4, UOP4)OPERATION(0xDC, DDCBNNDC, A, "", "", UOP4, UOP4)OPERATION(0xDD, DDCBNNDD, A, "", "", UOP4, UOP4)OPERATION(0xDE, DDCBNNDE, A, "", "SET 3,(IX+%5)", UOP4, SET_3_iIX_NN)OPERATION(0xDF, DDCBNNDF, A, "", "", UOP4, UOP4)OPERATION(0xE0, DDCBNNE0, A, "", "", UOP4, UOP4)OPERATION(0xE1, DDCBNNE1, A, "", "", UOP4, UOP4)OPERATION(0xE2, DDCBNNE2, A, "", "", UOP4, UOP4)OPERATION(0xE3, DDCBNNE3, A, "", "", UOP4, UOP4)OPERATION(0xE4, DDCBNNE4, A, "", "", UOP4, UOP4)OPERATION(0xE5, DDCBNNE5, A, "", "", UOP4, UOP4)OPERATION(0xE6, DDCBNNE6, A, "", "SET 4,(IX+%5)", UOP4, SET_4_iIX_NN)OPERATION(0xE7, DDCBNNE7, A, "", "", UOP4, UOP4)OPERATION(0xE8, DDCBNNE8, A, "", "", UOP4, UOP4)OPERATION(0xE9, DDCBNNE9, A, "", "", UOP4, UOP4)OPERATION(0xEA, DDCBNNEA, A, "", "", UOP4, UOP4)OPERATION(0xEB, DDCBNNEB, A, "", "", UOP4, UOP4)OPERATION(0xEC, DDCBNNEC, A, "", "", UOP4, UOP4)OPERATION(0xED, DDCBNNED, A, "", "", UOP4, UOP4)OPERATION(0xEE, DDCBNNEE, A, "", "SET 5,(IX+%5)", UOP4, SET_5_iIX_NN)OPERATION(0xEF, DDCBNNEF, A, "", "", UOP4, UOP4)OPERATION(0xF0, DDCBNNF0, A, "", "", UOP4, UOP4)OPERATION(0xF1, DDCBNNF1, A, "", "", UOP4, UOP4)OPERATION(0xF2, DDCBNNF2, A, "", "", UOP4, UOP4)OPERATION(0xF3, DDCBNNF3, A, "", "", UOP4, UOP4)OPERATION(0xF4, DDCBNNF4, A, "", "", UOP4, UOP4)OPERATION(0xF5, DDCBNNF5, A, "", "", UOP4, UOP4)OPERATION(0xF6, DDCBNNF6, A, "", "SET 6,(IX+%5)", UOP4, SET_6_iIX_NN)OPERATION(0xF7, DDCBNNF7, A, "", "", UOP4, UOP4)OPERATION(0xF8, DDCBNNF8, A, "", "", UOP4, UOP4)OPERATION(0xF9, DDCBNNF9, A, "", "", UOP4, UOP4)OPERATION(0xFA, DDCBNNFA, A, "", "", UOP4, UOP4)OPERATION(0xFB, DDCBNNFB, A, "", "", UOP4, UOP4)OPERATION(0xFC, DDCBNNFC, A, "", "", UOP4, UOP4)OPERATION(0xFD, DDCBNNFD, A, "", "", UOP4, UOP4)OPERATION(0xFE, DDCBNNFE, A, "", "SET 7,(IX+%5)", UOP4, SET_7_iIX_NN)OPERATION(0xFF, DDCBNNFF, A, "", "", UOP4, UOP4)
\ No newline at end of file
+/* uSim opddcb.h * Copyright (C) 2000, Tsurishaddai Williamson, tsuri@earthlink.net *  * This program is free software; you can redistribute it and/or * modify it under the terms of the GNU General Public License * as published by the Free Software Foundation; either version 2 * of the License, or (at your option) any later version. *  * This program is distributed in the hope that it will be useful, * but WITHOUT ANY WARRANTY; without even the implied warranty of * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the * GNU General Public License for more details. *  * You should have received a copy of the GNU General Public License * along with this program; if not, write to the Free Software * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA. *//**********************************************************************/OPERATION(0x00, DDCBNN00, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x01, DDCBNN01, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x02, DDCBNN02, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x03, DDCBNN03, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x04, DDCBNN04, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x05, DDCBNN05, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x06, DDCBNN06, A, "", "RLC (IX+%5)", UOP4, RLC_iXY_NN, 0, 23)OPERATION(0x07, DDCBNN07, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x08, DDCBNN08, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x09, DDCBNN09, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x0A, DDCBNN0A, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x0B, DDCBNN0B, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x0C, DDCBNN0C, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x0D, DDCBNN0D, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x0E, DDCBNN0E, A, "", "RRC (IX+%5)", UOP4, RRC_iXY_NN, 0, 23)OPERATION(0x0F, DDCBNN0F, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x10, DDCBNN10, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x11, DDCBNN11, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x12, DDCBNN12, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x13, DDCBNN13, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x14, DDCBNN14, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x15, DDCBNN15, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x16, DDCBNN16, A, "", "RL (IX+%5)", UOP4, RL_iXY_NN, 0, 23)OPERATION(0x17, DDCBNN17, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x18, DDCBNN18, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x19, DDCBNN19, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x1A, DDCBNN1A, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x1B, DDCBNN1B, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x1C, DDCBNN1C, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x1D, DDCBNN1D, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x1E, DDCBNN1E, A, "", "RR (IX+%5)", UOP4, RR_iXY_NN, 0, 23)OPERATION(0x1F, DDCBNN1F, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x20, DDCBNN20, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x21, DDCBNN21, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x22, DDCBNN22, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x23, DDCBNN23, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x24, DDCBNN24, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x25, DDCBNN25, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x26, DDCBNN26, A, "", "SLA (IX+%5)", UOP4, SLA_iXY_NN, 0, 23)OPERATION(0x27, DDCBNN27, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x28, DDCBNN28, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x29, DDCBNN29, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x2A, DDCBNN2A, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x2B, DDCBNN2B, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x2C, DDCBNN2C, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x2D, DDCBNN2D, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x2E, DDCBNN2E, A, "", "SRA (IX+%5)", UOP4, SRA_iXY_NN, 0, 23)OPERATION(0x2F, DDCBNN2F, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x30, DDCBNN30, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x31, DDCBNN31, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x32, DDCBNN32, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x33, DDCBNN33, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x34, DDCBNN34, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x35, DDCBNN35, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x36, DDCBNN36, A, "", "SLIA (IX+%5)", UOP4, SLIA_iXY_NN, 0, 23)OPERATION(0x37, DDCBNN37, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x38, DDCBNN38, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x39, DDCBNN39, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x3A, DDCBNN3A, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x3B, DDCBNN3B, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x3C, DDCBNN3C, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x3D, DDCBNN3D, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x3E, DDCBNN3E, A, "", "SRL (IX+%5)", UOP4, SRL_iXY_NN, 0, 23)OPERATION(0x3F, DDCBNN3F, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x40, DDCBNN40, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x41, DDCBNN41, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x42, DDCBNN42, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x43, DDCBNN43, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x44, DDCBNN44, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x45, DDCBNN45, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x46, DDCBNN46, A, "", "BIT 0,(IX+%5)", UOP4, BIT_0_iXY_NN, 0, 20)OPERATION(0x47, DDCBNN47, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x48, DDCBNN48, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x49, DDCBNN49, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x4A, DDCBNN4A, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x4B, DDCBNN4B, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x4C, DDCBNN4C, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x4D, DDCBNN4D, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x4E, DDCBNN4E, A, "", "BIT 1,(IX+%5)", UOP4, BIT_1_iXY_NN, 0, 20)OPERATION(0x4F, DDCBNN4F, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x50, DDCBNN50, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x51, DDCBNN51, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x52, DDCBNN52, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x53, DDCBNN53, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x54, DDCBNN54, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x55, DDCBNN55, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x56, DDCBNN56, A, "", "BIT 2,(IX+%5)", UOP4, BIT_2_iXY_NN, 0, 20)OPERATION(0x57, DDCBNN57, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x58, DDCBNN58, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x59, DDCBNN59, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x5A, DDCBNN5A, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x5B, DDCBNN5B, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x5C, DDCBNN5C, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x5D, DDCBNN5D, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x5E, DDCBNN5E, A, "", "BIT 3,(IX+%5)", UOP4, BIT_3_iXY_NN, 0, 20)OPERATION(0x5F, DDCBNN5F, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x60, DDCBNN60, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x61, DDCBNN61, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x62, DDCBNN62, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x63, DDCBNN63, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x64, DDCBNN64, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x65, DDCBNN65, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x66, DDCBNN66, A, "", "BIT 4,(IX+%5)", UOP4, BIT_4_iXY_NN, 0, 20)OPERATION(0x67, DDCBNN67, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x68, DDCBNN68, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x69, DDCBNN69, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x6A, DDCBNN6A, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x6B, DDCBNN6B, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x6C, DDCBNN6C, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x6D, DDCBNN6D, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x6E, DDCBNN6E, A, "", "BIT 5,(IX+%5)", UOP4, BIT_5_iXY_NN, 0, 20)OPERATION(0x6F, DDCBNN6F, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x70, DDCBNN70, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x71, DDCBNN71, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x72, DDCBNN72, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x73, DDCBNN73, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x74, DDCBNN74, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x75, DDCBNN75, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x76, DDCBNN76, A, "", "BIT 6,(IX+%5)", UOP4, BIT_6_iXY_NN, 0, 20)OPERATION(0x77, DDCBNN77, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x78, DDCBNN78, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x79, DDCBNN79, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x7A, DDCBNN7A, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x7B, DDCBNN7B, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x7C, DDCBNN7C, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x7D, DDCBNN7D, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x7E, DDCBNN7E, A, "", "BIT 7,(IX+%5)", UOP4, BIT_7_iXY_NN, 0, 20)OPERATION(0x7F, DDCBNN7F, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x80, DDCBNN80, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x81, DDCBNN81, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x82, DDCBNN82, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x83, DDCBNN83, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x84, DDCBNN84, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x85, DDCBNN85, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x86, DDCBNN86, A, "", "RES 0,(IX+%5)", UOP4, RES_0_iXY_NN, 0, 23)OPERATION(0x87, DDCBNN87, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x88, DDCBNN88, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x89, DDCBNN89, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x8A, DDCBNN8A, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x8B, DDCBNN8B, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x8C, DDCBNN8C, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x8D, DDCBNN8D, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x8E, DDCBNN8E, A, "", "RES 1,(IX+%5)", UOP4, RES_1_iXY_NN, 0, 23)OPERATION(0x8F, DDCBNN8F, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x90, DDCBNN90, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x91, DDCBNN91, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x92, DDCBNN92, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x93, DDCBNN93, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x94, DDCBNN94, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x95, DDCBNN95, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x96, DDCBNN96, A, "", "RES 2,(IX+%5)", UOP4, RES_2_iXY_NN, 0, 23)OPERATION(0x97, DDCBNN97, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x98, DDCBNN98, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x99, DDCBNN99, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x9A, DDCBNN9A, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x9B, DDCBNN9B, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x9C, DDCBNN9C, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x9D, DDCBNN9D, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x9E, DDCBNN9E, A, "", "RES 3,(IX+%5)", UOP4, RES_3_iXY_NN, 0, 23)OPERATION(0x9F, DDCBNN9F, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xA0, DDCBNNA0, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xA1, DDCBNNA1, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xA2, DDCBNNA2, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xA3, DDCBNNA3, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xA4, DDCBNNA4, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xA5, DDCBNNA5, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xA6, DDCBNNA6, A, "", "RES 4,(IX+%5)", UOP4, RES_4_iXY_NN, 0, 23)OPERATION(0xA7, DDCBNNA7, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xA8, DDCBNNA8, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xA9, DDCBNNA9, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xAA, DDCBNNAA, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xAB, DDCBNNAB, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xAC, DDCBNNAC, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xAD, DDCBNNAD, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xAE, DDCBNNAE, A, "", "RES 5,(IX+%5)", UOP4, RES_5_iXY_NN, 0, 23)OPERATION(0xAF, DDCBNNAF, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xB0, DDCBNNB0, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xB1, DDCBNNB1, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xB2, DDCBNNB2, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xB3, DDCBNNB3, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xB4, DDCBNNB4, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xB5, DDCBNNB5, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xB6, DDCBNNB6, A, "", "RES 6,(IX+%5)", UOP4, RES_6_iXY_NN, 0, 23)OPERATION(0xB7, DDCBNNB7, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xB8, DDCBNNB8, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xB9, DDCBNNB9, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xBA, DDCBNNBA, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xBB, DDCBNNBB, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xBC, DDCBNNBC, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xBD, DDCBNNBD, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xBE, DDCBNNBE, A, "", "RES 7,(IX+%5)", UOP4, RES_7_iXY_NN, 0, 23)OPERATION(0xBF, DDCBNNBF, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xC0, DDCBNNC0, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xC1, DDCBNNC1, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xC2, DDCBNNC2, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xC3, DDCBNNC3, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xC4, DDCBNNC4, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xC5, DDCBNNC5, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xC6, DDCBNNC6, A, "", "SET 0,(IX+%5)", UOP4, SET_0_iXY_NN, 0, 23)OPERATION(0xC7, DDCBNNC7, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xC8, DDCBNNC8, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xC9, DDCBNNC9, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xCA, DDCBNNCA, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xCB, DDCBNNCB, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xCC, DDCBNNCC, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xCD, DDCBNNCD, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xCE, DDCBNNCE, A, "", "SET 1,(IX+%5)", UOP4, SET_1_iXY_NN, 0, 23)OPERATION(0xCF, DDCBNNCF, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xD0, DDCBNND0, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xD1, DDCBNND1, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xD2, DDCBNND2, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xD3, DDCBNND3, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xD4, DDCBNND4, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xD5, DDCBNND5, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xD6, DDCBNND6, A, "", "SET 2,(IX+%5)", UOP4, SET_2_iXY_NN, 0, 23)OPERATION(0xD7, DDCBNND7, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xD8, DDCBNND8, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xD9, DDCBNND9, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xDA, DDCBNNDA, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xDB, DDCBNNDB, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xDC, DDCBNNDC, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xDD, DDCBNNDD, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xDE, DDCBNNDE, A, "", "SET 3,(IX+%5)", UOP4, SET_3_iXY_NN, 0, 23)OPERATION(0xDF, DDCBNNDF, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xE0, DDCBNNE0, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xE1, DDCBNNE1, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xE2, DDCBNNE2, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xE3, DDCBNNE3, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xE4, DDCBNNE4, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xE5, DDCBNNE5, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xE6, DDCBNNE6, A, "", "SET 4,(IX+%5)", UOP4, SET_4_iXY_NN, 0, 23)OPERATION(0xE7, DDCBNNE7, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xE8, DDCBNNE8, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xE9, DDCBNNE9, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xEA, DDCBNNEA, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xEB, DDCBNNEB, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xEC, DDCBNNEC, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xED, DDCBNNED, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xEE, DDCBNNEE, A, "", "SET 5,(IX+%5)", UOP4, SET_5_iXY_NN, 0, 23)OPERATION(0xEF, DDCBNNEF, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xF0, DDCBNNF0, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xF1, DDCBNNF1, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xF2, DDCBNNF2, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xF3, DDCBNNF3, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xF4, DDCBNNF4, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xF5, DDCBNNF5, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xF6, DDCBNNF6, A, "", "SET 6,(IX+%5)", UOP4, SET_6_iXY_NN, 0, 23)OPERATION(0xF7, DDCBNNF7, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xF8, DDCBNNF8, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xF9, DDCBNNF9, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xFA, DDCBNNFA, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xFB, DDCBNNFB, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xFC, DDCBNNFC, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xFD, DDCBNNFD, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xFE, DDCBNNFE, A, "", "SET 7,(IX+%5)", UOP4, SET_7_iXY_NN, 0, 23)OPERATION(0xFF, DDCBNNFF, A, "", "", UOP4, UOP4, 0, 4)
\ No newline at end of file
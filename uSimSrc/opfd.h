@@ -1 +1 @@
-/* uSim opfd.h * Copyright (C) 2000, Tsurishaddai Williamson, tsuri@earthlink.net *  * This program is free software; you can redistribute it and/or * modify it under the terms of the GNU General Public License * as published by the Free Software Foundation; either version 2 * of the License, or (at your option) any later version. *  * This program is distributed in the hope that it will be useful, * but WITHOUT ANY WARRANTY; without even the implied warranty of * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the * GNU General Public License for more details. *  * You should have received a copy of the GNU General Public License * along with this program; if not, write to the Free Software * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA. *//**********************************************************************/OPERATION(0x00, FD00, A, "", "", UOP2, UOP2)OPERATION(0x01, FD01, A, "", "", UOP2, UOP2)OPERATION(0x02, FD02, A, "", "", UOP2, UOP2)OPERATION(0x03, FD03, A, "", "", UOP2, UOP2)OPERATION(0x04, FD04, A, "", "", UOP2, UOP2)OPERATION(0x05, FD05, A, "", "", UOP2, UOP2)OPERATION(0x06, FD06, A, "", "", UOP2, UOP2)OPERATION(0x07, FD07, A, "", "", UOP2, UOP2)OPERATION(0x08, FD08, A, "", "", UOP2, UOP2)OPERATION(0x09, FD09, A, "", "ADD IY,BC", UOP2, ADD_IY_BC)OPERATION(0x0A, FD0A, A, "", "", UOP2, UOP2)OPERATION(0x0B, FD0B, A, "", "", UOP2, UOP2)OPERATION(0x0C, FD0C, A, "", "", UOP2, UOP2)OPERATION(0x0D, FD0D, A, "", "", UOP2, UOP2)OPERATION(0x0E, FD0E, A, "", "", UOP2, UOP2)OPERATION(0x0F, FD0F, A, "", "", UOP2, UOP2)OPERATION(0x10, FD10, A, "", "", UOP2, UOP2)OPERATION(0x11, FD11, A, "", "", UOP2, UOP2)OPERATION(0x12, FD12, A, "", "", UOP2, UOP2)OPERATION(0x13, FD13, A, "", "", UOP2, UOP2)OPERATION(0x14, FD14, A, "", "", UOP2, UOP2)OPERATION(0x15, FD15, A, "", "", UOP2, UOP2)OPERATION(0x16, FD16, A, "", "", UOP2, UOP2)OPERATION(0x17, FD17, A, "", "", UOP2, UOP2)OPERATION(0x18, FD18, A, "", "", UOP2, UOP2)OPERATION(0x19, FD19, A, "", "ADD IY,DE", UOP2, ADD_IY_DE)OPERATION(0x1A, FD1A, A, "", "", UOP2, UOP2)OPERATION(0x1B, FD1B, A, "", "", UOP2, UOP2)OPERATION(0x1C, FD1C, A, "", "", UOP2, UOP2)OPERATION(0x1D, FD1D, A, "", "", UOP2, UOP2)OPERATION(0x1E, FD1E, A, "", "", UOP2, UOP2)OPERATION(0x1F, FD1F, A, "", "", UOP2, UOP2)OPERATION(0x20, FD20, A, "", "", UOP2, UOP2)OPERATION(0x21, FD21NNNN, F, "", "LD IY,%4", UOP2, LD_IY_NNNN)OPERATION(0x22, FD22NNNN, F, "", "LD (%4),IY", UOP2, LD_iNNNN_IY)OPERATION(0x23, FD23, A, "", "INC IY", UOP2, INC_IY)OPERATION(0x24, FD24, A, "", "INC IYH", UOP2, INC_IYH)OPERATION(0x25, FD25, A, "", "DEC IYH", UOP2, DEC_IYH)OPERATION(0x26, FD26NN, A, "", "LD IYH,%6", UOP2, LD_IYH_NN)OPERATION(0x27, FD27, A, "", "", UOP2, UOP2)OPERATION(0x28, FD28, A, "", "", UOP2, UOP2)OPERATION(0x29, FD29, A, "", "ADD IY,IY", UOP2, ADD_IY_IY)OPERATION(0x2A, FD2ANNNN, F, "", "LD IY,(%4)", UOP2, LD_IY_iNNNN)OPERATION(0x2B, FD2B, A, "", "DEC IY", UOP2, DEC_IY)OPERATION(0x2C, FD2C, A, "", "INC IYL", UOP2, INC_IYL)OPERATION(0x2D, FD2D, A, "", "DEC IYL", UOP2, DEC_IYL)OPERATION(0x2E, FD2ENN, A, "", "LD IYL,%6", UOP2, LD_IYL_NN)OPERATION(0x2F, FD2F, A, "", "", UOP2, UOP2)OPERATION(0x30, FD30, A, "", "", UOP2, UOP2)OPERATION(0x31, FD31, A, "", "", UOP2, UOP2)OPERATION(0x32, FD32, A, "", "", UOP2, UOP2)OPERATION(0x33, FD33, A, "", "", UOP2, UOP2)OPERATION(0x34, FD34NN, A, "", "INC (IY+%6)", UOP2, INC_iIY_NN)OPERATION(0x35, FD35NN, A, "", "DEC (IY+%6)", UOP2, DEC_iIY_NN)OPERATION(0x36, FD36NNNN, A, "", "LD (IY+%6),%7", UOP2, LD_iIY_NN_NN)OPERATION(0x37, FD37, A, "", "", UOP2, UOP2)OPERATION(0x38, FD38, A, "", "", UOP2, UOP2)OPERATION(0x39, FD39, A, "", "ADD IY,SP", UOP2, ADD_IY_SP)OPERATION(0x3A, FD3A, A, "", "", UOP2, UOP2)OPERATION(0x3B, FD3B, A, "", "", UOP2, UOP2)OPERATION(0x3C, FD3C, A, "", "", UOP2, UOP2)OPERATION(0x3D, FD3D, A, "", "", UOP2, UOP2)OPERATION(0x3E, FD3E, A, "", "", UOP2, UOP2)OPERATION(0x3F, FD3F, A, "", "", UOP2, UOP2)OPERATION(0x40, FD40, A, "", "", UOP2, UOP2)OPERATION(0x41, FD41, A, "", "", UOP2, UOP2)OPERATION(0x42, FD42, A, "", "", UOP2, UOP2)OPERATION(0x43, FD43, A, "", "", UOP2, UOP2)OPERATION(0x44, FD44, A, "", "LD B,IYH", UOP2, LD_B_IYH)OPERATION(0x45, FD45, A, "", "LD B,IYL", UOP2, LD_B_IYL)OPERATION(0x46, FD46NN, A, "", "LD B,(IY+%6)", UOP2, LD_B_iIY_NN)OPERATION(0x47, FD47, A, "", "", UOP2, UOP2)OPERATION(0x48, FD48, A, "", "", UOP2, UOP2)OPERATION(0x49, FD49, A, "", "", UOP2, UOP2)OPERATION(0x4A, FD4A, A, "", "", UOP2, UOP2)OPERATION(0x4B, FD4B, A, "", "", UOP2, UOP2)OPERATION(0x4C, FD4C, A, "", "LD C,IYH", UOP2, LD_C_IYH)OPERATION(0x4D, FD4D, A, "", "LD C,IYL", UOP2, LD_C_IYL)OPERATION(0x4E, FD4ENN, A, "", "LD C,(IY+%6)", UOP2, LD_C_iIY_NN)OPERATION(0x4F, FD4F, A, "", "", UOP2, UOP2)OPERATION(0x50, FD50, A, "", "", UOP2, UOP2)OPERATION(0x51, FD51, A, "", "", UOP2, UOP2)OPERATION(0x52, FD52, A, "", "", UOP2, UOP2)OPERATION(0x53, FD53, A, "", "", UOP2, UOP2)OPERATION(0x54, FD54, A, "", "LD D,IYH", UOP2, LD_D_IYH)OPERATION(0x55, FD55, A, "", "LD D,IYL", UOP2, LD_D_IYL)OPERATION(0x56, FD56NN, A, "", "LD D,(IY+%6)", UOP2, LD_D_iIY_NN)OPERATION(0x57, FD57, A, "", "", UOP2, UOP2)OPERATION(0x58, FD58, A, "", "", UOP2, UOP2)OPERATION(0x59, FD59, A, "", "", UOP2, UOP2)OPERATION(0x5A, FD5A, A, "", "", UOP2, UOP2)OPERATION(0x5B, FD5B, A, "", "", UOP2, UOP2)OPERATION(0x5C, FD5C, A, "", "LD E,IYH", UOP2, LD_E_IYH)OPERATION(0x5D, FD5D, A, "", "LD E,IYL", UOP2, LD_E_IYL)OPERATION(0x5E, FD5ENN, A, "", "LD E,(IY+%6)", UOP2, LD_E_iIY_NN)OPERATION(0x5F, FD5F, A, "", "", UOP2, UOP2)OPERATION(0x60, FD60, A, "", "LD IYH,B", UOP2, LD_IYH_B)OPERATION(0x61, FD61, A, "", "LD IYH,C", UOP2, LD_IYH_C)OPERATION(0x62, FD62, A, "", "LD IYH,D", UOP2, LD_IYH_D)OPERATION(0x63, FD63, A, "", "LD IYH,E", UOP2, LD_IYH_E)OPERATION(0x64, FD64, A, "", "LD IYH,IYH", UOP2, LD_IYH_IYH)OPERATION(0x65, FD65, A, "", "LD IYH,IYL", UOP2, LD_IYH_IYL)OPERATION(0x66, FD66NN, A, "", "LD H,(IY+%6)", UOP2, LD_H_iIY_NN)OPERATION(0x67, FD67, A, "", "LD IYH,A", UOP2, LD_IYH_A)OPERATION(0x68, FD68, A, "", "LD IYL,B", UOP2, LD_IYL_B)OPERATION(0x69, FD69, A, "", "LD IYL,C", UOP2, LD_IYL_C)OPERATION(0x6A, FD6A, A, "", "LD IYL,D", UOP2, LD_IYL_D)OPERATION(0x6B, FD6B, A, "", "LD IYL,E", UOP2, LD_IYL_E)OPERATION(0x6C, FD6C, A, "", "LD IYL,IYH", UOP2, LD_IYL_IYH)OPERATION(0x6D, FD6D, A, "", "LD IYL,IYL", UOP2, LD_IYL_IYL)OPERATION(0x6E, FD6ENN, A, "", "LD L,(IY+%6)", UOP2, LD_L_iIY_NN)OPERATION(0x6F, FD6F, A, "", "LD IYL,A", UOP2, LD_IYL_A)OPERATION(0x70, FD70NN, A, "", "LD (IY+%6),B", UOP2, LD_iIY_NN_B)OPERATION(0x71, FD71NN, A, "", "LD (IY+%6),C", UOP2, LD_iIY_NN_C)OPERATION(0x72, FD72NN, A, "", "LD (IY+%6),D", UOP2, LD_iIY_NN_D)OPERATION(0x73, FD73NN, A, "", "LD (IY+%6),E", UOP2, LD_iIY_NN_E)OPERATION(0x74, FD74NN, A, "", "LD (IY+%6),H", UOP2, LD_iIY_NN_H)OPERATION(0x75, FD75NN, A, "", "LD (IY+%6),L", UOP2, LD_iIY_NN_L)OPERATION(0x76, FD76, A, "", "", UOP2, UOP2)OPERATION(0x77, FD77NN, A, "", "LD (IY+%6),A", UOP2, LD_iIY_NN_A)OPERATION(0x78, FD78, A, "", "", UOP2, UOP2)OPERATION(0x79, FD79, A, "", "", UOP2, UOP2)OPERATION(0x7A, FD7A, A, "", "", UOP2, UOP2)OPERATION(0x7B, FD7B, A, "", "", UOP2, UOP2)OPERATION(0x7C, FD7C, A, "", "LD A,IYH", UOP2, LD_A_IYH)OPERATION(0x7D, FD7D, A, "", "LD A,IYL", UOP2, LD_A_IYL)OPERATION(0x7E, FD7ENN, A, "", "LD A,(IY+%6)", UOP2, LD_A_iIY_NN)OPERATION(0x7F, FD7F, A, "", "", UOP2, UOP2)OPERATION(0x80, FD80, A, "", "", UOP2, UOP2)OPERATION(0x81, FD81, A, "", "", UOP2, UOP2)OPERATION(0x82, FD82, A, "", "", UOP2, UOP2)OPERATION(0x83, FD83, A, "", "", UOP2, UOP2)OPERATION(0x84, FD84, A, "", "ADD A,IYH", UOP2, ADD_IYH)OPERATION(0x85, FD85, A, "", "ADD A,IYL", UOP2, ADD_IYL)OPERATION(0x86, FD86NN, A, "", "ADD A,(IY+%6)", UOP2, ADD_iIY_NN)OPERATION(0x87, FD87, A, "", "", UOP2, UOP2)OPERATION(0x88, FD88, A, "", "", UOP2, UOP2)OPERATION(0x89, FD89, A, "", "", UOP2, UOP2)OPERATION(0x8A, FD8A, A, "", "", UOP2, UOP2)OPERATION(0x8B, FD8B, A, "", "", UOP2, UOP2)OPERATION(0x8C, FD8C, A, "", "ADC A,IYH", UOP2, ADC_IYH)OPERATION(0x8D, FD8D, A, "", "ADC A,IYL", UOP2, ADC_IYL)OPERATION(0x8E, FD8ENN, A, "", "ADC A,(IY+%6)", UOP2, ADC_iIY_NN)OPERATION(0x8F, FD8F, A, "", "", UOP2, UOP2)OPERATION(0x90, FD90, A, "", "", UOP2, UOP2)OPERATION(0x91, FD91, A, "", "", UOP2, UOP2)OPERATION(0x92, FD92, A, "", "", UOP2, UOP2)OPERATION(0x93, FD93, A, "", "", UOP2, UOP2)OPERATION(0x94, FD94, A, "", "SUB IYH", UOP2, SUB_IYH)OPERATION(0x95, FD95, A, "", "SUB IYL", UOP2, SUB_IYL)OPERATION(0x96, FD96NN, A, "", "SUB A,(IY+%6)", UOP2, SUB_iIY_NN)OPERATION(0x97, FD97, A, "", "", UOP2, UOP2)OPERATION(0x98, FD98, A, "", "", UOP2, UOP2)OPERATION(0x99, FD99, A, "", "", UOP2, UOP2)OPERATION(0x9A, FD9A, A, "", "", UOP2, UOP2)OPERATION(0x9B, FD9B, A, "", "", UOP2, UOP2)OPERATION(0x9C, FD9C, A, "", "SBC IYH", UOP2, SBC_IYH)OPERATION(0x9D, FD9D, A, "", "SBC IYL", UOP2, SBC_IYL)OPERATION(0x9E, FD9ENN, A, "", "SBC A,(IY+%6)", UOP2, SBC_iIY_NN)OPERATION(0x9F, FD9F, A, "", "", UOP2, UOP2)OPERATION(0xA0, FDA0, A, "", "", UOP2, UOP2)OPERATION(0xA1, FDA1, A, "", "", UOP2, UOP2)OPERATION(0xA2, FDA2, A, "", "", UOP2, UOP2)OPERATION(0xA3, FDA3, A, "", "", UOP2, UOP2)OPERATION(0xA4, FDA4, A, "", "AND IYH", UOP2, AND_IYH)OPERATION(0xA5, FDA5, A, "", "AND IYL", UOP2, AND_IYL)OPERATION(0xA6, FDA6NN, A, "", "AND (IY+%6)", UOP2, AND_iIY_NN)OPERATION(0xA7, FDA7, A, "", "", UOP2, UOP2)OPERATION(0xA8, FDA8, A, "", "", UOP2, UOP2)OPERATION(0xA9, FDA9, A, "", "", UOP2, UOP2)OPERATION(0xAA, FDAA, A, "", "", UOP2, UOP2)OPERATION(0xAB, FDAB, A, "", "", UOP2, UOP2)OPERATION(0xAC, FDAC, A, "", "XOR IYH", UOP2, XOR_IYH)OPERATION(0xAD, FDAD, A, "", "XOR IYL", UOP2, XOR_IYL)OPERATION(0xAE, FDAENN, A, "", "XOR (IY+%6)", UOP2, XOR_iIY_NN)OPERATION(0xAF, FDAF, A, "", "", UOP2, UOP2)OPERATION(0xB0, FDB0, A, "", "", UOP2, UOP2)OPERATION(0xB1, FDB1, A, "", "", UOP2, UOP2)OPERATION(0xB2, FDB2, A, "", "", UOP2, UOP2)OPERATION(0xB3, FDB3, A, "", "", UOP2, UOP2)OPERATION(0xB4, FDB4, A, "", "OR IYH", UOP2, OR_IYH)OPERATION(0xB5, FDB5, A, "", "OR IYL", UOP2, OR_IYL)OPERATION(0xB6, FDB6NN, A, "", "OR (IY+%6)", UOP2, OR_iIY_NN)OPERATION(0xB7, FDB7, A, "", "", UOP2, UOP2)OPERATION(0xB8, FDB8, A, "", "", UOP2, UOP2)OPERATION(0xB9, FDB9, A, "", "", UOP2, UOP2)OPERATION(0xBA, FDBA, A, "", "", UOP2, UOP2)OPERATION(0xBB, FDBB, A, "", "", UOP2, UOP2)OPERATION(0xBC, FDBC, A, "", "CP IYH", UOP2, CP_IYH)OPERATION(0xBD, FDBD, A, "", "CP IYL", UOP2, CP_IYL)OPERATION(0xBE, FDBENN, A, "", "CP (IY+%6)", UOP2, CP_iIY_NN)OPERATION(0xBF, FDBF, A, "", "", UOP2, UOP2)OPERATION(0xC0, FDC0, A, "", "", UOP2, UOP2)OPERATION(0xC1, FDC1, A, "", "", UOP2, UOP2)OPERATION(0xC2, FDC2, A, "", "", UOP2, UOP2)OPERATION(0xC3, FDC3, A, "", "", UOP2, UOP2)OPERATION(0xC4, FDC4, A, "", "", UOP2, UOP2)OPERATION(0xC5, FDC5, A, "", "", UOP2, UOP2)OPERATION(0xC6, FDC6, A, "", "", UOP2, UOP2)OPERATION(0xC7, FDC7, A, "", "", UOP2, UOP2)OPERATION(0xC8, FDC8, A, "", "", UOP2, UOP2)OPERATION(0xC9, FDC9, A, "", "", UOP2, UOP2)OPERATION(0xCA, FDCA, A, "", "", UOP2, UOP2)OPERATION(0xCB, FDCB, A, "", "", 0, FDCB_OP)OPERATION(0xCC, FDCC, A, "", "", UOP2, UOP2)OPERATION(0xCD, FDCD, A, "", "", UOP2, UOP2)OPERATION(0xCE, FDCE, A, "", "", UOP2, UOP2)OPERATION(0xCF, FDCF, A, "", "", UOP2, UOP2)OPERATION(0xD0, FDD0, A, "", "", UOP2, UOP2)OPERATION(0xD1, FDD1, A, "", "", UOP2, UOP2)OPERATION(0xD2, FDD2, A, "", "", UOP2, UOP2)OPERATION(0xD3, FDD3, A, "", "", UOP2, UOP2)OPERATION(0xD4, FDD4, A, "", "", UOP2, UOP2)OPERATION(0xD5, FDD5, A, "", "", UOP2, UOP2)OPERATION(0xD6, FDD6, A, "", "", UOP2, UOP2)OPERATION(0xD7, FDD7, A, "", "", UOP2, UOP2)OPERATION(0xD8, FDD8, A, "", "", UOP2, UOP2)OPERATION(0xD9, FDD9, A, "", "", UOP2, UOP2)OPERATION(0xDA, FDDA, A, "", "", UOP2, UOP2)OPERATION(0xDB, FDDB, A, "", "", UOP2, UOP2)OPERATION(0xDC, FDDC, A, "", "", UOP2, UOP2)OPERATION(0xDD, FDDD, A, "", "", UOP2, UOP2)OPERATION(0xDE, FDDE, A, "", "", UOP2, UOP2)OPERATION(0xDF, FDDF, A, "", "", UOP2, UOP2)OPERATION(0xE0, FDE0, A, "", "", UOP2, UOP2)OPERATION(0xE1, FDE1, A, "", "POP IY", UOP2, POP_IY)OPERATION(0xE2, FDE2, A, "", "", UOP2, UOP2)OPERATION(0xE3, FDE3, A, "", "EX (SP),IY", UOP2, EX_iSP_IY)OPERATION(0xE4, FDE4, A, "", "", UOP2, UOP2)OPERATION(0xE5, FDE5, A, "", "PUSH IY", UOP2, PUSH_IY)OPERATION(0xE6, FDE6, A, "", "", UOP2, UOP2)OPERATION(0xE7, FDE7, A, "", "", UOP2, UOP2)OPERATION(0xE8, FDE8, A, "", "", UOP2, UOP2)OPERATION(0xE9, FDE9, B, "", "JP (IY)", UOP2, JP_iIY)OPERATION(0xEA, FDEA, A, "", "", UOP2, UOP2)OPERATION(0xEB, FDEB, A, "", "", UOP2, UOP2)OPERATION(0xEC, FDEC, A, "", "", UOP2, UOP2)OPERATION(0xED, FDED, A, "", "", UOP2, UOP2)OPERATION(0xEE, FDEE, A, "", "", UOP2, UOP2)OPERATION(0xEF, FDEF, A, "", "", UOP2, UOP2)OPERATION(0xF0, FDF0, A, "", "", UOP2, UOP2)OPERATION(0xF1, FDF1, A, "", "", UOP2, UOP2)OPERATION(0xF2, FDF2, A, "", "", UOP2, UOP2)OPERATION(0xF3, FDF3, A, "", "", UOP2, UOP2)OPERATION(0xF4, FDF4, A, "", "", UOP2, UOP2)OPERATION(0xF5, FDF5, A, "", "", UOP2, UOP2)OPERATION(0xF6, FDF6, A, "", "", UOP2, UOP2)OPERATION(0xF7, FDF7, A, "", "", UOP2, UOP2)OPERATION(0xF8, FDF8, A, "", "", UOP2, UOP2)OPERATION(0xF9, FDF9, A, "", "LD SP,IY", UOP2, LD_SP_IY)OPERATION(0xFA, FDFA, A, "", "", UOP2, UOP2)OPERATION(0xFB, FDFB, A, "", "", UOP2, UOP2)OPERATION(0xFC, FDFC, A, "", "", UOP2, UOP2)OPERATION(0xFD, FDFD, A, "", "", UOP2, UOP2)OPERATION(0xFE, FDFE, A, "", "", UOP2, UOP2)OPERATION(0xFF, FDFF, A, "", "", UOP2, UOP2)
\ No newline at end of file
+/* uSim opfd.h * Copyright (C) 2000, Tsurishaddai Williamson, tsuri@earthlink.net *  * This program is free software; you can redistribute it and/or * modify it under the terms of the GNU General Public License * as published by the Free Software Foundation; either version 2 * of the License, or (at your option) any later version. *  * This program is distributed in the hope that it will be useful, * but WITHOUT ANY WARRANTY; without even the implied warranty of * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the * GNU General Public License for more details. *  * You should have received a copy of the GNU General Public License * along with this program; if not, write to the Free Software * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA. *//**********************************************************************/OPERATION(0x00, FD00, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x01, FD01, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x02, FD02, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x03, FD03, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x04, FD04, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x05, FD05, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x06, FD06, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x07, FD07, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x08, FD08, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x09, FD09, A, "", "ADD IY,BC", UOP2, ADD_XY_BC, 0, 15)OPERATION(0x0A, FD0A, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x0B, FD0B, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x0C, FD0C, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x0D, FD0D, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x0E, FD0E, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x0F, FD0F, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x10, FD10, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x11, FD11, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x12, FD12, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x13, FD13, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x14, FD14, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x15, FD15, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x16, FD16, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x17, FD17, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x18, FD18, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x19, FD19, A, "", "ADD IY,DE", UOP2, ADD_XY_DE, 0, 15)OPERATION(0x1A, FD1A, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x1B, FD1B, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x1C, FD1C, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x1D, FD1D, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x1E, FD1E, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x1F, FD1F, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x20, FD20, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x21, FD21NNNN, F, "", "LD IY,%4", UOP2, LD_XY_NNNN, 0, 14)OPERATION(0x22, FD22NNNN, F, "", "LD (%4),IY", UOP2, LD_iNNNN_XY, 0, 20)OPERATION(0x23, FD23, A, "", "INC IY", UOP2, INC_XY, 0, 10)OPERATION(0x24, FD24, A, "", "INC IYH", UOP2, INC_XYH, 0, 8)OPERATION(0x25, FD25, A, "", "DEC IYH", UOP2, DEC_XYH, 0, 8)OPERATION(0x26, FD26NN, A, "", "LD IYH,%6", UOP2, LD_XYH_NN, 0, 11)OPERATION(0x27, FD27, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x28, FD28, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x29, FD29, A, "", "ADD IY,IY", UOP2, ADD_XY_XY, 0, 15)OPERATION(0x2A, FD2ANNNN, F, "", "LD IY,(%4)", UOP2, LD_XY_iNNNN, 0, 20)OPERATION(0x2B, FD2B, A, "", "DEC IY", UOP2, DEC_XY, 0, 10)OPERATION(0x2C, FD2C, A, "", "INC IYL", UOP2, INC_XYL, 0, 8)OPERATION(0x2D, FD2D, A, "", "DEC IYL", UOP2, DEC_XYL, 0, 8)OPERATION(0x2E, FD2ENN, A, "", "LD IYL,%6", UOP2, LD_XYL_NN, 0, 11)OPERATION(0x2F, FD2F, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x30, FD30, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x31, FD31, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x32, FD32, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x33, FD33, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x34, FD34NN, A, "", "INC (IY+%6)", UOP2, INC_iXY_NN, 0, 23)OPERATION(0x35, FD35NN, A, "", "DEC (IY+%6)", UOP2, DEC_iXY_NN, 0, 23)OPERATION(0x36, FD36NNNN, A, "", "LD (IY+%6),%7", UOP2, LD_iXY_NN_NN, 0, 19)OPERATION(0x37, FD37, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x38, FD38, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x39, FD39, A, "", "ADD IY,SP", UOP2, ADD_XY_SP, 0, 15)OPERATION(0x3A, FD3A, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x3B, FD3B, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x3C, FD3C, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x3D, FD3D, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x3E, FD3E, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x3F, FD3F, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x40, FD40, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x41, FD41, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x42, FD42, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x43, FD43, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x44, FD44, A, "", "LD B,IYH", UOP2, LD_B_XYH, 0, 8)OPERATION(0x45, FD45, A, "", "LD B,IYL", UOP2, LD_B_XYL, 0, 8)OPERATION(0x46, FD46NN, A, "", "LD B,(IY+%6)", UOP2, LD_B_iXY_NN, 0, 19)OPERATION(0x47, FD47, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x48, FD48, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x49, FD49, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x4A, FD4A, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x4B, FD4B, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x4C, FD4C, A, "", "LD C,IYH", UOP2, LD_C_XYH, 0, 8)OPERATION(0x4D, FD4D, A, "", "LD C,IYL", UOP2, LD_C_XYL, 0, 8)OPERATION(0x4E, FD4ENN, A, "", "LD C,(IY+%6)", UOP2, LD_C_iXY_NN, 0, 19)OPERATION(0x4F, FD4F, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x50, FD50, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x51, FD51, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x52, FD52, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x53, FD53, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x54, FD54, A, "", "LD D,IYH", UOP2, LD_D_XYH, 0, 8)OPERATION(0x55, FD55, A, "", "LD D,IYL", UOP2, LD_D_XYL, 0, 8)OPERATION(0x56, FD56NN, A, "", "LD D,(IY+%6)", UOP2, LD_D_iXY_NN, 0, 19)OPERATION(0x57, FD57, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x58, FD58, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x59, FD59, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x5A, FD5A, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x5B, FD5B, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x5C, FD5C, A, "", "LD E,IYH", UOP2, LD_E_XYH, 0, 8)OPERATION(0x5D, FD5D, A, "", "LD E,IYL", UOP2, LD_E_XYL, 0, 8)OPERATION(0x5E, FD5ENN, A, "", "LD E,(IY+%6)", UOP2, LD_E_iXY_NN, 0, 19)OPERATION(0x5F, FD5F, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x60, FD60, A, "", "LD IYH,B", UOP2, LD_XYH_B, 0, 8)OPERATION(0x61, FD61, A, "", "LD IYH,C", UOP2, LD_XYH_C, 0, 8)OPERATION(0x62, FD62, A, "", "LD IYH,D", UOP2, LD_XYH_D, 0, 8)OPERATION(0x63, FD63, A, "", "LD IYH,E", UOP2, LD_XYH_E, 0, 8)OPERATION(0x64, FD64, A, "", "LD IYH,IYH", UOP2, LD_XYH_XYH, 0, 8)OPERATION(0x65, FD65, A, "", "LD IYH,IYL", UOP2, LD_XYH_XYL, 0, 8)OPERATION(0x66, FD66NN, A, "", "LD H,(IY+%6)", UOP2, LD_H_iXY_NN, 0, 19)OPERATION(0x67, FD67, A, "", "LD IYH,A", UOP2, LD_XYH_A, 0, 8)OPERATION(0x68, FD68, A, "", "LD IYL,B", UOP2, LD_XYL_B, 0, 8)OPERATION(0x69, FD69, A, "", "LD IYL,C", UOP2, LD_XYL_C, 0, 8)OPERATION(0x6A, FD6A, A, "", "LD IYL,D", UOP2, LD_XYL_D, 0, 8)OPERATION(0x6B, FD6B, A, "", "LD IYL,E", UOP2, LD_XYL_E, 0, 8)OPERATION(0x6C, FD6C, A, "", "LD IYL,IYH", UOP2, LD_XYL_XYH, 0, 8)OPERATION(0x6D, FD6D, A, "", "LD IYL,IYL", UOP2, LD_XYL_XYL, 0, 8)OPERATION(0x6E, FD6ENN, A, "", "LD L,(IY+%6)", UOP2, LD_L_iXY_NN, 0, 19)OPERATION(0x6F, FD6F, A, "", "LD IYL,A", UOP2, LD_XYL_A, 0, 8)OPERATION(0x70, FD70NN, A, "", "LD (IY+%6),B", UOP2, LD_iXY_NN_B, 0, 19)OPERATION(0x71, FD71NN, A, "", "LD (IY+%6),C", UOP2, LD_iXY_NN_C, 0, 19)OPERATION(0x72, FD72NN, A, "", "LD (IY+%6),D", UOP2, LD_iXY_NN_D, 0, 19)OPERATION(0x73, FD73NN, A, "", "LD (IY+%6),E", UOP2, LD_iXY_NN_E, 0, 19)OPERATION(0x74, FD74NN, A, "", "LD (IY+%6),H", UOP2, LD_iXY_NN_H, 0, 19)OPERATION(0x75, FD75NN, A, "", "LD (IY+%6),L", UOP2, LD_iXY_NN_L, 0, 19)OPERATION(0x76, FD76, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x77, FD77NN, A, "", "LD (IY+%6),A", UOP2, LD_iXY_NN_A, 0, 19)OPERATION(0x78, FD78, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x79, FD79, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x7A, FD7A, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x7B, FD7B, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x7C, FD7C, A, "", "LD A,IYH", UOP2, LD_A_XYH, 0, 8)OPERATION(0x7D, FD7D, A, "", "LD A,IYL", UOP2, LD_A_XYL, 0, 8)OPERATION(0x7E, FD7ENN, A, "", "LD A,(IY+%6)", UOP2, LD_A_iXY_NN, 0, 19)OPERATION(0x7F, FD7F, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x80, FD80, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x81, FD81, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x82, FD82, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x83, FD83, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x84, FD84, A, "", "ADD A,IYH", UOP2, ADD_XYH, 0, 8)OPERATION(0x85, FD85, A, "", "ADD A,IYL", UOP2, ADD_XYL, 0, 8)OPERATION(0x86, FD86NN, A, "", "ADD A,(IY+%6)", UOP2, ADD_iXY_NN, 0, 19)OPERATION(0x87, FD87, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x88, FD88, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x89, FD89, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x8A, FD8A, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x8B, FD8B, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x8C, FD8C, A, "", "ADC A,IYH", UOP2, ADC_XYH, 0, 8)OPERATION(0x8D, FD8D, A, "", "ADC A,IYL", UOP2, ADC_XYL, 0, 8)OPERATION(0x8E, FD8ENN, A, "", "ADC A,(IY+%6)", UOP2, ADC_iXY_NN, 0, 19)OPERATION(0x8F, FD8F, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x90, FD90, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x91, FD91, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x92, FD92, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x93, FD93, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x94, FD94, A, "", "SUB IYH", UOP2, SUB_XYH, 0, 8)OPERATION(0x95, FD95, A, "", "SUB IYL", UOP2, SUB_XYL, 0, 8)OPERATION(0x96, FD96NN, A, "", "SUB A,(IY+%6)", UOP2, SUB_iXY_NN, 0, 19)OPERATION(0x97, FD97, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x98, FD98, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x99, FD99, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x9A, FD9A, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x9B, FD9B, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0x9C, FD9C, A, "", "SBC IYH", UOP2, SBC_XYH, 0, 8)OPERATION(0x9D, FD9D, A, "", "SBC IYL", UOP2, SBC_XYL, 0, 8)OPERATION(0x9E, FD9ENN, A, "", "SBC A,(IY+%6)", UOP2, SBC_iXY_NN, 0, 19)OPERATION(0x9F, FD9F, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xA0, FDA0, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xA1, FDA1, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xA2, FDA2, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xA3, FDA3, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xA4, FDA4, A, "", "AND IYH", UOP2, AND_XYH, 0, 8)OPERATION(0xA5, FDA5, A, "", "AND IYL", UOP2, AND_XYL, 0, 8)OPERATION(0xA6, FDA6NN, A, "", "AND (IY+%6)", UOP2, AND_iXY_NN, 0, 19)OPERATION(0xA7, FDA7, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xA8, FDA8, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xA9, FDA9, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xAA, FDAA, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xAB, FDAB, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xAC, FDAC, A, "", "XOR IYH", UOP2, XOR_XYH, 0, 8)OPERATION(0xAD, FDAD, A, "", "XOR IYL", UOP2, XOR_XYL, 0, 8)OPERATION(0xAE, FDAENN, A, "", "XOR (IY+%6)", UOP2, XOR_iXY_NN, 0, 19)OPERATION(0xAF, FDAF, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xB0, FDB0, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xB1, FDB1, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xB2, FDB2, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xB3, FDB3, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xB4, FDB4, A, "", "OR IYH", UOP2, OR_XYH, 0, 8)OPERATION(0xB5, FDB5, A, "", "OR IYL", UOP2, OR_XYL, 0, 8)OPERATION(0xB6, FDB6NN, A, "", "OR (IY+%6)", UOP2, OR_iXY_NN, 0, 19)OPERATION(0xB7, FDB7, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xB8, FDB8, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xB9, FDB9, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xBA, FDBA, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xBB, FDBB, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xBC, FDBC, A, "", "CP IYH", UOP2, CP_XYH, 0, 8)OPERATION(0xBD, FDBD, A, "", "CP IYL", UOP2, CP_XYL, 0, 8)OPERATION(0xBE, FDBENN, A, "", "CP (IY+%6)", UOP2, CP_iXY_NN, 0, 19)OPERATION(0xBF, FDBF, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xC0, FDC0, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xC1, FDC1, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xC2, FDC2, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xC3, FDC3, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xC4, FDC4, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xC5, FDC5, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xC6, FDC6, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xC7, FDC7, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xC8, FDC8, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xC9, FDC9, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xCA, FDCA, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xCB, FDCB, A, "", "", 0, XYCB_OP, 0, 0)OPERATION(0xCC, FDCC, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xCD, FDCD, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xCE, FDCE, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xCF, FDCF, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xD0, FDD0, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xD1, FDD1, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xD2, FDD2, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xD3, FDD3, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xD4, FDD4, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xD5, FDD5, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xD6, FDD6, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xD7, FDD7, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xD8, FDD8, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xD9, FDD9, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xDA, FDDA, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xDB, FDDB, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xDC, FDDC, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xDD, FDDD, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xDE, FDDE, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xDF, FDDF, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xE0, FDE0, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xE1, FDE1, A, "", "POP IY", UOP2, POP_XY, 0, 14)OPERATION(0xE2, FDE2, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xE3, FDE3, A, "", "EX (SP),IY", UOP2, EX_iSP_XY, 0, 23)OPERATION(0xE4, FDE4, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xE5, FDE5, A, "", "PUSH IY", UOP2, PUSH_XY, 0, 15)OPERATION(0xE6, FDE6, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xE7, FDE7, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xE8, FDE8, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xE9, FDE9, B, "", "JP (IY)", UOP2, JP_iXY, 0, 8)OPERATION(0xEA, FDEA, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xEB, FDEB, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xEC, FDEC, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xED, FDED, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xEE, FDEE, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xEF, FDEF, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xF0, FDF0, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xF1, FDF1, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xF2, FDF2, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xF3, FDF3, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xF4, FDF4, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xF5, FDF5, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xF6, FDF6, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xF7, FDF7, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xF8, FDF8, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xF9, FDF9, A, "", "LD SP,IY", UOP2, LD_SP_XY, 0, 10)OPERATION(0xFA, FDFA, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xFB, FDFB, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xFC, FDFC, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xFD, FDFD, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xFE, FDFE, A, "", "", UOP2, UOP2, 0, 4)OPERATION(0xFF, FDFF, A, "", "", UOP2, UOP2, 0, 4)
\ No newline at end of file
@@ -1 +1 @@
-/* uSim opfdcb.h * Copyright (C) 2000, Tsurishaddai Williamson, tsuri@earthlink.net *  * This program is free software; you can redistribute it and/or * modify it under the terms of the GNU General Public License * as published by the Free Software Foundation; either version 2 * of the License, or (at your option) any later version. *  * This program is distributed in the hope that it will be useful, * but WITHOUT ANY WARRANTY; without even the implied warranty of * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the * GNU General Public License for more details. *  * You should have received a copy of the GNU General Public License * along with this program; if not, write to the Free Software * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA. *//**********************************************************************/OPERATION(0x00, FDCBNN00, A, "", "", UOP4, UOP4)OPERATION(0x01, FDCBNN01, A, "", "", UOP4, UOP4)OPERATION(0x02, FDCBNN02, A, "", "", UOP4, UOP4)OPERATION(0x03, FDCBNN03, A, "", "", UOP4, UOP4)OPERATION(0x04, FDCBNN04, A, "", "", UOP4, UOP4)OPERATION(0x05, FDCBNN05, A, "", "", UOP4, UOP4)OPERATION(0x06, FDCBNN06, A, "", "RLC (IY+%5)", UOP4, RLC_iIY_NN)OPERATION(0x07, FDCBNN07, A, "", "", UOP4, UOP4)OPERATION(0x08, FDCBNN08, A, "", "", UOP4, UOP4)OPERATION(0x09, FDCBNN09, A, "", "", UOP4, UOP4)OPERATION(0x0A, FDCBNN0A, A, "", "", UOP4, UOP4)OPERATION(0x0B, FDCBNN0B, A, "", "", UOP4, UOP4)OPERATION(0x0C, FDCBNN0C, A, "", "", UOP4, UOP4)OPERATION(0x0D, FDCBNN0D, A, "", "", UOP4, UOP4)OPERATION(0x0E, FDCBNN0E, A, "", "RRC (IY+%5)", UOP4, RRC_iIY_NN)OPERATION(0x0F, FDCBNN0F, A, "", "", UOP4, UOP4)OPERATION(0x10, FDCBNN10, A, "", "", UOP4, UOP4)OPERATION(0x11, FDCBNN11, A, "", "", UOP4, UOP4)OPERATION(0x12, FDCBNN12, A, "", "", UOP4, UOP4)OPERATION(0x13, FDCBNN13, A, "", "", UOP4, UOP4)OPERATION(0x14, FDCBNN14, A, "", "", UOP4, UOP4)OPERATION(0x15, FDCBNN15, A, "", "", UOP4, UOP4)OPERATION(0x16, FDCBNN16, A, "", "RL (IY+%5)", UOP4, RL_iIY_NN)OPERATION(0x17, FDCBNN17, A, "", "", UOP4, UOP4)OPERATION(0x18, FDCBNN18, A, "", "", UOP4, UOP4)OPERATION(0x19, FDCBNN19, A, "", "", UOP4, UOP4)OPERATION(0x1A, FDCBNN1A, A, "", "", UOP4, UOP4)OPERATION(0x1B, FDCBNN1B, A, "", "", UOP4, UOP4)OPERATION(0x1C, FDCBNN1C, A, "", "", UOP4, UOP4)OPERATION(0x1D, FDCBNN1D, A, "", "", UOP4, UOP4)OPERATION(0x1E, FDCBNN1E, A, "", "RR (IY+%5)", UOP4, RR_iIY_NN)OPERATION(0x1F, FDCBNN1F, A, "", "", UOP4, UOP4)OPERATION(0x20, FDCBNN20, A, "", "", UOP4, UOP4)OPERATION(0x21, FDCBNN21, A, "", "", UOP4, UOP4)OPERATION(0x22, FDCBNN22, A, "", "", UOP4, UOP4)OPERATION(0x23, FDCBNN23, A, "", "", UOP4, UOP4)OPERATION(0x24, FDCBNN24, A, "", "", UOP4, UOP4)OPERATION(0x25, FDCBNN25, A, "", "", UOP4, UOP4)OPERATION(0x26, FDCBNN26, A, "", "SLA (IY+%5)", UOP4, SLA_iIY_NN)OPERATION(0x27, FDCBNN27, A, "", "", UOP4, UOP4)OPERATION(0x28, FDCBNN28, A, "", "", UOP4, UOP4)OPERATION(0x29, FDCBNN29, A, "", "", UOP4, UOP4)OPERATION(0x2A, FDCBNN2A, A, "", "", UOP4, UOP4)OPERATION(0x2B, FDCBNN2B, A, "", "", UOP4, UOP4)OPERATION(0x2C, FDCBNN2C, A, "", "", UOP4, UOP4)OPERATION(0x2D, FDCBNN2D, A, "", "", UOP4, UOP4)OPERATION(0x2E, FDCBNN2E, A, "", "SRA (IY+%5)", UOP4, SRA_iIY_NN)OPERATION(0x2F, FDCBNN2F, A, "", "", UOP4, UOP4)OPERATION(0x30, FDCBNN30, A, "", "", UOP4, UOP4)OPERATION(0x31, FDCBNN31, A, "", "", UOP4, UOP4)OPERATION(0x32, FDCBNN32, A, "", "", UOP4, UOP4)OPERATION(0x33, FDCBNN33, A, "", "", UOP4, UOP4)OPERATION(0x34, FDCBNN34, A, "", "", UOP4, UOP4)OPERATION(0x35, FDCBNN35, A, "", "", UOP4, UOP4)OPERATION(0x36, FDCBNN36, A, "", "SLIA (IY+%5)", UOP4, SLIA_iIY_NN)OPERATION(0x37, FDCBNN37, A, "", "", UOP4, UOP4)OPERATION(0x38, FDCBNN38, A, "", "", UOP4, UOP4)OPERATION(0x39, FDCBNN39, A, "", "", UOP4, UOP4)OPERATION(0x3A, FDCBNN3A, A, "", "", UOP4, UOP4)OPERATION(0x3B, FDCBNN3B, A, "", "", UOP4, UOP4)OPERATION(0x3C, FDCBNN3C, A, "", "", UOP4, UOP4)OPERATION(0x3D, FDCBNN3D, A, "", "", UOP4, UOP4)OPERATION(0x3E, FDCBNN3E, A, "", "SRL (IY+%5)", UOP4, SRL_iIY_NN)OPERATION(0x3F, FDCBNN3F, A, "", "", UOP4, UOP4)OPERATION(0x40, FDCBNN40, A, "", "", UOP4, UOP4)OPERATION(0x41, FDCBNN41, A, "", "", UOP4, UOP4)OPERATION(0x42, FDCBNN42, A, "", "", UOP4, UOP4)OPERATION(0x43, FDCBNN43, A, "", "", UOP4, UOP4)OPERATION(0x44, FDCBNN44, A, "", "", UOP4, UOP4)OPERATION(0x45, FDCBNN45, A, "", "", UOP4, UOP4)OPERATION(0x46, FDCBNN46, A, "", "BIT 0,(IY+%5)", UOP4, BIT_0_iIY_NN)OPERATION(0x47, FDCBNN47, A, "", "", UOP4, UOP4)OPERATION(0x48, FDCBNN48, A, "", "", UOP4, UOP4)OPERATION(0x49, FDCBNN49, A, "", "", UOP4, UOP4)OPERATION(0x4A, FDCBNN4A, A, "", "", UOP4, UOP4)OPERATION(0x4B, FDCBNN4B, A, "", "", UOP4, UOP4)OPERATION(0x4C, FDCBNN4C, A, "", "", UOP4, UOP4)OPERATION(0x4D, FDCBNN4D, A, "", "", UOP4, UOP4)OPERATION(0x4E, FDCBNN4E, A, "", "BIT 1,(IY+%5)", UOP4, BIT_1_iIY_NN)OPERATION(0x4F, FDCBNN4F, A, "", "", UOP4, UOP4)OPERATION(0x50, FDCBNN50, A, "", "", UOP4, UOP4)OPERATION(0x51, FDCBNN51, A, "", "", UOP4, UOP4)OPERATION(0x52, FDCBNN52, A, "", "", UOP4, UOP4)OPERATION(0x53, FDCBNN53, A, "", "", UOP4, UOP4)OPERATION(0x54, FDCBNN54, A, "", "", UOP4, UOP4)OPERATION(0x55, FDCBNN55, A, "", "", UOP4, UOP4)OPERATION(0x56, FDCBNN56, A, "", "BIT 2,(IY+%5)", UOP4, BIT_2_iIY_NN)OPERATION(0x57, FDCBNN57, A, "", "", UOP4, UOP4)OPERATION(0x58, FDCBNN58, A, "", "", UOP4, UOP4)OPERATION(0x59, FDCBNN59, A, "", "", UOP4, UOP4)OPERATION(0x5A, FDCBNN5A, A, "", "", UOP4, UOP4)OPERATION(0x5B, FDCBNN5B, A, "", "", UOP4, UOP4)OPERATION(0x5C, FDCBNN5C, A, "", "", UOP4, UOP4)OPERATION(0x5D, FDCBNN5D, A, "", "", UOP4, UOP4)OPERATION(0x5E, FDCBNN5E, A, "", "BIT 3,(IY+%5)", UOP4, BIT_3_iIY_NN)OPERATION(0x5F, FDCBNN5F, A, "", "", UOP4, UOP4)OPERATION(0x60, FDCBNN60, A, "", "", UOP4, UOP4)OPERATION(0x61, FDCBNN61, A, "", "", UOP4, UOP4)OPERATION(0x62, FDCBNN62, A, "", "", UOP4, UOP4)OPERATION(0x63, FDCBNN63, A, "", "", UOP4, UOP4)OPERATION(0x64, FDCBNN64, A, "", "", UOP4, UOP4)OPERATION(0x65, FDCBNN65, A, "", "", UOP4, UOP4)OPERATION(0x66, FDCBNN66, A, "", "BIT 4,(IY+%5)", UOP4, BIT_4_iIY_NN)OPERATION(0x67, FDCBNN67, A, "", "", UOP4, UOP4)OPERATION(0x68, FDCBNN68, A, "", "", UOP4, UOP4)OPERATION(0x69, FDCBNN69, A, "", "", UOP4, UOP4)OPERATION(0x6A, FDCBNN6A, A, "", "", UOP4, UOP4)OPERATION(0x6B, FDCBNN6B, A, "", "", UOP4, UOP4)OPERATION(0x6C, FDCBNN6C, A, "", "", UOP4, UOP4)OPERATION(0x6D, FDCBNN6D, A, "", "", UOP4, UOP4)OPERATION(0x6E, FDCBNN6E, A, "", "BIT 5,(IY+%5)", UOP4, BIT_5_iIY_NN)OPERATION(0x6F, FDCBNN6F, A, "", "", UOP4, UOP4)OPERATION(0x70, FDCBNN70, A, "", "", UOP4, UOP4)OPERATION(0x71, FDCBNN71, A, "", "", UOP4, UOP4)OPERATION(0x72, FDCBNN72, A, "", "", UOP4, UOP4)OPERATION(0x73, FDCBNN73, A, "", "", UOP4, UOP4)OPERATION(0x74, FDCBNN74, A, "", "", UOP4, UOP4)OPERATION(0x75, FDCBNN75, A, "", "", UOP4, UOP4)OPERATION(0x76, FDCBNN76, A, "", "BIT 6,(IY+%5)", UOP4, BIT_6_iIY_NN)OPERATION(0x77, FDCBNN77, A, "", "", UOP4, UOP4)OPERATION(0x78, FDCBNN78, A, "", "", UOP4, UOP4)OPERATION(0x79, FDCBNN79, A, "", "", UOP4, UOP4)OPERATION(0x7A, FDCBNN7A, A, "", "", UOP4, UOP4)OPERATION(0x7B, FDCBNN7B, A, "", "", UOP4, UOP4)OPERATION(0x7C, FDCBNN7C, A, "", "", UOP4, UOP4)OPERATION(0x7D, FDCBNN7D, A, "", "", UOP4, UOP4)OPERATION(0x7E, FDCBNN7E, A, "", "BIT 7,(IY+%5)", UOP4, BIT_7_iIY_NN)OPERATION(0x7F, FDCBNN7F, A, "", "", UOP4, UOP4)OPERATION(0x80, FDCBNN80, A, "", "", UOP4, UOP4)OPERATION(0x81, FDCBNN81, A, "", "", UOP4, UOP4)OPERATION(0x82, FDCBNN82, A, "", "", UOP4, UOP4)OPERATION(0x83, FDCBNN83, A, "", "", UOP4, UOP4)OPERATION(0x84, FDCBNN84, A, "", "", UOP4, UOP4)OPERATION(0x85, FDCBNN85, A, "", "", UOP4, UOP4)OPERATION(0x86, FDCBNN86, A, "", "RES 0,(IY+%5)", UOP4, RES_0_iIY_NN)OPERATION(0x87, FDCBNN87, A, "", "", UOP4, UOP4)OPERATION(0x88, FDCBNN88, A, "", "", UOP4, UOP4)OPERATION(0x89, FDCBNN89, A, "", "", UOP4, UOP4)OPERATION(0x8A, FDCBNN8A, A, "", "", UOP4, UOP4)OPERATION(0x8B, FDCBNN8B, A, "", "", UOP4, UOP4)OPERATION(0x8C, FDCBNN8C, A, "", "", UOP4, UOP4)OPERATION(0x8D, FDCBNN8D, A, "", "", UOP4, UOP4)OPERATION(0x8E, FDCBNN8E, A, "", "RES 1,(IY+%5)", UOP4, RES_1_iIY_NN)OPERATION(0x8F, FDCBNN8F, A, "", "", UOP4, UOP4)OPERATION(0x90, FDCBNN90, A, "", "", UOP4, UOP4)OPERATION(0x91, FDCBNN91, A, "", "", UOP4, UOP4)OPERATION(0x92, FDCBNN92, A, "", "", UOP4, UOP4)OPERATION(0x93, FDCBNN93, A, "", "", UOP4, UOP4)OPERATION(0x94, FDCBNN94, A, "", "", UOP4, UOP4)OPERATION(0x95, FDCBNN95, A, "", "", UOP4, UOP4)OPERATION(0x96, FDCBNN96, A, "", "RES 2,(IY+%5)", UOP4, RES_2_iIY_NN)OPERATION(0x97, FDCBNN97, A, "", "", UOP4, UOP4)OPERATION(0x98, FDCBNN98, A, "", "", UOP4, UOP4)OPERATION(0x99, FDCBNN99, A, "", "", UOP4, UOP4)OPERATION(0x9A, FDCBNN9A, A, "", "", UOP4, UOP4)OPERATION(0x9B, FDCBNN9B, A, "", "", UOP4, UOP4)OPERATION(0x9C, FDCBNN9C, A, "", "", UOP4, UOP4)OPERATION(0x9D, FDCBNN9D, A, "", "", UOP4, UOP4)OPERATION(0x9E, FDCBNN9E, A, "", "RES 3,(IY+%5)", UOP4, RES_3_iIY_NN)OPERATION(0x9F, FDCBNN9F, A, "", "", UOP4, UOP4)OPERATION(0xA0, FDCBNNA0, A, "", "", UOP4, UOP4)OPERATION(0xA1, FDCBNNA1, A, "", "", UOP4, UOP4)OPERATION(0xA2, FDCBNNA2, A, "", "", UOP4, UOP4)OPERATION(0xA3, FDCBNNA3, A, "", "", UOP4, UOP4)OPERATION(0xA4, FDCBNNA4, A, "", "", UOP4, UOP4)OPERATION(0xA5, FDCBNNA5, A, "", "", UOP4, UOP4)OPERATION(0xA6, FDCBNNA6, A, "", "RES 4,(IY+%5)", UOP4, RES_4_iIY_NN)OPERATION(0xA7, FDCBNNA7, A, "", "", UOP4, UOP4)OPERATION(0xA8, FDCBNNA8, A, "", "", UOP4, UOP4)OPERATION(0xA9, FDCBNNA9, A, "", "", UOP4, UOP4)OPERATION(0xAA, FDCBNNAA, A, "", "", UOP4, UOP4)OPERATION(0xAB, FDCBNNAB, A, "", "", UOP4, UOP4)OPERATION(0xAC, FDCBNNAC, A, "", "", UOP4, UOP4)OPERATION(0xAD, FDCBNNAD, A, "", "", UOP4, UOP4)OPERATION(0xAE, FDCBNNAE, A, "", "RES 5,(IY+%5)", UOP4, RES_5_iIY_NN)OPERATION(0xAF, FDCBNNAF, A, "", "", UOP4, UOP4)OPERATION(0xB0, FDCBNNB0, A, "", "", UOP4, UOP4)OPERATION(0xB1, FDCBNNB1, A, "", "", UOP4, UOP4)OPERATION(0xB2, FDCBNNB2, A, "", "", UOP4, UOP4)OPERATION(0xB3, FDCBNNB3, A, "", "", UOP4, UOP4)OPERATION(0xB4, FDCBNNB4, A, "", "", UOP4, UOP4)OPERATION(0xB5, FDCBNNB5, A, "", "", UOP4, UOP4)OPERATION(0xB6, FDCBNNB6, A, "", "RES 6,(IY+%5)", UOP4, RES_6_iIY_NN)OPERATION(0xB7, FDCBNNB7, A, "", "", UOP4, UOP4)OPERATION(0xB8, FDCBNNB8, A, "", "", UOP4, UOP4)OPERATION(0xB9, FDCBNNB9, A, "", "", UOP4, UOP4)OPERATION(0xBA, FDCBNNBA, A, "", "", UOP4, UOP4)OPERATION(0xBB, FDCBNNBB, A, "", "", UOP4, UOP4)OPERATION(0xBC, FDCBNNBC, A, "", "", UOP4, UOP4)OPERATION(0xBD, FDCBNNBD, A, "", "", UOP4, UOP4)OPERATION(0xBE, FDCBNNBE, A, "", "RES 7,(IY+%5)", UOP4, RES_7_iIY_NN)OPERATION(0xBF, FDCBNNBF, A, "", "", UOP4, UOP4)OPERATION(0xC0, FDCBNNC0, A, "", "", UOP4, UOP4)OPERATION(0xC1, FDCBNNC1, A, "", "", UOP4, UOP4)OPERATION(0xC2, FDCBNNC2, A, "", "", UOP4, UOP4)OPERATION(0xC3, FDCBNNC3, A, "", "", UOP4, UOP4)OPERATION(0xC4, FDCBNNC4, A, "", "", UOP4, UOP4)OPERATION(0xC5, FDCBNNC5, A, "", "", UOP4, UOP4)OPERATION(0xC6, FDCBNNC6, A, "", "SET 0,(IY+%5)", UOP4, SET_0_iIY_NN)OPERATION(0xC7, FDCBNNC7, A, "", "", UOP4, UOP4)OPERATION(0xC8, FDCBNNC8, A, "", "", UOP4, UOP4)OPERATION(0xC9, FDCBNNC9, A, "", "", UOP4, UOP4)OPERATION(0xCA, FDCBNNCA, A, "", "", UOP4, UOP4)OPERATION(0xCB, FDCBNNCB, A, "", "", UOP4, UOP4)OPERATION(0xCC, FDCBNNCC, A, "", "", UOP4, UOP4)OPERATION(0xCD, FDCBNNCD, A, "", "", UOP4, UOP4)OPERATION(0xCE, FDCBNNCE, A, "", "SET 1,(IY+%5)", UOP4, SET_1_iIY_NN)OPERATION(0xCF, FDCBNNCF, A, "", "", UOP4, UOP4)OPERATION(0xD0, FDCBNND0, A, "", "", UOP4, UOP4)OPERATION(0xD1, FDCBNND1, A, "", "", UOP4, UOP4)OPERATION(0xD2, FDCBNND2, A, "", "", UOP4, UOP4)OPERATION(0xD3, FDCBNND3, A, "", "", UOP4, UOP4)OPERATION(0xD4, FDCBNND4, A, "", "", UOP4, UOP4)OPERATION(0xD5, FDCBNND5, A, "", "", UOP4, UOP4)OPERATION(0xD6, FDCBNND6, A, "", "SET 2,(IY+%5)", UOP4, SET_2_iIY_NN)OPERATION(0xD7, FDCBNND7, A, "", "", UOP4, UOP4)OPERATION(0xD8, FDCBNND8, A, "", "", UOP4, UOP4)OPERATION(0xD9, FDCBNND9, A, "", "", UOP4, UOP4)OPERATION(0xDA, FDCBNNDA, A, "", "", UOP4, UOP4)OPERATION(0xDB, FDCBNNDB, A, "", "", UOP4, UOP4)OPERATION(0xDC, FDCBNNDC, A, "", "", UOP4, UOP4)OPERATION(0xDD, FDCBNNDD, A, "", "", UOP4, UOP4)OPERATION(0xDE, FDCBNNDE, A, "", "SET 3,(IY+%5)", UOP4, SET_3_iIY_NN)OPERATION(0xDF, FDCBNNDF, A, "", "", UOP4, UOP4)OPERATION(0xE0, FDCBNNE0, A, "", "", UOP4, UOP4)OPERATION(0xE1, FDCBNNE1, A, "", "", UOP4, UOP4)OPERATION(0xE2, FDCBNNE2, A, "", "", UOP4, UOP4)OPERATION(0xE3, FDCBNNE3, A, "", "", UOP4, UOP4)OPERATION(0xE4, FDCBNNE4, A, "", "", UOP4, UOP4)OPERATION(0xE5, FDCBNNE5, A, "", "", UOP4, UOP4)OPERATION(0xE6, FDCBNNE6, A, "", "SET 4,(IY+%5)", UOP4, SET_4_iIY_NN)OPERATION(0xE7, FDCBNNE7, A, "", "", UOP4, UOP4)OPERATION(0xE8, FDCBNNE8, A, "", "", UOP4, UOP4)OPERATION(0xE9, FDCBNNE9, A, "", "", UOP4, UOP4)OPERATION(0xEA, FDCBNNEA, A, "", "", UOP4, UOP4)OPERATION(0xEB, FDCBNNEB, A, "", "", UOP4, UOP4)OPERATION(0xEC, FDCBNNEC, A, "", "", UOP4, UOP4)OPERATION(0xED, FDCBNNED, A, "", "", UOP4, UOP4)OPERATION(0xEE, FDCBNNEE, A, "", "SET 5,(IY+%5)", UOP4, SET_5_iIY_NN)OPERATION(0xEF, FDCBNNEF, A, "", "", UOP4, UOP4)OPERATION(0xF0, FDCBNNF0, A, "", "", UOP4, UOP4)OPERATION(0xF1, FDCBNNF1, A, "", "", UOP4, UOP4)OPERATION(0xF2, FDCBNNF2, A, "", "", UOP4, UOP4)OPERATION(0xF3, FDCBNNF3, A, "", "", UOP4, UOP4)OPERATION(0xF4, FDCBNNF4, A, "", "", UOP4, UOP4)OPERATION(0xF5, FDCBNNF5, A, "", "", UOP4, UOP4)OPERATION(0xF6, FDCBNNF6, A, "", "SET 6,(IY+%5)", UOP4, SET_6_iIY_NN)OPERATION(0xF7, FDCBNNF7, A, "", "", UOP4, UOP4)OPERATION(0xF8, FDCBNNF8, A, "", "", UOP4, UOP4)OPERATION(0xF9, FDCBNNF9, A, "", "", UOP4, UOP4)OPERATION(0xFA, FDCBNNFA, A, "", "", UOP4, UOP4)OPERATION(0xFB, FDCBNNFB, A, "", "", UOP4, UOP4)OPERATION(0xFC, FDCBNNFC, A, "", "", UOP4, UOP4)OPERATION(0xFD, FDCBNNFD, A, "", "", UOP4, UOP4)OPERATION(0xFE, FDCBNNFE, A, "", "SET 7,(IY+%5)", UOP4, SET_7_iIY_NN)OPERATION(0xFF, FDCBNNFF, A, "", "", UOP4, UOP4)
\ No newline at end of file
+/* uSim opfdcb.h * Copyright (C) 2000, Tsurishaddai Williamson, tsuri@earthlink.net *  * This program is free software; you can redistribute it and/or * modify it under the terms of the GNU General Public License * as published by the Free Software Foundation; either version 2 * of the License, or (at your option) any later version. *  * This program is distributed in the hope that it will be useful, * but WITHOUT ANY WARRANTY; without even the implied warranty of * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the * GNU General Public License for more details. *  * You should have received a copy of the GNU General Public License * along with this program; if not, write to the Free Software * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA. *//**********************************************************************/OPERATION(0x00, FDCBNN00, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x01, FDCBNN01, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x02, FDCBNN02, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x03, FDCBNN03, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x04, FDCBNN04, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x05, FDCBNN05, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x06, FDCBNN06, A, "", "RLC (IY+%5)", UOP4, RLC_iXY_NN, 0, 23)OPERATION(0x07, FDCBNN07, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x08, FDCBNN08, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x09, FDCBNN09, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x0A, FDCBNN0A, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x0B, FDCBNN0B, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x0C, FDCBNN0C, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x0D, FDCBNN0D, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x0E, FDCBNN0E, A, "", "RRC (IY+%5)", UOP4, RRC_iXY_NN, 0, 23)OPERATION(0x0F, FDCBNN0F, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x10, FDCBNN10, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x11, FDCBNN11, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x12, FDCBNN12, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x13, FDCBNN13, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x14, FDCBNN14, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x15, FDCBNN15, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x16, FDCBNN16, A, "", "RL (IY+%5)", UOP4, RL_iXY_NN, 0, 23)OPERATION(0x17, FDCBNN17, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x18, FDCBNN18, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x19, FDCBNN19, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x1A, FDCBNN1A, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x1B, FDCBNN1B, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x1C, FDCBNN1C, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x1D, FDCBNN1D, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x1E, FDCBNN1E, A, "", "RR (IY+%5)", UOP4, RR_iXY_NN, 0, 23)OPERATION(0x1F, FDCBNN1F, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x20, FDCBNN20, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x21, FDCBNN21, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x22, FDCBNN22, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x23, FDCBNN23, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x24, FDCBNN24, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x25, FDCBNN25, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x26, FDCBNN26, A, "", "SLA (IY+%5)", UOP4, SLA_iXY_NN, 0, 23)OPERATION(0x27, FDCBNN27, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x28, FDCBNN28, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x29, FDCBNN29, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x2A, FDCBNN2A, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x2B, FDCBNN2B, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x2C, FDCBNN2C, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x2D, FDCBNN2D, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x2E, FDCBNN2E, A, "", "SRA (IY+%5)", UOP4, SRA_iXY_NN, 0, 23)OPERATION(0x2F, FDCBNN2F, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x30, FDCBNN30, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x31, FDCBNN31, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x32, FDCBNN32, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x33, FDCBNN33, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x34, FDCBNN34, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x35, FDCBNN35, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x36, FDCBNN36, A, "", "SLIA (IY+%5)", UOP4, SLIA_iXY_NN, 0, 23)OPERATION(0x37, FDCBNN37, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x38, FDCBNN38, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x39, FDCBNN39, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x3A, FDCBNN3A, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x3B, FDCBNN3B, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x3C, FDCBNN3C, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x3D, FDCBNN3D, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x3E, FDCBNN3E, A, "", "SRL (IY+%5)", UOP4, SRL_iXY_NN, 0, 23)OPERATION(0x3F, FDCBNN3F, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x40, FDCBNN40, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x41, FDCBNN41, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x42, FDCBNN42, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x43, FDCBNN43, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x44, FDCBNN44, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x45, FDCBNN45, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x46, FDCBNN46, A, "", "BIT 0,(IY+%5)", UOP4, BIT_0_iXY_NN, 0, 20)OPERATION(0x47, FDCBNN47, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x48, FDCBNN48, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x49, FDCBNN49, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x4A, FDCBNN4A, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x4B, FDCBNN4B, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x4C, FDCBNN4C, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x4D, FDCBNN4D, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x4E, FDCBNN4E, A, "", "BIT 1,(IY+%5)", UOP4, BIT_1_iXY_NN, 0, 20)OPERATION(0x4F, FDCBNN4F, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x50, FDCBNN50, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x51, FDCBNN51, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x52, FDCBNN52, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x53, FDCBNN53, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x54, FDCBNN54, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x55, FDCBNN55, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x56, FDCBNN56, A, "", "BIT 2,(IY+%5)", UOP4, BIT_2_iXY_NN, 0, 20)OPERATION(0x57, FDCBNN57, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x58, FDCBNN58, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x59, FDCBNN59, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x5A, FDCBNN5A, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x5B, FDCBNN5B, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x5C, FDCBNN5C, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x5D, FDCBNN5D, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x5E, FDCBNN5E, A, "", "BIT 3,(IY+%5)", UOP4, BIT_3_iXY_NN, 0, 20)OPERATION(0x5F, FDCBNN5F, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x60, FDCBNN60, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x61, FDCBNN61, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x62, FDCBNN62, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x63, FDCBNN63, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x64, FDCBNN64, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x65, FDCBNN65, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x66, FDCBNN66, A, "", "BIT 4,(IY+%5)", UOP4, BIT_4_iXY_NN, 0, 20)OPERATION(0x67, FDCBNN67, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x68, FDCBNN68, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x69, FDCBNN69, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x6A, FDCBNN6A, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x6B, FDCBNN6B, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x6C, FDCBNN6C, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x6D, FDCBNN6D, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x6E, FDCBNN6E, A, "", "BIT 5,(IY+%5)", UOP4, BIT_5_iXY_NN, 0, 20)OPERATION(0x6F, FDCBNN6F, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x70, FDCBNN70, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x71, FDCBNN71, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x72, FDCBNN72, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x73, FDCBNN73, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x74, FDCBNN74, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x75, FDCBNN75, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x76, FDCBNN76, A, "", "BIT 6,(IY+%5)", UOP4, BIT_6_iXY_NN, 0, 20)OPERATION(0x77, FDCBNN77, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x78, FDCBNN78, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x79, FDCBNN79, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x7A, FDCBNN7A, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x7B, FDCBNN7B, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x7C, FDCBNN7C, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x7D, FDCBNN7D, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x7E, FDCBNN7E, A, "", "BIT 7,(IY+%5)", UOP4, BIT_7_iXY_NN, 0, 20)OPERATION(0x7F, FDCBNN7F, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x80, FDCBNN80, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x81, FDCBNN81, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x82, FDCBNN82, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x83, FDCBNN83, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x84, FDCBNN84, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x85, FDCBNN85, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x86, FDCBNN86, A, "", "RES 0,(IY+%5)", UOP4, RES_0_iXY_NN, 0, 23)OPERATION(0x87, FDCBNN87, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x88, FDCBNN88, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x89, FDCBNN89, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x8A, FDCBNN8A, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x8B, FDCBNN8B, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x8C, FDCBNN8C, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x8D, FDCBNN8D, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x8E, FDCBNN8E, A, "", "RES 1,(IY+%5)", UOP4, RES_1_iXY_NN, 0, 23)OPERATION(0x8F, FDCBNN8F, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x90, FDCBNN90, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x91, FDCBNN91, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x92, FDCBNN92, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x93, FDCBNN93, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x94, FDCBNN94, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x95, FDCBNN95, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x96, FDCBNN96, A, "", "RES 2,(IY+%5)", UOP4, RES_2_iXY_NN, 0, 23)OPERATION(0x97, FDCBNN97, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x98, FDCBNN98, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x99, FDCBNN99, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x9A, FDCBNN9A, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x9B, FDCBNN9B, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x9C, FDCBNN9C, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x9D, FDCBNN9D, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0x9E, FDCBNN9E, A, "", "RES 3,(IY+%5)", UOP4, RES_3_iXY_NN, 0, 23)OPERATION(0x9F, FDCBNN9F, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xA0, FDCBNNA0, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xA1, FDCBNNA1, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xA2, FDCBNNA2, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xA3, FDCBNNA3, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xA4, FDCBNNA4, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xA5, FDCBNNA5, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xA6, FDCBNNA6, A, "", "RES 4,(IY+%5)", UOP4, RES_4_iXY_NN, 0, 23)OPERATION(0xA7, FDCBNNA7, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xA8, FDCBNNA8, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xA9, FDCBNNA9, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xAA, FDCBNNAA, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xAB, FDCBNNAB, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xAC, FDCBNNAC, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xAD, FDCBNNAD, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xAE, FDCBNNAE, A, "", "RES 5,(IY+%5)", UOP4, RES_5_iXY_NN, 0, 23)OPERATION(0xAF, FDCBNNAF, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xB0, FDCBNNB0, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xB1, FDCBNNB1, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xB2, FDCBNNB2, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xB3, FDCBNNB3, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xB4, FDCBNNB4, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xB5, FDCBNNB5, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xB6, FDCBNNB6, A, "", "RES 6,(IY+%5)", UOP4, RES_6_iXY_NN, 0, 23)OPERATION(0xB7, FDCBNNB7, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xB8, FDCBNNB8, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xB9, FDCBNNB9, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xBA, FDCBNNBA, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xBB, FDCBNNBB, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xBC, FDCBNNBC, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xBD, FDCBNNBD, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xBE, FDCBNNBE, A, "", "RES 7,(IY+%5)", UOP4, RES_7_iXY_NN, 0, 23)OPERATION(0xBF, FDCBNNBF, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xC0, FDCBNNC0, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xC1, FDCBNNC1, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xC2, FDCBNNC2, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xC3, FDCBNNC3, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xC4, FDCBNNC4, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xC5, FDCBNNC5, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xC6, FDCBNNC6, A, "", "SET 0,(IY+%5)", UOP4, SET_0_iXY_NN, 0, 23)OPERATION(0xC7, FDCBNNC7, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xC8, FDCBNNC8, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xC9, FDCBNNC9, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xCA, FDCBNNCA, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xCB, FDCBNNCB, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xCC, FDCBNNCC, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xCD, FDCBNNCD, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xCE, FDCBNNCE, A, "", "SET 1,(IY+%5)", UOP4, SET_1_iXY_NN, 0, 23)OPERATION(0xCF, FDCBNNCF, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xD0, FDCBNND0, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xD1, FDCBNND1, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xD2, FDCBNND2, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xD3, FDCBNND3, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xD4, FDCBNND4, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xD5, FDCBNND5, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xD6, FDCBNND6, A, "", "SET 2,(IY+%5)", UOP4, SET_2_iXY_NN, 0, 23)OPERATION(0xD7, FDCBNND7, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xD8, FDCBNND8, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xD9, FDCBNND9, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xDA, FDCBNNDA, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xDB, FDCBNNDB, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xDC, FDCBNNDC, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xDD, FDCBNNDD, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xDE, FDCBNNDE, A, "", "SET 3,(IY+%5)", UOP4, SET_3_iXY_NN, 0, 23)OPERATION(0xDF, FDCBNNDF, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xE0, FDCBNNE0, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xE1, FDCBNNE1, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xE2, FDCBNNE2, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xE3, FDCBNNE3, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xE4, FDCBNNE4, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xE5, FDCBNNE5, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xE6, FDCBNNE6, A, "", "SET 4,(IY+%5)", UOP4, SET_4_iXY_NN, 0, 23)OPERATION(0xE7, FDCBNNE7, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xE8, FDCBNNE8, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xE9, FDCBNNE9, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xEA, FDCBNNEA, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xEB, FDCBNNEB, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xEC, FDCBNNEC, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xED, FDCBNNED, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xEE, FDCBNNEE, A, "", "SET 5,(IY+%5)", UOP4, SET_5_iXY_NN, 0, 23)OPERATION(0xEF, FDCBNNEF, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xF0, FDCBNNF0, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xF1, FDCBNNF1, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xF2, FDCBNNF2, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xF3, FDCBNNF3, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xF4, FDCBNNF4, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xF5, FDCBNNF5, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xF6, FDCBNNF6, A, "", "SET 6,(IY+%5)", UOP4, SET_6_iXY_NN, 0, 23)OPERATION(0xF7, FDCBNNF7, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xF8, FDCBNNF8, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xF9, FDCBNNF9, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xFA, FDCBNNFA, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xFB, FDCBNNFB, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xFC, FDCBNNFC, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xFD, FDCBNNFD, A, "", "", UOP4, UOP4, 0, 4)OPERATION(0xFE, FDCBNNFE, A, "", "SET 7,(IY+%5)", UOP4, SET_7_iXY_NN, 0, 23)OPERATION(0xFF, FDCBNNFF, A, "", "", UOP4, UOP4, 0, 4)
\ No newline at end of file
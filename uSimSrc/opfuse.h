@@ -0,0 +1,98 @@
+/* uSim opfuse.h GENERATED BY uSimTrace -F32 CPM.TRC */
+/* FUSE(FIRST, SECOND, F1, F2), see FuseBlockOps() in cpu.c. */
+
+/* OR A / RET Z, 111073 */
+FUSE(0xB7, 0xC8, OR_A, RET_Z)
+
+/* INC BC / INC DE, 65824 */
+FUSE(0x03, 0x13, INC_BC, INC_DE)
+
+/* LD A,(BC) / LD (DE),A, 65824 */
+FUSE(0x0A, 0x12, LD_A_iBC, LD_iDE_A)
+
+/* INC DE / LD A,D, 65536 */
+FUSE(0x13, 0x7A, INC_DE, LD_A_D)
+
+/* LD A,D / OR E, 65536 */
+FUSE(0x7A, 0xB3, LD_A_D, OR_E)
+
+/* INC HL / DEC A, 25926 */
+FUSE(0x23, 0x3D, INC_HL, DEC_A)
+
+/* ADD HL,HL / EX DE,HL, 25782 */
+FUSE(0x29, 0xEB, ADD_HL_HL, EX_DE_HL)
+
+/* POP BC / PUSH BC, 25750 */
+FUSE(0xC1, 0xC5, POP_BC, PUSH_BC)
+
+/* LD E,(HL) / INC HL, 25250 */
+FUSE(0x5E, 0x23, LD_E_iHL, INC_HL)
+
+/* INC HL / LD D,(HL), 24752 */
+FUSE(0x23, 0x56, INC_HL, LD_D_iHL)
+
+/* EX DE,HL / JP (HL), 22937 */
+FUSE(0xEB, 0xE9, EX_DE_HL, JP_iHL)
+
+/* INC DE / INC HL, 20072 */
+FUSE(0x13, 0x23, INC_DE, INC_HL)
+
+/* INC HL / DEC C, 18944 */
+FUSE(0x23, 0x0D, INC_HL, DEC_C)
+
+/* SUB A,C / LD L,A, 17658 */
+FUSE(0x91, 0x6F, SUB_C, LD_L_A)
+
+/* SBC A,B / LD H,A, 17658 */
+FUSE(0x98, 0x67, SBC_B, LD_H_A)
+
+/* POP BC / RET, 17059 */
+FUSE(0xC1, 0xC9, POP_BC, RET)
+
+/* ADD HL,DE / ADD HL,DE, 16100 */
+FUSE(0x19, 0x19, ADD_HL_DE, ADD_HL_DE)
+
+/* ADD HL,DE / LD E,(HL), 15512 */
+FUSE(0x19, 0x5E, ADD_HL_DE, LD_E_iHL)
+
+/* LD A,(DE) / LD (HL),A, 15313 */
+FUSE(0x1A, 0x77, LD_A_iDE, LD_iHL_A)
+
+/* EX DE,HL / LD A,E, 14612 */
+FUSE(0xEB, 0x7B, EX_DE_HL, LD_A_E)
+
+/* LD B,H / RET, 14611 */
+FUSE(0x44, 0xC9, LD_B_H, RET)
+
+/* LD A,L / LD B,H, 14611 */
+FUSE(0x7D, 0x44, LD_A_L, LD_B_H)
+
+/* ADD HL,DE / LD A,(HL), 13932 */
+FUSE(0x19, 0x7E, ADD_HL_DE, LD_A_iHL)
+
+/* POP BC / LD A,C, 13273 */
+FUSE(0xC1, 0x79, POP_BC, LD_A_C)
+
+/* LD A,H / SBC A,B, 12651 */
+FUSE(0x7C, 0x98, LD_A_H, SBC_B)
+
+/* LD H,A / INC DE, 12336 */
+FUSE(0x67, 0x13, LD_H_A, INC_DE)
+
+/* LD L,A / LD A,H, 12336 */
+FUSE(0x6F, 0x7C, LD_L_A, LD_A_H)
+
+/* ADC A,L / SUB A,C, 12336 */
+FUSE(0x8D, 0x91, ADC_L, SUB_C)
+
+/* SUB A,A / ADD HL,HL, 12336 */
+FUSE(0x97, 0x29, SUB_A, ADD_HL_HL)
+
+/* EX DE,HL / ADC A,L, 12336 */
+FUSE(0xEB, 0x8D, EX_DE_HL, ADC_L)
+
+/* EX DE,HL / SUB A,A, 12336 */
+FUSE(0xEB, 0x97, EX_DE_HL, SUB_A)
+
+/* POP AF / DEC A, 12336 */
+FUSE(0xF1, 0x3D, POP_AF, DEC_A)
@@ -0,0 +1,413 @@
+/* uSim profile.c
+ * Copyright (C) 2000, Tsurishaddai Williamson, tsuri@earthlink.net
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+/**********************************************************************/
+
+#include "ustdio.h"
+#include <string.h>
+#include <stdlib.h>
+
+#include "memory.h"
+#include "system.h"
+#include "cpu.h"
+#include "dasm.h"
+#include "asm.h"
+#include "profile.h"
+
+/**********************************************************************/
+#pragma mark *** PROFILE ***
+
+/* The opcode tables, one for each prefix. */
+enum {
+	kOpcodes,
+#ifdef Z80
+	kOpcodesCB,
+	kOpcodesDD,
+	kOpcodesED,
+	kOpcodesFD,
+	kOpcodesDDCB,
+	kOpcodesFDCB,
+#endif
+	kMaxOpcodes
+};
+
+/* A range of code is split where there is no instruction counted */
+/* for more than the longest instruction, or in a sampled profile, */
+/* which misses most instructions, for more than kMaxSampleGap. */
+#define kMaxGap 4
+#define kMaxSampleGap 16
+
+/* The report shows this many opcodes. */
+#define kReportOpcodes 16
+
+typedef struct Profile Profile;
+typedef Profile *ProfilePtr;
+
+struct Profile {
+	unsigned long period;
+	unsigned long count;
+	unsigned long address[65536];
+	unsigned long opcode[kMaxOpcodes][256];
+	unsigned long input[256];
+	unsigned long output[256];
+};
+
+static MACHINE ProfilePtr gProfile;
+
+MACHINE unsigned long gProfilePeriod;
+
+/* gProfileSincePoll counts the instructions sampled since the poll. */
+static MACHINE unsigned long gProfileSincePoll;
+
+/* A Hot is a range of code, or an opcode, in the report. */
+typedef struct Hot Hot;
+typedef Hot *HotPtr;
+
+struct Hot {
+	unsigned long count;
+	Word first;
+	Word last;
+	Word hottest;
+};
+
+/* ProfileOpen() starts a new profile, with all counts zero. */
+/* Returns zero if there was an error. */
+int ProfileOpen(unsigned long period)
+{
+
+	if ((gProfile == 0) && ((gProfile = malloc(sizeof(Profile))) == 0))
+		return 0;
+
+	memset(gProfile, 0, sizeof(Profile));
+	gProfile->period = period;
+
+	gProfilePeriod = period;
+	gProfileSincePoll = 0;
+
+	return 1;
+
+}
+
+/* ProfileStop() stops sampling, the counts are kept for the report. */
+void ProfileStop(void)
+{
+
+	gProfilePeriod = 0;
+
+}
+
+/* ProfileClose() frees the profile. */
+void ProfileClose(void)
+{
+
+	free(gProfile);
+	gProfile = 0;
+
+	gProfilePeriod = 0;
+
+}
+
+/* ProfileInstruction() counts the instruction about to execute. */
+void ProfileInstruction(CpuStatePtr s)
+{
+	Word pc = s->pc.word;
+	unsigned table = kOpcodes;
+	Byte opcode = RdByte(pc);
+
+	if (gProfile == 0)
+		return;
+
+	gProfile->count++;
+	gProfile->address[pc]++;
+
+#ifdef Z80
+	switch (opcode) {
+	case 0xCB:
+		table = kOpcodesCB;
+		opcode = RdByte(pc + 1);
+		break;
+	case 0xDD:
+	case 0xFD:
+		if (RdByte(pc + 1) == 0xCB) {
+			table = (opcode == 0xDD) ? kOpcodesDDCB : kOpcodesFDCB;
+			opcode = RdByte(pc + 3);
+		}
+		else {
+			table = (opcode == 0xDD) ? kOpcodesDD : kOpcodesFD;
+			opcode = RdByte(pc + 1);
+		}
+		break;
+	case 0xED:
+		table = kOpcodesED;
+		opcode = RdByte(pc + 1);
+		/* IN r,(C), INI, IND, INIR, INDR */
+		if (((opcode & 0xC7) == 0x40) || ((opcode & 0xE7) == 0xA2))
+			gProfile->input[s->bc.byte.low]++;
+		/* OUT (C),r, OUTI, OUTD, OTIR, OTDR */
+		else if (((opcode & 0xC7) == 0x41) || ((opcode & 0xE7) == 0xA3))
+			gProfile->output[s->bc.byte.low]++;
+		break;
+	}
+#endif
+
+	gProfile->opcode[table][opcode]++;
+
+	/* IN A,(port) and OUT (port),A */
+	if (table == kOpcodes) {
+		if (opcode == 0xDB)
+			gProfile->input[RdByte(pc + 1)]++;
+		else if (opcode == 0xD3)
+			gProfile->output[RdByte(pc + 1)]++;
+	}
+
+}
+
+/* ProfileSample() samples the instruction about to execute and starts */
+/* the next sampling period. Returns non-zero when the system poll, */
+/* every kCheckForInterrupts instructions, is due. */
+int ProfileSample(void)
+{
+	unsigned long skip = kCheckForInterrupts - gProfilePeriod;
+#ifdef WATCHPOINTS
+	int armed = gWatchArmed;
+
+	/* The profiler's own reads are not watched. */
+	if (armed)
+		ArmWatch(0);
+#endif
+
+	ProfileInstruction(CpuCurrentState());
+
+#ifdef WATCHPOINTS
+	if (armed)
+		ArmWatch(1);
+#endif
+
+	/* GetSystemFlags() has just started a new period, skip all but */
+	/* gProfilePeriod instructions of it, still counting them all. */
+	gCheckForInterrupts += skip;
+	gInstructions -= skip;
+
+	if ((gProfileSincePoll += gProfilePeriod) < kCheckForInterrupts)
+		return 0;
+
+	gProfileSincePoll = 0;
+
+	return 1;
+
+}
+
+/* ProfileCount() returns the number of instructions counted. */
+unsigned long ProfileCount(void)
+{
+
+	return (gProfile == 0) ? 0 : gProfile->count;
+
+}
+
+/* ProfileSampled() returns non-zero if the profile was sampled. */
+int ProfileSampled(void)
+{
+
+	return (gProfile != 0) && (gProfile->period != 0);
+
+}
+
+/* CompareHot() sorts the hottest first. There may be thousands of */
+/* ranges, too many for Sort() (see sort.c), so qsort() is used. */
+static int CompareHot(const void *a, const void *b)
+{
+	unsigned long countA = ((const Hot *)a)->count;
+	unsigned long countB = ((const Hot *)b)->count;
+
+	return (countA < countB) - (countA > countB);
+
+}
+
+/* Percent() formats count as a percentage of all instructions. */
+static char *Percent(char *buffer, unsigned long count)
+{
+	unsigned long tenths =
+		(unsigned long)((count * 1000.0) / gProfile->count + 0.5);
+
+	sprintf(buffer, "%3lu.%lu%%", tenths / 10, tenths % 10);
+
+	return buffer;
+
+}
+
+/* ShowRange() displays a range of code and its hottest instruction. */
+static void ShowRange(HotPtr hot)
+{
+	char buffer[256];
+	char name[32];
+	char percent[16];
+	const char *label;
+	Byte code[4];
+	Word offset;
+	Word next;
+	unsigned i;
+
+	/* Name the hottest instruction by its label, if there is one. */
+	if ((label = LabelAt(hot->hottest, &offset)) == 0)
+		sprintf(name, "%04X", hot->hottest & 0xFFFF);
+	else if (offset == 0)
+		sprintf(name, "%.16s", label);
+	else
+		sprintf(name, "%.16s+%04X", label, offset & 0xFFFF);
+
+	for (i = 0; i < 4; i++)
+		code[i] = RdByte(hot->hottest + i);
+	DisassembleInstruction(buffer, hot->hottest, code, &next, 0, 0);
+
+	printf("%04X-%04X %12lu %s  %-21s %s\n",
+	       hot->first & 0xFFFF,
+	       hot->last & 0xFFFF,
+	       hot->count,
+	       Percent(percent, hot->count),
+	       name,
+	       buffer);
+
+}
+
+/* ShowOpcode() displays an opcode, with zero operands. */
+static void ShowOpcode(HotPtr hot)
+{
+	static const Byte prefix[kMaxOpcodes][3] = {
+		{ 0 },
+#ifdef Z80
+		{ 1, 0xCB },
+		{ 1, 0xDD },
+		{ 1, 0xED },
+		{ 1, 0xFD },
+		{ 2, 0xDD, 0xCB },
+		{ 2, 0xFD, 0xCB },
+#endif
+	};
+	const Byte *p = prefix[hot->first];
+	char buffer[256];
+	char bytes[16];
+	char percent[16];
+	Byte code[4];
+	Word next;
+
+	memset(code, 0, sizeof(code));
+	memcpy(code, &p[1], p[0]);
+	/* The DDCB and FDCB opcodes follow the displacement. */
+	code[(p[0] == 2) ? 3 : p[0]] = (Byte)hot->last;
+	DisassembleInstruction(buffer, 0, code, &next, 0, 0);
+
+	if (p[0] == 0)
+		sprintf(bytes, "%02X", hot->last & 0xFF);
+	else if (p[0] == 1)
+		sprintf(bytes, "%02X %02X", p[1], hot->last & 0xFF);
+	else
+		sprintf(bytes, "%02X %02X %02X", p[1], p[2], hot->last & 0xFF);
+
+	printf("%-9s %12lu %s  %s\n",
+	       bytes,
+	       hot->count,
+	       Percent(percent, hot->count),
+	       buffer);
+
+}
+
+/* ProfileReport() shows the maxRange hottest ranges of code, the */
+/* most executed opcodes and the ports used. */
+void ProfileReport(unsigned maxRange)
+{
+	HotPtr hot;
+	unsigned maxHot = 0;
+	unsigned ports = 0;
+	unsigned long address;
+	unsigned long count;
+	unsigned long gap;
+	unsigned table;
+	Word offset;
+	unsigned i;
+
+	if ((gProfile == 0) || (gProfile->count == 0)) {
+		printf("?NOPROFILE\n");
+		return;
+	}
+
+	/* There are fewer ranges than addresses, or than opcodes. */
+	if ((hot = malloc(65536 * sizeof(Hot))) == 0) {
+		printf("?MALLOC\n");
+		return;
+	}
+
+	/* Sum the counts into ranges, a label starts a new one. */
+	gap = (gProfile->period != 0) ? kMaxSampleGap : kMaxGap;
+	for (address = 0; address < 65536; address++) {
+		if ((count = gProfile->address[address]) == 0)
+			continue;
+		if ((maxHot == 0) ||
+		    (address - hot[maxHot - 1].last > gap) ||
+		    ((LabelAt((Word)address, &offset) != 0) && (offset == 0))) {
+			hot[maxHot].count = 0;
+			hot[maxHot].first = (Word)address;
+			hot[maxHot].hottest = (Word)address;
+			maxHot++;
+		}
+		hot[maxHot - 1].count += count;
+		hot[maxHot - 1].last = (Word)address;
+		if (count > gProfile->address[hot[maxHot - 1].hottest])
+			hot[maxHot - 1].hottest = (Word)address;
+	}
+	qsort(hot, maxHot, sizeof(Hot), CompareHot);
+
+	if (gProfile->period != 0)
+		printf("%lu SAMPLES, ONE PER %lu INSTRUCTIONS, IN %u RANGES\n",
+		       gProfile->count, gProfile->period, maxHot);
+	else
+		printf("%lu INSTRUCTIONS IN %u RANGES\n", gProfile->count, maxHot);
+	printf("RANGE            COUNT PERCENT  HOTTEST\n");
+	for (i = 0; (i < maxHot) && (i < maxRange); i++)
+		ShowRange(&hot[i]);
+
+	/* Then the opcodes, of all the tables. */
+	maxHot = 0;
+	for (table = 0; table < kMaxOpcodes; table++)
+		for (i = 0; i < 256; i++)
+			if ((count = gProfile->opcode[table][i]) != 0) {
+				hot[maxHot].count = count;
+				hot[maxHot].first = (Word)table;
+				hot[maxHot].last = (Word)i;
+				maxHot++;
+			}
+	qsort(hot, maxHot, sizeof(Hot), CompareHot);
+
+	printf("OPCODE           COUNT PERCENT\n");
+	for (i = 0; (i < maxHot) && (i < kReportOpcodes); i++)
+		ShowOpcode(&hot[i]);
+
+	/* And the ports, if any were used. */
+	for (i = 0; i < 256; i++)
+		if ((gProfile->input[i] != 0) || (gProfile->output[i] != 0)) {
+			if (!ports++)
+				printf("PORT            INPUT       OUTPUT\n");
+			printf("%02X        %12lu %12lu\n",
+			       i,
+			       gProfile->input[i],
+			       gProfile->output[i]);
+		}
+
+	free(hot);
+
+}
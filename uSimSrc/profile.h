@@ -0,0 +1,69 @@
+/* uSim profile.h
+ * Copyright (C) 2000, Tsurishaddai Williamson, tsuri@earthlink.net
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+/**********************************************************************/
+
+/* The profiler samples the instruction about to execute every
+ * kProfilePeriod instructions while it is on, by address and by
+ * opcode, and counts the IN and OUT instructions by port. Cpu() polls
+ * the system every so many instructions (see GetSystemFlags()), and
+ * while sampling SystemInterrupt() calls ProfileSample(), which counts
+ * the instruction and brings the next poll forward to the next sample.
+ * The monitor can also count every instruction, by calling
+ * ProfileInstruction() with the CPU state before each one, as it does
+ * to trace, at the cost of the monitor running for each. PROFILE
+ * REPORT calls ProfileReport(), which sums the address counts into
+ * ranges of code, split by gaps and by the labels of the last program
+ * assembled from source (see LabelAt()), and shows the hottest.
+ */
+
+/* A prime, so that the samples do not beat with the loops of a program. */
+#define kProfilePeriod 9973
+
+/* gProfilePeriod is the sampling period, zero while not sampling. */
+extern MACHINE unsigned long gProfilePeriod;
+
+/* ProfileOpen() starts a new profile, with all counts zero, sampling */
+/* every period instructions, or if period is zero counting only what */
+/* ProfileInstruction() is given. */
+/* Returns zero if there was an error. */
+extern int ProfileOpen(unsigned long period);
+
+/* ProfileStop() stops sampling, the counts are kept for the report. */
+extern void ProfileStop(void);
+
+/* ProfileClose() frees the profile. */
+extern void ProfileClose(void);
+
+/* ProfileInstruction() counts the instruction about to execute. */
+extern void ProfileInstruction(CpuStatePtr s);
+
+/* ProfileSample() samples the instruction about to execute and starts */
+/* the next sampling period. Returns non-zero when the system poll, */
+/* every kCheckForInterrupts instructions, is due. */
+extern int ProfileSample(void);
+
+/* ProfileCount() returns the number of instructions counted. */
+extern unsigned long ProfileCount(void);
+
+/* ProfileSampled() returns non-zero if the profile was sampled. */
+extern int ProfileSampled(void);
+
+/* ProfileReport() shows the maxRange hottest ranges of code, the */
+/* most executed opcodes and the ports used. */
+extern void ProfileReport(unsigned maxRange);
@@ -0,0 +1,141 @@
+/* uSim snapshot.c
+ * Copyright (C) 2000, Tsurishaddai Williamson, tsuri@earthlink.net
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+/**********************************************************************/
+
+#include "ustdio.h"
+#include <string.h>
+
+#include "memory.h"
+#include "system.h"
+#include "cpu.h"
+#include "snapshot.h"
+
+/**********************************************************************/
+#pragma mark *** SNAPSHOT ***
+
+/* The build options that change the machine state, or how it is */
+/* saved, are part of the magic: another build rejects the file. */
+#ifdef BLOCK_CACHE
+#define kSnapshotBLOCK_CACHE " BLOCK_CACHE"
+#else
+#define kSnapshotBLOCK_CACHE ""
+#endif
+#ifdef JIT
+#define kSnapshotJIT " JIT"
+#else
+#define kSnapshotJIT ""
+#endif
+#ifdef LAZY_FLAGS
+#define kSnapshotLAZY_FLAGS " LAZY_FLAGS"
+#else
+#define kSnapshotLAZY_FLAGS ""
+#endif
+#ifdef DIRTY_PAGES
+#define kSnapshotDIRTY_PAGES " DIRTY_PAGES"
+#else
+#define kSnapshotDIRTY_PAGES ""
+#endif
+#ifdef WATCHPOINTS
+#define kSnapshotWATCHPOINTS " WATCHPOINTS"
+#else
+#define kSnapshotWATCHPOINTS ""
+#endif
+#ifdef REVERSE
+#define kSnapshotREVERSE " REVERSE"
+#else
+#define kSnapshotREVERSE ""
+#endif
+
+#define kSnapshotMagic \
+	kProgram " " kVersion " " CPU \
+	kSnapshotBLOCK_CACHE kSnapshotJIT kSnapshotLAZY_FLAGS \
+	kSnapshotDIRTY_PAGES kSnapshotWATCHPOINTS kSnapshotREVERSE \
+	" SNAPSHOT\n"
+
+/* The layout follows the magic, for a host or a CpuState that */
+/* differs in size. */
+static const unsigned long kSnapshotLayout[] = {
+	sizeof(CpuState),
+	sizeof(unsigned long),
+	sizeof(void *)
+};
+
+/* DoSnapshot() saves or loads every subsystem. */
+static int DoSnapshot(const char *name, int isLoad)
+{
+	char magic[sizeof(kSnapshotMagic)];
+	unsigned long layout[sizeof(kSnapshotLayout) / sizeof(unsigned long)];
+	Snapshot s;
+
+	s.isLoad = isLoad;
+	s.isError = 0;
+	if ((s.file = FOpenPath(name, isLoad ? "rb" : "wb")) == 0)
+		goto error;
+
+	/* Only load a snapshot from this build. */
+	strcpy(magic, kSnapshotMagic);
+	SnapshotValue(&s, magic);
+	if (strcmp(magic, kSnapshotMagic))
+		s.isError = 1;
+	memcpy(layout, kSnapshotLayout, sizeof(layout));
+	SnapshotValue(&s, layout);
+	if (memcmp(layout, kSnapshotLayout, sizeof(layout)))
+		s.isError = 1;
+
+	/* Every subsystem, always in the same order. */
+	if (!s.isError) {
+		CpuSnapshot(&s);
+		MemorySnapshot(&s);
+		SystemSnapshot(&s);
+		BDevSnapshot(&s);
+		CDevSnapshot(&s);
+		ConsoleSnapshot(&s);
+	}
+
+	if (fclose(s.file) != 0)
+		s.isError = 1;
+
+	if (s.isError)
+		goto error;
+
+	/* All done, no error, return non-zero. */
+	return 1;
+
+	/* Return zero if there was an error. */
+error:
+	return 0;
+
+}
+
+/* SnapshotSave() saves the machine state to a file. */
+int SnapshotSave(const char *name)
+{
+
+	return DoSnapshot(name, 0);
+
+}
+
+/* SnapshotLoad() loads the machine state from a file. */
+/* The machine state is undefined if there was an error. */
+int SnapshotLoad(const char *name)
+{
+
+	return DoSnapshot(name, 1);
+
+}
@@ -0,0 +1,74 @@
+/* uSim snapshot.h
+ * Copyright (C) 2000, Tsurishaddai Williamson, tsuri@earthlink.net
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+/**********************************************************************/
+
+/* A snapshot is the whole machine state in a file. Each subsystem
+ * saves and loads its own state with one XxxSnapshot() function, the
+ * same code both ways, so the two can not drift apart. A snapshot is
+ * raw host data: it can only be loaded by the same build of uSim.
+ */
+
+typedef struct Snapshot Snapshot;
+typedef Snapshot *SnapshotPtr;
+
+struct Snapshot {
+	FILE *file;
+	int isLoad;
+	int isError;
+};
+
+/* SnapshotBytes() saves or loads size bytes of state. */
+/* Returns zero once there has been an error. */
+static inline int
+	SnapshotBytes(SnapshotPtr s, void *data, unsigned long size)
+{
+
+	if (s->isError)
+		return 0;
+
+	if (s->isLoad) {
+		if (fread(data, 1, size, s->file) != size)
+			s->isError = 1;
+	}
+	else {
+		if (fwrite(data, 1, size, s->file) != size)
+			s->isError = 1;
+	}
+
+	return !s->isError;
+
+}
+
+#define SnapshotValue(s, value) SnapshotBytes((s), &(value), sizeof(value))
+
+extern int SnapshotSave(const char *name);
+
+extern int SnapshotLoad(const char *name);
+
+extern void CpuSnapshot(SnapshotPtr s);
+
+extern void MemorySnapshot(SnapshotPtr s);
+
+extern void SystemSnapshot(SnapshotPtr s);
+
+extern void BDevSnapshot(SnapshotPtr s);
+
+extern void CDevSnapshot(SnapshotPtr s);
+
+extern void ConsoleSnapshot(SnapshotPtr s);
@@ -1 +1 @@
-/* uSim system.h * Copyright (C) 2000, Tsurishaddai Williamson, tsuri@earthlink.net *  * This program is free software; you can redistribute it and/or * modify it under the terms of the GNU General Public License * as published by the Free Software Foundation; either version 2 * of the License, or (at your option) any later version. *  * This program is distributed in the hope that it will be useful, * but WITHOUT ANY WARRANTY; without even the implied warranty of * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the * GNU General Public License for more details. *  * You should have received a copy of the GNU General Public License * along with this program; if not, write to the Free Software * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA. *//**********************************************************************/#define kVersion "1.0"#define kProgram "uSim"#define kCopyright "Copyright (C) 2000, Tsurishaddai Williamson"#define kSystemID 0#define kBOOTBAT "BOOT.BAT"#define kSYSTEMEQU "SYSTEM.EQU"typedef struct CpuState CpuState;typedef CpuState *CpuStatePtr;enum {	kSystemSwitch0 = 0x01,	kSystemLight0  = 0x01,	kSystemSwitch1 = 0x02,	kSystemLight1  = 0x02,	kSystemSwitch2 = 0x04,	kSystemLight2  = 0x04,	kSystemSwitch3 = 0x08,	kSystemLight3  = 0x08,	kSystemSwitch4 = 0x10,	kSystemLight4  = 0x10,	kSystemSwitch5 = 0x20,	kSystemLight5  = 0x20,	kSystemSwitch6 = 0x40,	kSystemLight6  = 0x40,	kSystemSwitch7 = 0x80,	kSystemLight7  = 0x80,	kSystemReset   = kSystemSwitch0,	kSystemMonitor = kSystemSwitch1,	kSystemHalt    = kSystemSwitch2,	kSystemBreak   = kSystemSwitch3,	kSystemUnused4 = kSystemSwitch4,	kSystemUnused5 = kSystemSwitch5,	kSystemUnused6 = kSystemSwitch6,	kSystemUnused7 = kSystemSwitch7};extern void SystemInterrupt(void);extern Byte gSystemFlags;#define kCheckForInterrupts (1024 * 1024)extern unsigned long gCheckForInterrupts;static inline unsigned GetSystemFlags(void){	if (gCheckForInterrupts++ > kCheckForInterrupts) {		gCheckForInterrupts = 0;		SystemInterrupt();	}	return gSystemFlags;}extern void SetSystemFlags(unsigned on, unsigned off);extern unsigned long GetSystemID(void);extern void SetSystemID(unsigned long systemID);extern void ResetSystemID(void);typedef void (*PortFunction)(Byte *, Byte);extern PortFunction gSystemPort[];static inline void SystemInput(Byte port, Byte *value){	(*(gSystemPort[port]))(value, 0);}static inline void SystemOutput(Byte port, Byte value){	(*(gSystemPort[port]))(0, value);}extern int SetupSystemPorts(void);extern int GenerateSystemEqu(const char *name);#define kConsoleColorSystem kConsoleColorCyan
\ No newline at end of file
+/* uSim system.h * Copyright (C) 2000, Tsurishaddai Williamson, tsuri@earthlink.net *  * This program is free software; you can redistribute it and/or * modify it under the terms of the GNU General Public License * as published by the Free Software Foundation; either version 2 * of the License, or (at your option) any later version. *  * This program is distributed in the hope that it will be useful, * but WITHOUT ANY WARRANTY; without even the implied warranty of * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the * GNU General Public License for more details. *  * You should have received a copy of the GNU General Public License * along with this program; if not, write to the Free Software * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA. *//**********************************************************************/#include "bdev.h"#define kVersion "1.0"#define kProgram "uSim"#define kCopyright "Copyright (C) 2000, Tsurishaddai Williamson"#define kSystemID 0#define kBOOTBAT "BOOT.BAT"#define kSYSTEMEQU "SYSTEM.EQU"typedef struct CpuState CpuState;typedef CpuState *CpuStatePtr;enum {	kSystemSwitch0 = 0x01,	kSystemLight0  = 0x01,	kSystemSwitch1 = 0x02,	kSystemLight1  = 0x02,	kSystemSwitch2 = 0x04,	kSystemLight2  = 0x04,	kSystemSwitch3 = 0x08,	kSystemLight3  = 0x08,	kSystemSwitch4 = 0x10,	kSystemLight4  = 0x10,	kSystemSwitch5 = 0x20,	kSystemLight5  = 0x20,	kSystemSwitch6 = 0x40,	kSystemLight6  = 0x40,	kSystemSwitch7 = 0x80,	kSystemLight7  = 0x80,	kSystemReset   = kSystemSwitch0,	kSystemMonitor = kSystemSwitch1,	kSystemHalt    = kSystemSwitch2,	kSystemBreak   = kSystemSwitch3,	kSystemINT     = kSystemSwitch4,	kSystemNMI     = kSystemSwitch5,	kSystemUnused6 = kSystemSwitch6,	kSystemUnused7 = kSystemSwitch7};/* Interrupt sources, see the INTMSK and INTPND ports. */enum {	kInterruptConsole = 0x01,	kInterruptTimer   = 0x02,	kInterruptDisk    = 0x04};extern void SystemInterrupt(void);/* SystemTick() calls SystemInterrupt(), or samples (see profile.h). */extern void SystemTick(void);/* SystemIdle() blocks the host while the CPU has nothing to do. *//* A HALT waiting for an interrupt idles kHaltIdle ms at a time. */#define kHaltIdle 100extern void SystemIdle(unsigned long milliseconds);extern void SystemRequestInterrupt(unsigned source);extern void ResetSystemInterrupts(void);extern MACHINE Byte gSystemFlags;#define kCheckForInterrupts (1024 * 1024)extern MACHINE unsigned long gCheckForInterrupts;/* gInstructions counts the instructions of the past periods. */extern MACHINE unsigned long gInstructions;static inline unsigned GetSystemFlags(void){	if (gCheckForInterrupts++ > kCheckForInterrupts) {		gInstructions += gCheckForInterrupts;		gCheckForInterrupts = 0;		SystemTick();	}	return gSystemFlags;}/* SystemInstructions() returns the instructions executed so far. */static inline unsigned long SystemInstructions(void){	return gInstructions + gCheckForInterrupts;}extern void SetSystemFlags(unsigned on, unsigned off);extern unsigned long GetSystemID(void);extern void SetSystemID(unsigned long systemID);extern void ResetSystemID(void);/* gSystemStats counts what the machine does, for the STATS command. *//* The host time is in microseconds (see GetMicroseconds()), the CPU *//* time being what the monitor, the devices and idling leave of the *//* time since ResetSystemStats(). LogSystemStats() also appends them *//* to a file every so many seconds, or stops if file is zero. */typedef struct SystemStats SystemStats;struct SystemStats {	unsigned long long start;          /* host time at the reset */	unsigned long instructions;        /* SystemInstructions() then */	unsigned long long monitor;        /* host time in the monitor */	unsigned long long monitorSince;   /* non-zero while in the monitor */	unsigned long long device;         /* host time in device handlers */	unsigned long long idle;           /* host time in SystemIdle() */	unsigned long polls;               /* SystemInterrupt() calls */	unsigned long banks;               /* WrBank() calls */	unsigned long consoleInput;        /* console bytes read */	unsigned long consoleOutput;       /* console bytes written */	unsigned long sectorsRead[kMaxBDev];    /* for each disk */	unsigned long sectorsWritten[kMaxBDev];	unsigned long input[256];          /* reads of each gSystemPort[] */	unsigned long output[256];         /* writes of each gSystemPort[] */};extern MACHINE SystemStats gSystemStats;extern void ResetSystemStats(void);extern void ShowSystemStats(void);extern int LogSystemStats(const char *file, unsigned long seconds);typedef void (*PortFunction)(Byte *, Byte);extern MACHINE PortFunction gSystemPort[];static inline void SystemInput(Byte port, Byte *value){	gSystemStats.input[port]++;	(*(gSystemPort[port]))(value, 0);}static inline void SystemOutput(Byte port, Byte value){	gSystemStats.output[port]++;	(*(gSystemPort[port]))(0, value);}extern int SetupSystemPorts(void);extern int GenerateSystemEqu(const char *name);#define kConsoleColorSystem kConsoleColorCyan
\ No newline at end of file
@@ -0,0 +1,325 @@
+/* uSim trace.c
+ * Copyright (C) 2000, Tsurishaddai Williamson, tsuri@earthlink.net
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+/**********************************************************************/
+
+/* trace.c uses the host stdio alone, so that the uSimTrace decoder */
+/* can be built from it without the console. */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "memory.h"
+#include "system.h"
+#include "cpu.h"
+#include "trace.h"
+
+/**********************************************************************/
+#pragma mark *** TRACE ***
+
+/* Records are collected in a buffer of kTraceBuffer bytes, and the */
+/* file is only written (or read) a buffer at a time. */
+#define kTraceBuffer (1024 * 1024)
+
+#define kMaxTraceRecord \
+	(sizeof(Word) + sizeof(unsigned long long) + \
+	 kTraceRegisters * sizeof(Word) + 4)
+
+#define kTraceAll ((1 << kTraceRegisters) - 1)
+
+struct Trace {
+	FILE *file;
+	int isWrite;
+	int delta;
+	int isError;
+	/* The previous record, the base of the next delta. */
+	int started;
+	TraceRecord last;
+	/* The buffer holds size bytes, reading continues at next. */
+	unsigned long size;
+	unsigned long next;
+	Byte buffer[kTraceBuffer];
+};
+
+/* NewTrace() allocates a trace for an open file. */
+static TracePtr NewTrace(FILE *file, int isWrite, int delta)
+{
+	TracePtr t;
+
+	if ((t = malloc(sizeof(Trace))) == 0) {
+		fclose(file);
+		return 0;
+	}
+
+	memset(t, 0, sizeof(Trace));
+	t->file = file;
+	t->isWrite = isWrite;
+	t->delta = delta;
+
+	return t;
+
+}
+
+/* TraceFlush() writes the buffered records. */
+static int TraceFlush(TracePtr t)
+{
+
+	if ((t->size > 0) &&
+	    (fwrite(t->buffer, 1, t->size, t->file) != t->size))
+		t->isError = 1;
+	t->size = 0;
+
+	return !t->isError;
+
+}
+
+/* TraceFill() reads more records into the buffer. */
+static void TraceFill(TracePtr t)
+{
+
+	memmove(t->buffer, &t->buffer[t->next], t->size - t->next);
+	t->size -= t->next;
+	t->next = 0;
+	t->size += fread(&t->buffer[t->size],
+	                 1,
+	                 kTraceBuffer - t->size,
+	                 t->file);
+
+}
+
+/* RecordLength() returns the length of a record with this mask. */
+static unsigned long RecordLength(Word mask)
+{
+	unsigned long length = sizeof(Word) + 4;
+	unsigned i;
+
+	length += (mask & kTraceCycles) ? sizeof(unsigned long long) : 1;
+	for (i = 0; i < kTraceRegisters; i++)
+		if (mask & (1 << i))
+			length += sizeof(Word);
+
+	return length;
+
+}
+
+/* TraceOpen() opens a trace file for writing, or appending. */
+/* Returns zero if there was an error. */
+TracePtr TraceOpen(const char *name, int append, int delta)
+{
+	FILE *file;
+
+	if ((file = fopen(name, append ? "ab" : "wb")) == 0)
+		goto error;
+
+	/* Only a new file needs the magic. */
+	if ((fseek(file, 0, SEEK_END) != 0) ||
+	    ((ftell(file) == 0) &&
+	     (fputs(kTraceMagic, file) == EOF))) {
+		fclose(file);
+		goto error;
+	}
+
+	return NewTrace(file, 1, delta);
+
+	/* Return zero if there was an error. */
+error:
+	return 0;
+
+}
+
+/* TraceWrite() writes a record of the CPU state. */
+/* Returns zero if there was an error. */
+int TraceWrite(TracePtr t, CpuStatePtr s)
+{
+	TraceRecord r;
+	Word mask = kTraceAll | kTraceCycles;
+	Byte *b;
+	unsigned i;
+
+	r.cycles = s->cycles;
+	r.reg[kTracePC] = s->pc.word;
+	r.reg[kTraceAF] = s->af.word;
+	r.reg[kTraceBC] = s->bc.word;
+	r.reg[kTraceDE] = s->de.word;
+	r.reg[kTraceHL] = s->hl.word;
+	r.reg[kTraceSP] = s->sp.word;
+#ifdef Z80
+	r.reg[kTraceIX] = s->ix.word;
+	r.reg[kTraceIY] = s->iy.word;
+	r.reg[kTraceAF2] = s->prime.af.word;
+	r.reg[kTraceBC2] = s->prime.bc.word;
+	r.reg[kTraceDE2] = s->prime.de.word;
+	r.reg[kTraceHL2] = s->prime.hl.word;
+#endif
+	for (i = 0; i < 4; i++)
+		r.code[i] = RdByte(s->pc.word + i);
+
+	/* Only the changes, unless this is the first record. */
+	if (t->delta && t->started) {
+		mask = 0;
+		for (i = 0; i < kTraceRegisters; i++)
+			if (r.reg[i] != t->last.reg[i])
+				mask |= 1 << i;
+		if ((r.cycles - t->last.cycles) > 0xFF)
+			mask |= kTraceCycles;
+	}
+
+	if ((t->size + kMaxTraceRecord > kTraceBuffer) && !TraceFlush(t))
+		return 0;
+
+	b = &t->buffer[t->size];
+	memcpy(b, &mask, sizeof(mask));
+	b += sizeof(mask);
+	if (mask & kTraceCycles) {
+		memcpy(b, &r.cycles, sizeof(r.cycles));
+		b += sizeof(r.cycles);
+	}
+	else
+		*b++ = (Byte)(r.cycles - t->last.cycles);
+	for (i = 0; i < kTraceRegisters; i++)
+		if (mask & (1 << i)) {
+			memcpy(b, &r.reg[i], sizeof(Word));
+			b += sizeof(Word);
+		}
+	memcpy(b, r.code, 4);
+	b += 4;
+	t->size = b - t->buffer;
+
+	t->last = r;
+	t->started = 1;
+
+	return 1;
+
+}
+
+/* TraceOpenRead() opens a trace file for reading. */
+/* Returns zero if there was an error. */
+TracePtr TraceOpenRead(const char *name)
+{
+	char magic[sizeof(kTraceMagic)];
+	FILE *file;
+
+	if ((file = fopen(name, "rb")) == 0)
+		goto error;
+
+	/* Only read a trace of this CPU. */
+	if ((fread(magic, 1, sizeof(kTraceMagic) - 1, file) !=
+	     sizeof(kTraceMagic) - 1) ||
+	    (memcmp(magic, kTraceMagic, sizeof(kTraceMagic) - 1) != 0)) {
+		fclose(file);
+		goto error;
+	}
+
+	return NewTrace(file, 0, 0);
+
+	/* Return zero if there was an error. */
+error:
+	return 0;
+
+}
+
+/* TraceRead() reads the next record. */
+/* Returns zero at the end of the file, or if there was an error. */
+int TraceRead(TracePtr t, TraceRecordPtr r)
+{
+	Word mask;
+	Byte *b;
+	unsigned i;
+
+	if (t->next + kMaxTraceRecord > t->size)
+		TraceFill(t);
+
+	/* The end of the file, or a record cut short? */
+	if (t->next == t->size)
+		return 0;
+	b = &t->buffer[t->next];
+	if (t->next + sizeof(mask) > t->size)
+		goto error;
+	memcpy(&mask, b, sizeof(mask));
+	if (t->next + RecordLength(mask) > t->size)
+		goto error;
+	b += sizeof(mask);
+
+	*r = t->last;
+	if (mask & kTraceCycles) {
+		memcpy(&r->cycles, b, sizeof(r->cycles));
+		b += sizeof(r->cycles);
+	}
+	else
+		r->cycles += *b++;
+	for (i = 0; i < kTraceRegisters; i++)
+		if (mask & (1 << i)) {
+			memcpy(&r->reg[i], b, sizeof(Word));
+			b += sizeof(Word);
+		}
+	memcpy(r->code, b, 4);
+	b += 4;
+
+	t->next = b - t->buffer;
+	t->last = *r;
+
+	/* All done, no error, return non-zero. */
+	return 1;
+
+	/* Return zero if there was an error. */
+error:
+	t->isError = 1;
+	return 0;
+
+}
+
+/* TraceClose() closes a trace file. */
+/* Returns zero if there was an error. */
+int TraceClose(TracePtr t)
+{
+	int isError;
+
+	if (t->isWrite)
+		TraceFlush(t);
+	if (fclose(t->file) != 0)
+		t->isError = 1;
+
+	isError = t->isError;
+	free(t);
+
+	return !isError;
+
+}
+
+/* TraceCpuState() fills in the CPU state of a record. */
+void TraceCpuState(TraceRecordPtr r, CpuStatePtr s)
+{
+
+	memset(s, 0, sizeof(CpuState));
+	s->cycles = r->cycles;
+	s->pc.word = r->reg[kTracePC];
+	s->af.word = r->reg[kTraceAF];
+	s->bc.word = r->reg[kTraceBC];
+	s->de.word = r->reg[kTraceDE];
+	s->hl.word = r->reg[kTraceHL];
+	s->sp.word = r->reg[kTraceSP];
+#ifdef Z80
+	s->ix.word = r->reg[kTraceIX];
+	s->iy.word = r->reg[kTraceIY];
+	s->prime.af.word = r->reg[kTraceAF2];
+	s->prime.bc.word = r->reg[kTraceBC2];
+	s->prime.de.word = r->reg[kTraceDE2];
+	s->prime.hl.word = r->reg[kTraceHL2];
+#endif
+
+}
@@ -0,0 +1,89 @@
+/* uSim trace.h
+ * Copyright (C) 2000, Tsurishaddai Williamson, tsuri@earthlink.net
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+/**********************************************************************/
+
+/* A binary trace is a file of TraceRecord records, one for every
+ * instruction traced, instead of the text of DissasembleCpuState().
+ * Each record is written as a Word mask, the T-states, the registers
+ * whose mask bits are set and the four bytes of code at PC. Without
+ * delta compression every mask bit is set, so every record has the
+ * same size. With it, a record only holds the registers that changed
+ * and a byte of T-states since the previous record, and the first
+ * record written after opening the file is complete again. The file
+ * begins with kTraceMagic. Like a snapshot, a trace is raw host data:
+ * uSimTrace (tracedec.c) decodes it on the same kind of host.
+ */
+
+#define kTraceMagic "uSim " CPU " TRACE\n"
+
+enum {
+	kTracePC,
+	kTraceAF,
+	kTraceBC,
+	kTraceDE,
+	kTraceHL,
+	kTraceSP,
+#ifdef Z80
+	kTraceIX,
+	kTraceIY,
+	kTraceAF2,
+	kTraceBC2,
+	kTraceDE2,
+	kTraceHL2,
+#endif
+	kTraceRegisters
+};
+
+/* The mask bit set when the T-states are not a byte of delta. */
+#define kTraceCycles 0x8000
+
+typedef struct TraceRecord TraceRecord;
+typedef TraceRecord *TraceRecordPtr;
+
+struct TraceRecord {
+	unsigned long long cycles;
+	Word reg[kTraceRegisters];
+	Byte code[4];
+};
+
+typedef struct Trace Trace;
+typedef Trace *TracePtr;
+
+/* TraceOpen() opens a trace file for writing, or appending. */
+/* Returns zero if there was an error. */
+extern TracePtr TraceOpen(const char *name, int append, int delta);
+
+/* TraceWrite() writes a record of the CPU state. */
+/* Returns zero if there was an error. */
+extern int TraceWrite(TracePtr t, CpuStatePtr s);
+
+/* TraceOpenRead() opens a trace file for reading. */
+/* Returns zero if there was an error. */
+extern TracePtr TraceOpenRead(const char *name);
+
+/* TraceRead() reads the next record. */
+/* Returns zero at the end of the file, or if there was an error. */
+extern int TraceRead(TracePtr t, TraceRecordPtr r);
+
+/* TraceClose() closes a trace file. */
+/* Returns zero if there was an error. */
+extern int TraceClose(TracePtr t);
+
+/* TraceCpuState() fills in the CPU state of a record. */
+extern void TraceCpuState(TraceRecordPtr r, CpuStatePtr s);
@@ -0,0 +1,318 @@
+/* uSim tracedec.c
+ * Copyright (C) 2000, Tsurishaddai Williamson, tsuri@earthlink.net
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+/**********************************************************************/
+
+/* uSimTrace decodes a binary trace, written by TRACE -B or TRACE -D,
+ * into the text of a TRACE file. It is built from trace.c and dasm.c
+ * alone: the code bytes of each record are put into a 64K memory of
+ * its own, so that DissasembleCpuState() formats the record exactly
+ * as the monitor would. -P<FIRST>-<LAST> (hex) only decodes the
+ * records whose PC is in that range, and -C puts the T-states in
+ * front of every record.
+ *
+ * -F<COUNT> prints opfuse.h instead: the COUNT pairs of one byte
+ * instructions that most often run one after the other in the trace,
+ * and that the block cache can run as one (see FuseBlockOps() in
+ * cpu.c). The opcodes are taken from op.h.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+
+#include "memory.h"
+#include "system.h"
+#include "cpu.h"
+#include "dasm.h"
+#include "trace.h"
+
+/**********************************************************************/
+#pragma mark *** CONSOLE ***
+
+/* dasm.c formats through the console, here it is the host stdio. */
+
+int ConsoleSPrintf(char *buffer, const char *format, ...)
+{
+	va_list ap;
+	int result;
+
+	va_start(ap, format);
+	result = vsprintf(buffer, format, ap);
+	va_end(ap);
+
+	return result;
+
+}
+
+int ConsolePrintf(const char *format, ...)
+{
+	va_list ap;
+	int result;
+
+	va_start(ap, format);
+	result = vprintf(format, ap);
+	va_end(ap);
+
+	return result;
+
+}
+
+int ConsoleFPrintf(FILE *file, const char *format, ...)
+{
+	va_list ap;
+	int result;
+
+	va_start(ap, format);
+	result = vfprintf(file, format, ap);
+	va_end(ap);
+
+	return result;
+
+}
+
+int ConsoleInput(unsigned waitSeconds)
+{
+
+	return 0;
+
+}
+
+/**********************************************************************/
+#pragma mark *** MEMORY ***
+
+static Byte gMemory[kMaxBank * kBankSize];
+
+MACHINE Byte *gRdBank[kMaxBank];
+
+/* The trace memory is read through the banks. */
+MACHINE Byte *gFlat;
+
+#ifdef WATCHPOINTS
+/* There is nothing to watch. */
+Byte *WatchRead(Word address)
+{
+
+	return &gMemory[address & 0xC000];
+
+}
+#endif
+
+/**********************************************************************/
+#pragma mark *** FUSE ***
+
+typedef struct FuseInfo {
+	Byte length;
+	char jmp;
+	const char *mnemonic;
+	const char *name8080;
+	const char *nameZ80;
+} FuseInfo;
+
+/* CODE spells out two hex digits per instruction byte. */
+#define OPERATION(INDEX, CODE, JMP, N8080, NZ80, F8080, FZ80, T8080, TZ80) \
+	{ sizeof(#CODE) / 2, #JMP[0], NZ80, #F8080, #FZ80 },
+
+static const FuseInfo gFuseInfo[256] = {
+#include "op.h"
+};
+
+#undef OPERATION
+
+/* gFuseCount[] counts every pair of opcodes, first << 8 | second. */
+static unsigned long gFuseCount[65536];
+
+/* IsFused() returns non-zero if a pair of opcodes can be fused. */
+/* Both take no operands and run the same handler on either CPU; */
+/* the first neither jumps, halts nor writes to memory, which */
+/* could change the code of the second. */
+static int IsFused(unsigned first, unsigned second)
+{
+	const FuseInfo *f = &gFuseInfo[first];
+	const FuseInfo *s = &gFuseInfo[second];
+
+	if ((f->length != 1) || (s->length != 1))
+		return 0;
+	if (strcmp(f->name8080, f->nameZ80) || strcmp(s->name8080, s->nameZ80))
+		return 0;
+	if ((f->jmp != SIMPLE) ||
+	    (strcmp(f->mnemonic, "HALT") == 0) ||
+	    (strcmp(s->mnemonic, "HALT") == 0))
+		return 0;
+
+	return (strncmp(f->mnemonic, "LD (", 4) != 0) &&
+	       (strncmp(f->mnemonic, "INC (", 5) != 0) &&
+	       (strncmp(f->mnemonic, "DEC (", 5) != 0) &&
+	       (strncmp(f->mnemonic, "EX (", 4) != 0) &&
+	       (strncmp(f->mnemonic, "PUSH", 4) != 0);
+
+}
+
+/* PrintFused() prints opfuse.h, the count most frequent pairs. */
+static void PrintFused(unsigned long count, const char *trace)
+{
+	unsigned long n;
+	unsigned pair;
+	unsigned best;
+
+	printf("/* uSim opfuse.h GENERATED BY uSimTrace -F%lu %s */\n",
+	       count, trace);
+	printf("/* FUSE(FIRST, SECOND, F1, F2), see FuseBlockOps() in cpu.c. */\n");
+
+	for (n = 0; n < count; n++) {
+		best = 0;
+		for (pair = 0; pair < 65536; pair++)
+			if (gFuseCount[pair] > gFuseCount[best])
+				best = pair;
+		if (gFuseCount[best] == 0)
+			break;
+		printf("\n/* %s / %s, %lu */\n",
+		       gFuseInfo[best >> 8].mnemonic,
+		       gFuseInfo[best & 0xFF].mnemonic,
+		       gFuseCount[best]);
+		printf("FUSE(0x%02X, 0x%02X, %s, %s)\n",
+		       best >> 8,
+		       best & 0xFF,
+		       gFuseInfo[best >> 8].nameZ80,
+		       gFuseInfo[best & 0xFF].nameZ80);
+		gFuseCount[best] = 0;
+	}
+
+}
+
+/**********************************************************************/
+#pragma mark *** MAIN ***
+
+/* ParseRange() parses <FIRST>-<LAST>, both in hex. */
+static int ParseRange(const char *s, Word *first, Word *last)
+{
+	unsigned long value;
+	char *end;
+
+	value = strtoul(s, &end, 16);
+	if ((end == s) || (*end != '-') || (value > 0xFFFF))
+		return 0;
+	*first = (Word)value;
+
+	s = end + 1;
+	value = strtoul(s, &end, 16);
+	if ((end == s) || (*end != 0) || (value > 0xFFFF))
+		return 0;
+	*last = (Word)value;
+
+	return 1;
+
+}
+
+int main(int argc, char **argv)
+{
+	char buffer[256];
+	TraceRecord r;
+	CpuState s;
+	TracePtr t;
+	Word first = 0x0000;
+	Word last = 0xFFFF;
+	int cycles = 0;
+	unsigned long fuse = 0;
+	Word next = 0;
+	int previous = -1;
+	char *end;
+	unsigned i;
+	int n;
+
+	/* Parse the command line switches. */
+	for (n = 1; (n < argc) && (argv[n][0] == '-'); n++) {
+		switch (argv[n][1]) {
+		case 'C':
+		case 'c':
+			cycles = 1;
+			break;
+		case 'P':
+		case 'p':
+			if (!ParseRange(&argv[n][2], &first, &last))
+				goto usage;
+			break;
+		case 'F':
+		case 'f':
+			fuse = strtoul(&argv[n][2], &end, 10);
+			if ((end == &argv[n][2]) || (*end != 0) || (fuse == 0))
+				goto usage;
+			break;
+		default:
+			goto usage;
+		}
+	}
+	/* <TRACE FILE> is required. */
+	if (n != argc - 1)
+		goto usage;
+
+	if ((t = TraceOpenRead(argv[n])) == 0) {
+		fprintf(stderr, "?TRACE [%s]\n", argv[n]);
+		goto error;
+	}
+
+	for (i = 0; i < kMaxBank; i++)
+		gRdBank[i] = &gMemory[i * kBankSize];
+
+	while (TraceRead(t, &r)) {
+		if (first <= last) {
+			if ((r.reg[kTracePC] < first) || (r.reg[kTracePC] > last))
+				continue;
+		}
+		else if ((r.reg[kTracePC] < first) && (r.reg[kTracePC] > last))
+			continue;
+		if (fuse) {
+			/* Count straight line pairs only. */
+			if ((previous >= 0) && (r.reg[kTracePC] == next) &&
+			    IsFused(previous, r.code[0]))
+				gFuseCount[previous << 8 | r.code[0]]++;
+			previous = r.code[0];
+			next = r.reg[kTracePC] + 1;
+			continue;
+		}
+		TraceCpuState(&r, &s);
+		for (i = 0; i < 4; i++)
+			gMemory[(Word)(s.pc.word + i)] = r.code[i];
+		DissasembleCpuState(buffer, &s);
+		if (cycles)
+			printf("%llu ", r.cycles);
+		printf("%s\n", buffer);
+	}
+
+	if (!TraceClose(t)) {
+		fprintf(stderr, "?ERROR [%s]\n", argv[n]);
+		goto error;
+	}
+
+	if (fuse)
+		PrintFused(fuse, argv[n]);
+
+	return 0;
+
+	/* Command syntax error. */
+usage:
+	fprintf(stderr,
+	        "usage: %s [-C] [-F<COUNT>] [-P<FIRST>-<LAST>] <TRACE FILE>\n",
+	        argv[0]);
+
+	/* Return non-zero exit status if there was an error. */
+error:
+	return 1;
+
+}